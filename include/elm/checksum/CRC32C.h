@@ -0,0 +1,64 @@
+/*
+ *	checksum::CRC32C class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_CHECKSUM_CRC32C_H
+#define ELM_CHECKSUM_CRC32C_H
+
+#include <elm/types.h>
+#include <elm/string.h>
+#include <elm/io/InStream.h>
+#include <elm/io/OutStream.h>
+
+namespace elm { namespace checksum {
+
+// CRC32C class
+class CRC32C: public io::OutStream {
+public:
+	CRC32C(void);
+	virtual ~CRC32C(void);
+	inline t::uint32 sum(void) const { return ~crc; }
+	inline void reset(void) { crc = 0xffffffff; }
+
+	void put(const void *buffer, int length);
+	void put(const CString& str);
+	void put(const String& str);
+	void put(io::InStream& in);
+
+	inline CRC32C& operator<<(const char *str) { put(CString(str)); return *this; }
+	inline CRC32C& operator<<(const CString& str) { put(str); return *this; }
+	inline CRC32C& operator<<(const String& str) { put(str); return *this; }
+	template <class T> inline CRC32C& operator<<(const T& value) { put(&value, sizeof(T)); return *this; }
+
+	static t::uint32 update(t::uint32 crc, const void *buffer, int length);
+	static t::uint32 updateTable(t::uint32 crc, const void *buffer, int length);
+	static bool isAccelerated(void);
+
+	// io::OutStream overload
+	virtual int write(const char *buffer, int size);
+	virtual int flush(void);
+	virtual cstring lastErrorMessage(void);
+
+private:
+	t::uint32 crc;
+};
+
+} } // elm::checksum
+
+#endif // ELM_CHECKSUM_CRC32C_H
@@ -0,0 +1,66 @@
+/*
+ *	checksum::XXHash64 class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_CHECKSUM_XXHASH64_H
+#define ELM_CHECKSUM_XXHASH64_H
+
+#include <elm/types.h>
+#include <elm/string.h>
+#include <elm/io/InStream.h>
+#include <elm/io/OutStream.h>
+
+namespace elm { namespace checksum {
+
+// XXHash64 class
+class XXHash64: public io::OutStream {
+public:
+	XXHash64(t::uint64 seed = 0);
+	virtual ~XXHash64(void);
+	void reset(t::uint64 seed = 0);
+	t::uint64 digest(void) const;
+
+	void put(const void *buffer, int length);
+	void put(const CString& str);
+	void put(const String& str);
+	void put(io::InStream& in);
+
+	inline XXHash64& operator<<(const char *str) { put(CString(str)); return *this; }
+	inline XXHash64& operator<<(const CString& str) { put(str); return *this; }
+	inline XXHash64& operator<<(const String& str) { put(str); return *this; }
+	template <class T> inline XXHash64& operator<<(const T& value) { put(&value, sizeof(T)); return *this; }
+
+	static t::uint64 hash(const void *buffer, int length, t::uint64 seed = 0);
+
+	// io::OutStream overload
+	virtual int write(const char *buffer, int size);
+	virtual int flush(void);
+	virtual cstring lastErrorMessage(void);
+
+private:
+	t::uint64 v[4];
+	t::uint64 total;
+	t::uint64 _seed;
+	t::uint8 mem[32];
+	int memsize;
+};
+
+} } // elm::checksum
+
+#endif // ELM_CHECKSUM_XXHASH64_H
@@ -0,0 +1,31 @@
+/*
+ *	concur module interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_CONCUR_H_
+#define ELM_CONCUR_H_
+
+#include <elm/concur/BlockingQueue.h>
+#include <elm/concur/ConcurrentHashMap.h>
+#include <elm/concur/MPMCQueue.h>
+#include <elm/concur/MPSCQueue.h>
+#include <elm/concur/SPSCQueue.h>
+#include <elm/concur/ShardedCache.h>
+
+#endif /* ELM_CONCUR_H_ */
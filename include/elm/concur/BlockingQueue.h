@@ -0,0 +1,96 @@
+/*
+ *	concur::BlockingQueue class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_CONCUR_BLOCKINGQUEUE_H_
+#define ELM_CONCUR_BLOCKINGQUEUE_H_
+
+#include <elm/concur/Waiter.h>
+
+namespace elm { namespace concur {
+
+template <class Q>
+class BlockingQueue {
+public:
+	typedef typename Q::t t;
+
+	template <class... A>
+	BlockingQueue(A... args): _q(args...), _closed(false) { }
+
+	inline Q& queue(void) { return _q; }
+	inline bool isEmpty(void) const { return _q.isEmpty(); }
+	inline operator bool(void) const { return !isEmpty(); }
+	inline bool isClosed(void) const { return _closed.load(std::memory_order_acquire); }
+
+	inline bool tryPut(const t& x)
+		{ if(isClosed() || !_q.put(x)) return false; _not_empty.notify(); return true; }
+	inline bool tryGet(t& x)
+		{ if(!_q.get(x)) return false; _not_full.notify(); return true; }
+
+	bool put(const t& x) {
+		if(isClosed())
+			return false;
+		while(!_q.put(x)) {
+			Waiter::key_t k = _not_full.prepare();
+			if(isClosed()) {
+				_not_full.cancel();
+				return false;
+			}
+			if(_q.put(x)) {
+				_not_full.cancel();
+				break;
+			}
+			_not_full.wait(k);
+		}
+		_not_empty.notify();
+		return true;
+	}
+
+	bool get(t& x) {
+		while(!_q.get(x)) {
+			Waiter::key_t k = _not_empty.prepare();
+			if(_q.get(x)) {
+				_not_empty.cancel();
+				break;
+			}
+			if(isClosed()) {
+				_not_empty.cancel();
+				return _q.get(x);
+			}
+			_not_empty.wait(k);
+		}
+		_not_full.notify();
+		return true;
+	}
+
+	void close(void) {
+		_closed.store(true, std::memory_order_release);
+		_not_empty.notifyAll();
+		_not_full.notifyAll();
+	}
+
+private:
+	Q _q;
+	std::atomic<bool> _closed;
+	Waiter _not_empty, _not_full;
+};
+
+} }	// elm::concur
+
+#endif /* ELM_CONCUR_BLOCKINGQUEUE_H_ */
@@ -0,0 +1,534 @@
+/*
+ *	ConcurrentHashMap class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_CONCUR_CONCURRENTHASHMAP_H_
+#define ELM_CONCUR_CONCURRENTHASHMAP_H_
+
+#include <elm/assert.h>
+#include <elm/hash.h>
+#include <elm/util/Option.h>
+#include <elm/concur/Waiter.h>
+#include <elm/sys/Mutex.h>
+
+namespace elm { namespace concur {
+
+template <class K, class T, class H = HashKey<K> >
+class ConcurrentHashMap {
+	typedef elm::t::hash hash_t;
+public:
+	typedef K key_t;
+	typedef T val_t;
+	static const int STRIPES = 64;
+	static const int CHUNK = 16;
+	static const int READERS = 16;
+	static const int RECLAIM = 256;
+
+	ConcurrentHashMap(int size = STRIPES)
+	: _table(nullptr), _retired(nullptr), _garbage(0), _dead(nullptr), _epoch(0), _limbo(nullptr), _ltables(nullptr), _lpar(0) {
+		ASSERTP(size > 0, "size must be positive");
+		int s = STRIPES;
+		while(s < size)
+			s <<= 1;
+		_table.store(new table_t(s), sys::RELEASE);
+	}
+	ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+	ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+	~ConcurrentHashMap(void) { release(); }
+
+	inline Option<T> get(const K& key) const
+		{ Section r(*this); const node_t *n = find(key, hash(key)); if(n == nullptr) return none; else return n->val; }
+	inline T get(const K& key, const T& def) const
+		{ Section r(*this); const node_t *n = find(key, hash(key)); return n == nullptr ? def : n->val; }
+	inline bool hasKey(const K& key) const { Section r(*this); return find(key, hash(key)) != nullptr; }
+
+	int count(void) const {
+		int c = 0;
+		for(int i = 0; i < STRIPES; i++)
+			c += _stripes[i].count.load(sys::RELAXED);
+		return c;
+	}
+	inline bool isEmpty(void) const { return count() == 0; }
+	inline operator bool(void) const { return !isEmpty(); }
+	inline int capacity(void) const { Section r(*this); return _table.load(sys::ACQUIRE)->size; }
+
+	void put(const K& key, const T& val) {
+		hash_t h = hash(key);
+		node_t *n = new node_t(key, h, val);
+		{
+			Section r(*this);
+			table_t *t;
+			{
+				stripe_t& s = stripe(h);
+				sys::Guard<sys::Mutex> g(s.lock);
+				t = locate(h);
+				link_t *l = lookup(t, key, h);
+				if(l != nullptr) {
+					node_t *o = l->load(sys::RELAXED);
+					n->next.store(o->next.load(sys::RELAXED), sys::RELAXED);
+					l->store(n, sys::RELEASE);
+					retire(o);
+				}
+				else {
+					insert(t, n);
+					s.count.store(s.count.load(sys::RELAXED) + 1, sys::RELAXED);
+				}
+			}
+			grow(t, h);
+		}
+		collect();
+	}
+
+	bool remove(const K& key) {
+		hash_t h = hash(key);
+		{
+			Section r(*this);
+			stripe_t& s = stripe(h);
+			sys::Guard<sys::Mutex> g(s.lock);
+			link_t *l = lookup(locate(h), key, h);
+			if(l == nullptr)
+				return false;
+			unlink(l);
+			s.count.store(s.count.load(sys::RELAXED) - 1, sys::RELAXED);
+		}
+		collect();
+		return true;
+	}
+
+	template <class F>
+	inline T getOrCompute(const K& key, F f) { T v = compute(key, f); collect(); return v; }
+
+	template <class F>
+	void forEach(F f) const {
+		Section r(*this);
+		table_t *t = _table.load(sys::ACQUIRE);
+		for(int i = 0; i < t->size; i++)
+			visit(t, i, f);
+	}
+
+	void clear(void) {
+		release();
+		for(int i = 0; i < STRIPES; i++)
+			_stripes[i].count.store(0, sys::RELAXED);
+		_retired.store(nullptr, sys::RELAXED);
+		_garbage.store(0, sys::RELAXED);
+		_dead = nullptr;
+		_limbo = nullptr;
+		_ltables = nullptr;
+		_table.store(new table_t(STRIPES), sys::RELEASE);
+	}
+
+private:
+	static const t::uint32
+		PENDING = 0,
+		WAITED = 1,
+		READY = 2,
+		FAILED = 3;
+
+	typedef struct node_t {
+		inline node_t(const K& k, hash_t h)
+			: key(k), hash(h), src(nullptr), owns(false), kept(false), state(PENDING), next(nullptr), rnext(nullptr) { }
+		inline node_t(const K& k, hash_t h, const T& v)
+			: key(k), hash(h), val(v), src(nullptr), owns(false), kept(false), state(READY), next(nullptr), rnext(nullptr) { }
+		inline node_t(const K& k, hash_t h, node_t *s)
+			: key(k), hash(h), src(s), owns(true), kept(false), state(READY), next(nullptr), rnext(nullptr) { }
+		K key;
+		hash_t hash;
+		T val;
+		node_t *src;		// pending node this one forwards to
+		bool owns, kept;	// src freed with this node, freed by its forwarder
+		sys::Futex::word_t state;
+		sys::Atomic<node_t *> next;
+		node_t *rnext;
+	} node_t;
+	typedef sys::Atomic<node_t *> link_t;
+
+	typedef struct table_t {
+		inline table_t(int s): size(s), mask(s - 1), buckets(new link_t[s]), next(nullptr), claimed(0), moved(0), old(nullptr) { }
+		inline ~table_t(void) { delete [] buckets; }
+		int size;
+		hash_t mask;
+		link_t *buckets;
+		sys::Atomic<table_t *> next;
+		sys::Atomic<int> claimed, moved;
+		table_t *old;
+	} table_t;
+
+	typedef struct stripe_t {
+		sys::Mutex lock;
+		sys::Atomic<int> count;
+		char pad[CACHE_LINE - sizeof(sys::Mutex) - sizeof(sys::Atomic<int>)];
+	} stripe_t;
+
+	// counters of the threads reading in each epoch parity
+	typedef struct readers_t {
+		sys::Atomic<int> count[2];
+		char pad[CACHE_LINE - 2 * sizeof(sys::Atomic<int>)];
+	} readers_t;
+
+	// read-side critical section: the nodes and tables retired meanwhile are not freed
+	class Section {
+	public:
+		Section(const ConcurrentHashMap& map) {
+			readers_t& r = map._readers[slot()];
+			while(true) {
+				t::uint32 e = map._epoch.load(sys::SEQ_CST);
+				_c = &r.count[e & 1];
+				_c->fetchAdd(1, sys::SEQ_CST);
+				if(map._epoch.load(sys::SEQ_CST) == e)
+					break;
+				_c->fetchAdd(-1, sys::RELEASE);
+			}
+		}
+		inline ~Section(void) { _c->fetchAdd(-1, sys::RELEASE); }
+	private:
+		static inline int slot(void) {
+			static sys::Atomic<int> next(0);
+			static thread_local int s = next.fetchAdd(1, sys::RELAXED) % READERS;
+			return s;
+		}
+		sys::Atomic<int> *_c;
+	};
+
+	static inline node_t *moved(void) { return reinterpret_cast<node_t *>(&_moved); }
+	static inline const node_t *resolve(const node_t *n) { return n->src == nullptr ? n : n->src; }
+	static inline node_t *resolve(node_t *n) { return n->src == nullptr ? n : n->src; }
+	inline stripe_t& stripe(hash_t h) { return _stripes[h & (STRIPES - 1)]; }
+
+	inline hash_t hash(const K& key) const {
+		hash_t h = _h.computeHash(key);
+		h ^= h >> 16;
+		h *= 0x45d9f3b;
+		h ^= h >> 16;
+		return h;
+	}
+
+	node_t *lookup(const K& key, hash_t h) const {
+		table_t *t = _table.load(sys::ACQUIRE);
+		while(true) {
+			node_t *n = t->buckets[h & t->mask].load(sys::ACQUIRE);
+			if(n == moved()) {
+				t = t->next.load(sys::ACQUIRE);
+				continue;
+			}
+			for(; n != nullptr; n = n->next.load(sys::ACQUIRE))
+				if(n->hash == h && _h.isEqual(n->key, key))
+					return resolve(n);
+			return nullptr;
+		}
+	}
+
+	inline const node_t *find(const K& key, hash_t h) const {
+		const node_t *n = lookup(key, h);
+		if(n != nullptr && n->state.load(sys::ACQUIRE) != READY)
+			n = nullptr;
+		return n;
+	}
+
+	// the stripe lock of h must be held
+	table_t *locate(hash_t h) const {
+		table_t *t = _table.load(sys::ACQUIRE);
+		while(t->buckets[h & t->mask].load(sys::RELAXED) == moved())
+			t = t->next.load(sys::ACQUIRE);
+		return t;
+	}
+
+	// the stripe lock of h must be held
+	link_t *lookup(table_t *t, const K& key, hash_t h) const {
+		link_t *l = &t->buckets[h & t->mask];
+		for(node_t *n = l->load(sys::RELAXED); n != nullptr; l = &n->next, n = l->load(sys::RELAXED))
+			if(n->hash == h && _h.isEqual(n->key, key))
+				return l;
+		return nullptr;
+	}
+
+	inline void insert(table_t *t, node_t *n) {
+		link_t& b = t->buckets[n->hash & t->mask];
+		n->next.store(b.load(sys::RELAXED), sys::RELAXED);
+		b.store(n, sys::RELEASE);
+	}
+
+	inline void unlink(link_t *l) {
+		node_t *n = l->load(sys::RELAXED);
+		l->store(n->next.load(sys::RELAXED), sys::RELEASE);
+		retire(n);
+	}
+
+	void retire(node_t *n) {
+		node_t *r = _retired.load(sys::RELAXED);
+		do
+			n->rnext = r;
+		while(!_retired.compareExchangeWeak(r, n, sys::RELEASE));
+		_garbage.fetchAdd(1, sys::RELAXED);
+	}
+
+	static void dispose(node_t *n) {
+		if(n->owns)
+			delete n->src;
+		delete n;
+	}
+
+	static void dispose(node_t *n, table_t *t) {
+		while(n != nullptr) {
+			node_t *m = n->rnext;
+			dispose(n);
+			n = m;
+		}
+		while(t != nullptr) {
+			table_t *o = t->old;
+			delete t;
+			t = o;
+		}
+	}
+
+	// free the retired nodes and tables once no reader can access them
+	inline void collect(void) {
+		if(_garbage.load(sys::RELAXED) >= RECLAIM)
+			reclaim();
+	}
+
+	void reclaim(void) {
+		if(!_reclaim.tryLock())
+			return;
+
+		// free the previous batch when its readers are gone
+		if((_limbo != nullptr || _ltables != nullptr) && drained()) {
+			dispose(_limbo, _ltables);
+			_limbo = nullptr;
+			_ltables = nullptr;
+		}
+
+		// start a new batch by changing the epoch
+		if(_limbo == nullptr && _ltables == nullptr) {
+			{
+				sys::Guard<sys::Mutex> g(_resize);
+				_ltables = _dead;
+				_dead = nullptr;
+			}
+			_limbo = _retired.exchange(nullptr, sys::ACQ_REL);
+			_garbage.store(0, sys::RELAXED);
+			_lpar = _epoch.fetchAdd(1, sys::SEQ_CST) & 1;
+			if(drained()) {
+				dispose(_limbo, _ltables);
+				_limbo = nullptr;
+				_ltables = nullptr;
+			}
+		}
+		_reclaim.unlock();
+	}
+
+	bool drained(void) const {
+		for(int i = 0; i < READERS; i++)
+			if(_readers[i].count[_lpar].load(sys::SEQ_CST) != 0)
+				return false;
+		return true;
+	}
+
+	// visit once the pairs whose hash falls in bucket i of t
+	template <class F>
+	void visit(table_t *t, int i, F& f) const {
+		node_t *n = t->buckets[i].load(sys::ACQUIRE);
+		if(n == moved()) {
+			table_t *nt = t->next.load(sys::ACQUIRE);
+			visit(nt, i, f);
+			visit(nt, i + t->size, f);
+			return;
+		}
+		for(; n != nullptr; n = n->next.load(sys::ACQUIRE)) {
+			const node_t *r = resolve(n);
+			if(r->state.load(sys::ACQUIRE) == READY)
+				f(n->key, r->val);
+		}
+	}
+
+	template <class F>
+	T compute(const K& key, F& f) {
+		hash_t h = hash(key);
+		Section r(*this);
+		while(true) {
+
+			// already there or being computed?
+			node_t *n = lookup(key, h);
+			if(n != nullptr) {
+				if(wait(n))
+					return n->val;
+				continue;
+			}
+
+			// install a pending node
+			node_t *p = new node_t(key, h);
+			table_t *t;
+			{
+				stripe_t& s = stripe(h);
+				sys::Guard<sys::Mutex> g(s.lock);
+				t = locate(h);
+				link_t *l = lookup(t, key, h);
+				if(l != nullptr)
+					n = resolve(l->load(sys::RELAXED));
+				else {
+					insert(t, p);
+					s.count.store(s.count.load(sys::RELAXED) + 1, sys::RELAXED);
+				}
+			}
+			if(n != nullptr) {
+				delete p;
+				if(wait(n))
+					return n->val;
+				continue;
+			}
+
+			// compute the value
+			try {
+				p->val = f(key);
+			}
+			catch(...) {
+				fail(p);
+				throw;
+			}
+			if(p->state.exchange(READY, sys::RELEASE) == WAITED)
+				sys::Futex::wakeAll(p->state);
+			grow(t, h);
+			return p->val;
+		}
+	}
+
+	bool wait(node_t *n) {
+		t::uint32 s = n->state.load(sys::ACQUIRE);
+		while(s == PENDING || s == WAITED) {
+			if(s == PENDING && !n->state.compareExchange(s, WAITED, sys::ACQUIRE))
+				continue;
+			sys::Futex::wait(n->state, WAITED);
+			s = n->state.load(sys::ACQUIRE);
+		}
+		return s == READY;
+	}
+
+	void fail(node_t *p) {
+		{
+			stripe_t& s = stripe(p->hash);
+			sys::Guard<sys::Mutex> g(s.lock);
+			link_t *l = lookup(locate(p->hash), p->key, p->hash);
+			if(l != nullptr && resolve(l->load(sys::RELAXED)) == p) {
+				unlink(l);
+				s.count.store(s.count.load(sys::RELAXED) - 1, sys::RELAXED);
+			}
+		}
+		if(p->state.exchange(FAILED, sys::RELEASE) == WAITED)
+			sys::Futex::wakeAll(p->state);
+	}
+
+	void grow(table_t *t, hash_t h) {
+		if(t->next.load(sys::ACQUIRE) == nullptr
+		&& stripe(h).count.load(sys::RELAXED) * STRIPES > t->size * 3 / 4) {
+			sys::Guard<sys::Mutex> g(_resize);
+			if(t->next.load(sys::RELAXED) == nullptr)
+				t->next.store(new table_t(t->size * 2), sys::RELEASE);
+		}
+		help();
+	}
+
+	void help(void) {
+		table_t *t = _table.load(sys::ACQUIRE);
+		table_t *n = t->next.load(sys::ACQUIRE);
+		if(n == nullptr)
+			return;
+		int i = t->claimed.fetchAdd(CHUNK, sys::RELAXED);
+		if(i >= t->size)
+			return;
+		int e = i + CHUNK < t->size ? i + CHUNK : t->size;
+		for(int j = i; j < e; j++)
+			migrate(t, n, j);
+		if(t->moved.fetchAdd(e - i, sys::ACQ_REL) + e - i == t->size) {
+			sys::Guard<sys::Mutex> g(_resize);
+			_table.store(n, sys::RELEASE);
+			t->old = _dead;
+			_dead = t;
+			_garbage.fetchAdd(t->size, sys::RELAXED);
+		}
+	}
+
+	void migrate(table_t *t, table_t *n, int i) {
+		sys::Guard<sys::Mutex> g(_stripes[i & (STRIPES - 1)].lock);
+		link_t& b = t->buckets[i];
+		for(node_t *p = b.load(sys::RELAXED); p != nullptr; p = p->next.load(sys::RELAXED)) {
+			node_t *o = resolve(p), *c;
+			if(o->state.load(sys::ACQUIRE) == READY)
+				c = new node_t(p->key, p->hash, o->val);
+			else {
+				// the new forwarder becomes the owner of the pending node
+				c = new node_t(p->key, p->hash, o);
+				if(p == o)
+					p->kept = true;
+				else
+					p->owns = false;
+			}
+			insert(n, c);
+		}
+		node_t *p = b.exchange(moved(), sys::RELEASE);
+		while(p != nullptr) {
+			node_t *q = p->next.load(sys::RELAXED);
+			if(!p->kept)
+				retire(p);
+			p = q;
+		}
+	}
+
+	void release(void) {
+		for(table_t *t = _table.load(sys::RELAXED); t != nullptr; ) {
+			for(int i = 0; i < t->size; i++) {
+				node_t *n = t->buckets[i].load(sys::RELAXED);
+				if(n == moved())
+					continue;
+				while(n != nullptr) {
+					node_t *m = n->next.load(sys::RELAXED);
+					dispose(n);
+					n = m;
+				}
+			}
+			table_t *nt = t->next.load(sys::RELAXED);
+			delete t;
+			t = nt;
+		}
+		dispose(_retired.load(sys::RELAXED), _dead);
+		dispose(_limbo, _ltables);
+	}
+
+	H _h;
+	sys::Atomic<table_t *> _table;
+	sys::Atomic<node_t *> _retired;
+	sys::Atomic<int> _garbage;
+	table_t *_dead;
+	sys::Mutex _resize;
+	char _pad[CACHE_LINE];
+	stripe_t _stripes[STRIPES];
+	mutable readers_t _readers[READERS];
+	sys::Atomic<t::uint32> _epoch;
+	sys::Mutex _reclaim;
+	node_t *_limbo;
+	table_t *_ltables;
+	int _lpar;
+	static char _moved;
+};
+
+template <class K, class T, class H>
+char ConcurrentHashMap<K, T, H>::_moved;
+
+} }	// elm::concur
+
+#endif /* ELM_CONCUR_CONCURRENTHASHMAP_H_ */
@@ -0,0 +1,116 @@
+/*
+ *	concur::MPMCQueue class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_CONCUR_MPMCQUEUE_H_
+#define ELM_CONCUR_MPMCQUEUE_H_
+
+#include <atomic>
+#include <elm/assert.h>
+#include <elm/concur/Waiter.h>
+
+namespace elm { namespace concur {
+
+template <class T>
+class MPMCQueue {
+public:
+	typedef T t;
+	typedef elm::t::size index_t;
+	typedef elm::t::int64 offset_t;
+
+	MPMCQueue(int capacity = 1024): _hd(0), _tl(0) {
+		ASSERTP(capacity > 0, "capacity must be positive");
+		_cap = 2;
+		while(_cap < index_t(capacity))
+			_cap <<= 1;
+		_mask = _cap - 1;
+		_buf = new cell_t[_cap];
+		for(index_t i = 0; i < _cap; i++)
+			_buf[i].seq.store(i, std::memory_order_relaxed);
+	}
+	MPMCQueue(const MPMCQueue&) = delete;
+	MPMCQueue& operator=(const MPMCQueue&) = delete;
+	~MPMCQueue(void) { delete [] _buf; }
+
+	inline int capacity(void) const { return _cap; }
+	inline int size(void) const {
+		offset_t s = offset_t(_tl.load(std::memory_order_acquire) - _hd.load(std::memory_order_acquire));
+		return s < 0 ? 0 : int(s);
+	}
+	inline bool isEmpty(void) const { return size() == 0; }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	bool put(const T& x) {
+		cell_t *cell;
+		index_t pos = _tl.load(std::memory_order_relaxed);
+		while(true) {
+			cell = &_buf[pos & _mask];
+			offset_t d = offset_t(cell->seq.load(std::memory_order_acquire)) - offset_t(pos);
+			if(d == 0) {
+				if(_tl.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if(d < 0)
+				return false;
+			else
+				pos = _tl.load(std::memory_order_relaxed);
+		}
+		cell->data = x;
+		cell->seq.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool get(T& x) {
+		cell_t *cell;
+		index_t pos = _hd.load(std::memory_order_relaxed);
+		while(true) {
+			cell = &_buf[pos & _mask];
+			offset_t d = offset_t(cell->seq.load(std::memory_order_acquire)) - offset_t(pos + 1);
+			if(d == 0) {
+				if(_hd.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if(d < 0)
+				return false;
+			else
+				pos = _hd.load(std::memory_order_relaxed);
+		}
+		x = cell->data;
+		cell->seq.store(pos + _cap, std::memory_order_release);
+		return true;
+	}
+
+private:
+	typedef struct cell_t {
+		std::atomic<index_t> seq;
+		T data;
+	} cell_t;
+
+	cell_t *_buf;
+	index_t _cap, _mask;
+	char _pad0[CACHE_LINE];
+	std::atomic<index_t> _hd;
+	char _pad1[CACHE_LINE];
+	std::atomic<index_t> _tl;
+	char _pad2[CACHE_LINE];
+};
+
+} }	// elm::concur
+
+#endif /* ELM_CONCUR_MPMCQUEUE_H_ */
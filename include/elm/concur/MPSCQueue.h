@@ -0,0 +1,80 @@
+/*
+ *	concur::MPSCQueue class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_CONCUR_MPSCQUEUE_H_
+#define ELM_CONCUR_MPSCQUEUE_H_
+
+#include <atomic>
+#include <elm/concur/Waiter.h>
+
+namespace elm { namespace concur {
+
+template <class T>
+class MPSCQueue {
+public:
+	typedef T t;
+
+	MPSCQueue(void): _tl(new node_t()) { _hd.store(_tl, std::memory_order_relaxed); }
+	MPSCQueue(const MPSCQueue&) = delete;
+	MPSCQueue& operator=(const MPSCQueue&) = delete;
+	~MPSCQueue(void) {
+		while(_tl != nullptr) {
+			node_t *n = _tl->next.load(std::memory_order_relaxed);
+			delete _tl;
+			_tl = n;
+		}
+	}
+
+	inline bool isEmpty(void) const { return _tl->next.load(std::memory_order_acquire) == nullptr; }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	inline bool put(const T& x) {
+		node_t *n = new node_t(x);
+		node_t *p = _hd.exchange(n, std::memory_order_acq_rel);
+		p->next.store(n, std::memory_order_release);
+		return true;
+	}
+
+	inline bool get(T& x) {
+		node_t *n = _tl->next.load(std::memory_order_acquire);
+		if(n == nullptr)
+			return false;
+		x = n->data;
+		delete _tl;
+		_tl = n;
+		return true;
+	}
+
+private:
+	typedef struct node_t {
+		inline node_t(void): next(nullptr) { }
+		inline node_t(const T& x): next(nullptr), data(x) { }
+		std::atomic<node_t *> next;
+		T data;
+	} node_t;
+
+	std::atomic<node_t *> _hd;
+	char _pad[CACHE_LINE];
+	node_t *_tl;
+};
+
+} }	// elm::concur
+
+#endif /* ELM_CONCUR_MPSCQUEUE_H_ */
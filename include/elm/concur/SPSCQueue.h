@@ -0,0 +1,93 @@
+/*
+ *	concur::SPSCQueue class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_CONCUR_SPSCQUEUE_H_
+#define ELM_CONCUR_SPSCQUEUE_H_
+
+#include <atomic>
+#include <elm/assert.h>
+#include <elm/concur/Waiter.h>
+
+namespace elm { namespace concur {
+
+template <class T>
+class SPSCQueue {
+public:
+	typedef T t;
+	typedef elm::t::size index_t;
+
+	SPSCQueue(int capacity = 1024): _hd(0), _tl_cache(0), _tl(0), _hd_cache(0) {
+		ASSERTP(capacity > 0, "capacity must be positive");
+		_cap = 1;
+		while(_cap < index_t(capacity))
+			_cap <<= 1;
+		_mask = _cap - 1;
+		_buf = new T[_cap];
+	}
+	SPSCQueue(const SPSCQueue&) = delete;
+	SPSCQueue& operator=(const SPSCQueue&) = delete;
+	~SPSCQueue(void) { delete [] _buf; }
+
+	inline int capacity(void) const { return _cap; }
+	inline int size(void) const
+		{ return int(_tl.load(std::memory_order_acquire) - _hd.load(std::memory_order_acquire)); }
+	inline bool isEmpty(void) const
+		{ return _hd.load(std::memory_order_acquire) == _tl.load(std::memory_order_acquire); }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	inline bool put(const T& x) {
+		index_t tl = _tl.load(std::memory_order_relaxed);
+		if(tl - _hd_cache == _cap) {
+			_hd_cache = _hd.load(std::memory_order_acquire);
+			if(tl - _hd_cache == _cap)
+				return false;
+		}
+		_buf[tl & _mask] = x;
+		_tl.store(tl + 1, std::memory_order_release);
+		return true;
+	}
+
+	inline bool get(T& x) {
+		index_t hd = _hd.load(std::memory_order_relaxed);
+		if(hd == _tl_cache) {
+			_tl_cache = _tl.load(std::memory_order_acquire);
+			if(hd == _tl_cache)
+				return false;
+		}
+		x = _buf[hd & _mask];
+		_hd.store(hd + 1, std::memory_order_release);
+		return true;
+	}
+
+private:
+	T *_buf;
+	index_t _cap, _mask;
+	char _pad0[CACHE_LINE];
+	std::atomic<index_t> _hd;
+	index_t _tl_cache;
+	char _pad1[CACHE_LINE];
+	std::atomic<index_t> _tl;
+	index_t _hd_cache;
+	char _pad2[CACHE_LINE];
+};
+
+} }	// elm::concur
+
+#endif /* ELM_CONCUR_SPSCQUEUE_H_ */
@@ -0,0 +1,259 @@
+/*
+ *	ShardedCache class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_CONCUR_SHARDEDCACHE_H_
+#define ELM_CONCUR_SHARDEDCACHE_H_
+
+#include <utility>
+#include <elm/data/Cache.h>
+#include <elm/concur/Waiter.h>
+#include <elm/sys/Atomic.h>
+#include <elm/sys/Mutex.h>
+
+namespace elm { namespace concur {
+
+template <class K, class V, class H = HashKey<K> >
+class ShardedCache {
+	typedef struct block_t {
+		inline block_t(Cleaner *c): cleaner(c), refs(1), clean(false) { }
+		Cleaner *cleaner;
+		sys::Atomic<int> refs;
+		bool clean;
+	} block_t;
+
+	typedef struct entry_t {
+		inline entry_t(void): blk(nullptr) { }
+		inline entry_t(const V& v, block_t *b): val(v), blk(b) { }
+		template <class X = V>
+		inline auto operator==(const entry_t& e) const -> decltype(bool(std::declval<const X&>() == std::declval<const X&>()))
+			{ return val == e.val; }
+		V val;
+		block_t *blk;
+	} entry_t;
+
+	typedef Cache<K, entry_t, H> shard_cache_t;
+
+public:
+	typedef K key_t;
+	typedef V val_t;
+	typedef Cache<K, V, H> cache_t;
+	typedef typename cache_t::policy_t policy_t;
+	typedef typename cache_t::cost_t cost_t;
+	typedef typename cache_t::cleaner_t cleaner_t;
+	static const int SHARDS = 16;
+
+	// pinned value
+	class Ref {
+		friend class ShardedCache;
+	public:
+		inline Ref(void): _b(nullptr), _some(false) { }
+		inline Ref(const Ref& r): _v(r._v), _b(r._b), _some(r._some) { if(_b != nullptr) _b->refs.fetchAdd(1, sys::RELAXED); }
+		inline ~Ref(void) { unref(_b); }
+		Ref& operator=(const Ref& r) {
+			if(r._b != nullptr)
+				r._b->refs.fetchAdd(1, sys::RELAXED);
+			unref(_b);
+			_v = r._v;
+			_b = r._b;
+			_some = r._some;
+			return *this;
+		}
+		inline bool isEmpty(void) const { return !_some; }
+		inline operator bool(void) const { return _some; }
+		inline const V& operator*(void) const { ASSERTP(_some, "empty reference"); return _v; }
+		inline const V *operator->(void) const { ASSERTP(_some, "empty reference"); return &_v; }
+	private:
+		inline Ref(const entry_t& e): _v(e.val), _b(e.blk), _some(true) { if(_b != nullptr) _b->refs.fetchAdd(1, sys::RELAXED); }
+		V _v;
+		block_t *_b;
+		bool _some;
+	};
+
+	ShardedCache(t::size budget, policy_t policy = cache_t::LRU, int shards = SHARDS, int size = 211): _cnt(shards) {
+		ASSERTP(shards > 0, "shard count must be positive");
+		_shards = new shard_t[_cnt];
+		for(int i = 0; i < _cnt; i++)
+			_shards[i].cache = new shard_cache_t(share(budget, i), typename shard_cache_t::policy_t(policy), size);
+	}
+	ShardedCache(const ShardedCache&) = delete;
+	ShardedCache& operator=(const ShardedCache&) = delete;
+	~ShardedCache(void) {
+		for(int i = 0; i < _cnt; i++)
+			delete _shards[i].cache;
+		delete [] _shards;
+	}
+
+	inline int shards(void) const { return _cnt; }
+
+	void setCost(cost_t cost) {
+		for(int i = 0; i < _cnt; i++) {
+			sys::Guard<sys::Mutex> g(_shards[i].lock);
+			_shards[i].cache->setCost([cost](const K& k, const entry_t& e) { return cost(k, e.val); });
+		}
+	}
+	inline void setCleaner(cleaner_t cleaner) { _cleaner = cleaner; }
+	void setBudget(t::size budget)
+		{ for(int i = 0; i < _cnt; i++) { sys::Guard<sys::Mutex> g(_shards[i].lock); _shards[i].cache->setBudget(share(budget, i)); } }
+
+	inline t::size budget(void) const { return sum([](const shard_cache_t& c) { return c.budget(); }); }
+	inline t::size used(void) const { return sum([](const shard_cache_t& c) { return c.used(); }); }
+	inline int count(void) const { return int(sum([](const shard_cache_t& c) { return t::uint64(c.count()); })); }
+	inline bool isEmpty(void) const { return count() == 0; }
+	inline operator bool(void) const { return !isEmpty(); }
+	inline t::uint64 hits(void) const { return sum([](const shard_cache_t& c) { return c.hits(); }); }
+	inline t::uint64 misses(void) const { return sum([](const shard_cache_t& c) { return c.misses(); }); }
+	inline t::uint64 evictions(void) const { return sum([](const shard_cache_t& c) { return c.evictions(); }); }
+	void resetStats(void)
+		{ for(int i = 0; i < _cnt; i++) { sys::Guard<sys::Mutex> g(_shards[i].lock); _shards[i].cache->resetStats(); } }
+
+	inline bool hasKey(const K& key) const
+		{ shard_t& s = shard(key); sys::Guard<sys::Mutex> g(s.lock); return s.cache->hasKey(key); }
+	inline Option<V> get(const K& key)
+		{ Ref r = pin(key); if(r) return *r; else return none; }
+	void put(const K& key, const V& val, Cleaner *cleaner = nullptr) {
+		if(cleaner == nullptr && _cleaner)
+			cleaner = _cleaner(key, val);
+		shard_t& s = shard(key);
+		sys::Guard<sys::Mutex> g(s.lock);
+		Option<entry_t> o = s.cache->peek(key);
+		if(o.some() && (*o).blk != nullptr && same((*o).val, val, 0)) {
+			// same value possibly pinned: keep its block and only swap the cleaner
+			block_t *b = (*o).blk;
+			delete b->cleaner;
+			b->cleaner = cleaner;
+			b->refs.fetchAdd(1, sys::RELAXED);
+			s.cache->put(key, *o, ticket(*o));
+		}
+		else {
+			entry_t e(val, cleaner == nullptr ? nullptr : new block_t(cleaner));
+			s.cache->put(key, e, ticket(e));
+		}
+	}
+	inline bool remove(const K& key)
+		{ shard_t& s = shard(key); sys::Guard<sys::Mutex> g(s.lock); return s.cache->remove(key); }
+	void clear(void)
+		{ for(int i = 0; i < _cnt; i++) { sys::Guard<sys::Mutex> g(_shards[i].lock); _shards[i].cache->clear(); } }
+
+	template <class F>
+	inline V getOrCompute(const K& key, F f) { return *pinOrCompute(key, f); }
+
+	Ref pin(const K& key) {
+		shard_t& s = shard(key);
+		sys::Guard<sys::Mutex> g(s.lock);
+		Option<entry_t> e = s.cache->get(key);
+		if(e.some())
+			return Ref(*e);
+		else
+			return Ref();
+	}
+
+	template <class F>
+	Ref pinOrCompute(const K& key, F f) {
+		shard_t& s = shard(key);
+		{
+			sys::Guard<sys::Mutex> g(s.lock);
+			Option<entry_t> e = s.cache->get(key);
+			if(e.some())
+				return Ref(*e);
+		}
+		V v = f(key);
+		Cleaner *c = _cleaner ? _cleaner(key, v) : nullptr;
+		Ref r;
+		{
+			sys::Guard<sys::Mutex> g(s.lock);
+			if(!s.cache->hasKey(key)) {
+				entry_t e(v, c == nullptr ? nullptr : new block_t(c));
+				r = Ref(e);
+				s.cache->put(key, e, ticket(e));
+				return r;
+			}
+			r = Ref(*s.cache->get(key));
+		}
+		if(c != nullptr) {
+			c->clean();
+			delete c;
+		}
+		return r;
+	}
+
+private:
+
+	// cleaner of a cache entry: the actual cleaner is called when the entry
+	// is evicted and the last reference is released
+	class Ticket: public Cleaner {
+	public:
+		inline Ticket(block_t *b): _b(b) { }
+		~Ticket(void) { unref(_b); }
+		void clean(void) override { _b->clean = true; }
+	private:
+		block_t *_b;
+	};
+
+	static inline Cleaner *ticket(const entry_t& e) { return e.blk == nullptr ? nullptr : new Ticket(e.blk); }
+
+	template <class X> static inline auto same(const X& x, const X& y, int) -> decltype(bool(x == y)) { return x == y; }
+	template <class X> static inline bool same(const X& x, const X& y, long) { return false; }
+
+	static void unref(block_t *b) {
+		if(b != nullptr && b->refs.fetchAdd(-1, sys::ACQ_REL) == 1) {
+			if(b->clean && b->cleaner != nullptr)
+				b->cleaner->clean();
+			delete b->cleaner;
+			delete b;
+		}
+	}
+
+	typedef struct shard_t {
+		sys::Mutex lock;
+		shard_cache_t *cache;
+		char pad[CACHE_LINE - sizeof(sys::Mutex) - sizeof(shard_cache_t *)];
+	} shard_t;
+
+	inline t::size share(t::size budget, int i) const {
+		t::size b = budget / _cnt + (t::size(i) < budget % _cnt ? 1 : 0);
+		return b == 0 ? 1 : b;
+	}
+
+	inline shard_t& shard(const K& key) const {
+		t::hash h = H::hash(key);
+		h ^= h >> 16;
+		h *= 0x45d9f3b;
+		h ^= h >> 16;
+		return _shards[h % _cnt];
+	}
+
+	template <class F>
+	t::uint64 sum(F f) const {
+		t::uint64 r = 0;
+		for(int i = 0; i < _cnt; i++) {
+			sys::Guard<sys::Mutex> g(_shards[i].lock);
+			r += f(*_shards[i].cache);
+		}
+		return r;
+	}
+
+	int _cnt;
+	shard_t *_shards;
+	cleaner_t _cleaner;
+};
+
+} }	// elm::concur
+
+#endif /* ELM_CONCUR_SHARDEDCACHE_H_ */
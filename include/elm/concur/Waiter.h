@@ -0,0 +1,53 @@
+/*
+ *	concur::Waiter class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_CONCUR_WAITER_H_
+#define ELM_CONCUR_WAITER_H_
+
+#include <elm/sys/Futex.h>
+
+namespace elm { namespace concur {
+
+static const int CACHE_LINE = 64;
+
+class Waiter {
+public:
+	typedef t::uint32 key_t;
+
+	inline Waiter(void): _seq(0), _waiters(0) { }
+
+	inline key_t prepare(void) { _waiters.fetchAdd(1); return _seq.load(); }
+	inline void cancel(void) { _waiters.fetchSub(1, sys::RELAXED); }
+	void wait(key_t key);
+
+	inline void notify(void)
+		{ sys::fence(); if(_waiters.load(sys::RELAXED) != 0) wake(false); }
+	inline void notifyAll(void)
+		{ sys::fence(); if(_waiters.load(sys::RELAXED) != 0) wake(true); }
+
+private:
+	void wake(bool all);
+	sys::Futex::word_t _seq;
+	sys::Atomic<int> _waiters;
+};
+
+} }	// elm::concur
+
+#endif /* ELM_CONCUR_WAITER_H_ */
@@ -0,0 +1,233 @@
+/*
+ *	Cache class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_CACHE_H_
+#define ELM_DATA_CACHE_H_
+
+#include <functional>
+#include <elm/data/HashMap.h>
+#include <elm/util/Cleaner.h>
+
+namespace elm {
+
+template <class K, class V, class H = HashKey<K> >
+class Cache {
+public:
+	typedef K key_t;
+	typedef V val_t;
+	typedef std::function<t::size(const K& key, const V& val)> cost_t;
+	typedef std::function<Cleaner *(const K& key, const V& val)> cleaner_t;
+	static const int WINDOW = 8;
+
+	typedef enum {
+		LRU = 0,
+		CLOCK = 1,
+		SIZE = 2
+	} policy_t;
+
+	Cache(t::size budget, policy_t policy = LRU, int size = 211)
+		: _map(size), _policy(policy), _budget(budget), _used(0), _cost(unit), _hits(0), _misses(0), _evictions(0)
+		{ _list.prev = _list.next = &_list; }
+	Cache(const Cache&) = delete;
+	Cache& operator=(const Cache&) = delete;
+	~Cache(void) { clear(); }
+
+	inline policy_t policy(void) const { return _policy; }
+	inline t::size budget(void) const { return _budget; }
+	inline t::size used(void) const { return _used; }
+	inline void setCost(cost_t cost) { _cost = cost; }
+	inline void setCleaner(cleaner_t cleaner) { _cleaner = cleaner; }
+	inline void setBudget(t::size budget) { _budget = budget; shrink(); }
+
+	inline t::uint64 hits(void) const { return _hits; }
+	inline t::uint64 misses(void) const { return _misses; }
+	inline t::uint64 evictions(void) const { return _evictions; }
+	inline void resetStats(void) { _hits = _misses = _evictions = 0; }
+
+	inline int count(void) const { return _map.count(); }
+	inline bool isEmpty(void) const { return _map.isEmpty(); }
+	inline operator bool(void) const { return !isEmpty(); }
+	inline bool hasKey(const K& key) const { return _map.hasKey(key); }
+	inline Option<V> peek(const K& key) const
+		{ node_t *n = _map.get(key, nullptr); if(n == nullptr) return none; else return n->val; }
+
+	Option<V> get(const K& key) {
+		node_t *n = _map.get(key, nullptr);
+		if(n == nullptr) {
+			_misses++;
+			return none;
+		}
+		_hits++;
+		touch(n);
+		return n->val;
+	}
+
+	template <class F>
+	V getOrCompute(const K& key, F f) {
+		node_t *n = _map.get(key, nullptr);
+		if(n != nullptr) {
+			_hits++;
+			touch(n);
+			return n->val;
+		}
+		_misses++;
+		V v = f(key);
+		add(key, v, _cleaner ? _cleaner(key, v) : nullptr);
+		return v;
+	}
+
+	void put(const K& key, const V& val, Cleaner *cleaner = nullptr) {
+		node_t *n = _map.get(key, nullptr);
+		if(n == nullptr)
+			add(key, val, cleaner != nullptr ? cleaner : _cleaner ? _cleaner(key, val) : nullptr);
+		else {
+			if(same(n->val, val, 0)) {
+				delete n->cleaner;
+				n->cleaner = nullptr;
+			}
+			else
+				clean(n);
+			_used -= n->cost;
+			n->val = val;
+			n->cost = _cost(key, val);
+			n->cleaner = cleaner != nullptr ? cleaner : _cleaner ? _cleaner(key, val) : nullptr;
+			_used += n->cost;
+			touch(n);
+			shrink(n);
+		}
+	}
+
+	bool remove(const K& key) {
+		node_t *n = _map.get(key, nullptr);
+		if(n == nullptr)
+			return false;
+		release(n);
+		return true;
+	}
+
+	void clear(void) {
+		while(_list.next != &_list)
+			release(static_cast<node_t *>(_list.next));
+	}
+
+	static inline t::size unit(const K& key, const V& val) { return 1; }
+
+private:
+	typedef struct link_t {
+		link_t *prev, *next;
+		inline void unlink(void) { prev->next = next; next->prev = prev; }
+		inline void insertAfter(link_t *l) { prev = l; next = l->next; l->next->prev = this; l->next = this; }
+	} link_t;
+
+	typedef struct node_t: public link_t {
+		inline node_t(const K& k, const V& v, t::size c, Cleaner *cl): key(k), val(v), cost(c), cleaner(cl), ref(false) { }
+		K key;
+		V val;
+		t::size cost;
+		Cleaner *cleaner;
+		bool ref;
+	} node_t;
+
+	void add(const K& key, const V& val, Cleaner *cleaner) {
+		node_t *n = new node_t(key, val, _cost(key, val), cleaner);
+		_map.put(key, n);
+		n->insertAfter(&_list);
+		_used += n->cost;
+		shrink(n);
+	}
+
+	inline void touch(node_t *n) {
+		if(_policy == CLOCK)
+			n->ref = true;
+		else if(_list.next != n) {
+			n->unlink();
+			n->insertAfter(&_list);
+		}
+	}
+
+	inline void clean(node_t *n) {
+		if(n->cleaner != nullptr) {
+			n->cleaner->clean();
+			delete n->cleaner;
+			n->cleaner = nullptr;
+		}
+	}
+
+	void release(node_t *n) {
+		_map.remove(n->key);
+		n->unlink();
+		_used -= n->cost;
+		clean(n);
+		delete n;
+	}
+
+	node_t *victim(void) {
+		switch(_policy) {
+
+		case CLOCK:
+			while(true) {
+				node_t *n = static_cast<node_t *>(_list.prev);
+				if(!n->ref)
+					return n;
+				n->ref = false;
+				n->unlink();
+				n->insertAfter(&_list);
+			}
+
+		case SIZE: {
+				node_t *v = static_cast<node_t *>(_list.prev);
+				link_t *l = v->prev;
+				for(int i = 1; i < WINDOW && l != &_list; i++, l = l->prev)
+					if(static_cast<node_t *>(l)->cost > v->cost)
+						v = static_cast<node_t *>(l);
+				return v;
+			}
+
+		default:
+			return static_cast<node_t *>(_list.prev);
+		}
+	}
+
+	void shrink(node_t *keep = nullptr) {
+		if(keep != nullptr)
+			keep->unlink();
+		while(_used > _budget && _list.next != &_list) {
+			release(victim());
+			_evictions++;
+		}
+		if(keep != nullptr)
+			keep->insertAfter(&_list);
+	}
+
+	template <class X> static inline auto same(const X& x, const X& y, int) -> decltype(bool(x == y)) { return x == y; }
+	template <class X> static inline bool same(const X& x, const X& y, long) { return false; }
+
+	HashMap<K, node_t *, H> _map;
+	link_t _list;
+	policy_t _policy;
+	t::size _budget, _used;
+	cost_t _cost;
+	cleaner_t _cleaner;
+	t::uint64 _hits, _misses, _evictions;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_CACHE_H_ */
@@ -0,0 +1,220 @@
+/*
+ *	ColumnTable class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_COLUMNTABLE_H_
+#define ELM_DATA_COLUMNTABLE_H_
+
+#include <new>
+#include <tuple>
+#include <elm/assert.h>
+#include <elm/data/Vector.h>
+#include <elm/sys/Atomic.h>
+#include <elm/sys/JobScheduler.h>
+#include <elm/sys/System.h>
+
+namespace elm {
+
+template <class... C>
+class ColumnTable {
+public:
+	typedef ColumnTable<C...> self_t;
+	static const int COLUMNS = sizeof...(C);
+	static const int ALIGN = 64;
+	template <int I> struct col { typedef typename std::tuple_element<I, std::tuple<C...> >::type t; };
+
+	class Page {
+	public:
+		inline Page(const self_t& table, int index): _t(&table), _i(index) { }
+		inline int index(void) const { return _i; }
+		inline int base(void) const { return _i << _t->_shf; }
+		inline int length(void) const { return _t->pageLength(_i); }
+		template <int I> inline typename col<I>::t *column(void) const
+			{ return const_cast<self_t *>(_t)->template column<I>(_i); }
+	private:
+		const self_t *_t;
+		int _i;
+	};
+
+	ColumnTable(int size_pow = 12): _size(1 << size_pow), _msk(_size - 1), _shf(size_pow), _used(_size) {
+		ASSERTP(size_pow > 0, "size must be greater than 0");
+		const t::size sizes[] = { sizeof(C)... };
+		_off[0] = 0;
+		for(int i = 0; i < COLUMNS; i++)
+			_off[i + 1] = (_off[i] + sizes[i] * _size + ALIGN - 1) & ~t::size(ALIGN - 1);
+	}
+	ColumnTable(const ColumnTable&) = delete;
+	ColumnTable& operator=(const ColumnTable&) = delete;
+	~ColumnTable(void) { clear(); }
+
+	inline int pageSize(void) const { return _size; }
+	inline int pagePower(void) const { return _shf; }
+	inline int pageCount(void) const { return _pages.count(); }
+	inline int pageLength(int p) const { return p == _pages.count() - 1 ? _used : _size; }
+
+	inline int count(void) const { return _pages.isEmpty() ? 0 : ((_pages.count() - 1) << _shf) + _used; }
+	inline int length(void) const { return count(); }
+	inline bool isEmpty(void) const { return _pages.isEmpty(); }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	template <int I> inline const typename col<I>::t& get(int row) const
+		{ ASSERTP(row >= 0 && row < count(), "index out of bounds"); return column<I>(row >> _shf)[row & _msk]; }
+	template <int I> inline typename col<I>::t& get(int row)
+		{ ASSERTP(row >= 0 && row < count(), "index out of bounds"); return column<I>(row >> _shf)[row & _msk]; }
+	template <int I> inline void set(int row, const typename col<I>::t& v) { get<I>(row) = v; }
+
+	template <int I> inline const typename col<I>::t *column(int p) const
+		{ return reinterpret_cast<const typename col<I>::t *>(_pages[p] + _off[I]); }
+	template <int I> inline typename col<I>::t *column(int p)
+		{ return reinterpret_cast<typename col<I>::t *>(_pages[p] + _off[I]); }
+
+	int add(const C&... vals) {
+		if(_used >= _size)
+			grow();
+		int r = count();
+		put<0>(_pages.top(), _used++, vals...);
+		return r;
+	}
+
+	int alloc(int n) {
+		int r = count();
+		while(n > _size - _used) {
+			n -= _size - _used;
+			grow();
+		}
+		_used += n;
+		return r;
+	}
+
+	void shrink(int length) {
+		ASSERTP(length >= 0 && length <= count(), "length too big");
+		int n = (length + _msk) >> _shf;
+		while(_pages.count() > n)
+			release(_pages.pop());
+		_used = length & _msk;
+		if(_used == 0)
+			_used = _size;
+	}
+
+	inline void clear(void) { shrink(0); }
+
+	template <class F> void forEachPage(F f) const {
+		for(int i = 0; i < _pages.count(); i++)
+			f(Page(*this, i));
+	}
+
+	template <int I, class F> void scan(F f) const {
+		for(int i = 0; i < _pages.count(); i++)
+			f(column<I>(i), pageLength(i), i << _shf);
+	}
+
+	template <int I, class P> void select(P pred, Vector<int>& rows) const {
+		for(int i = 0; i < _pages.count(); i++) {
+			const typename col<I>::t *c = column<I>(i);
+			int n = pageLength(i), b = i << _shf;
+			for(int j = 0; j < n; j++)
+				if(pred(c[j]))
+					rows.add(b + j);
+		}
+	}
+
+	template <class F> void forEachPageParallel(F f, int threads = 0) const {
+		if(threads <= 0)
+			threads = sys::System::coreCount();
+		threads = min(threads, _pages.count());
+		if(threads <= 1) {
+			forEachPage(f);
+			return;
+		}
+		Parallel<F> par(*this, f, threads);
+		sys::JobScheduler sched(par);
+		sched.setThreadCount(threads);
+		sched.start();
+	}
+
+private:
+
+	template <class F>
+	class Parallel: public sys::JobProducer {
+	public:
+		Parallel(const self_t& table, F& f, int n): _t(table), _f(f), _i(0), _n(n), _next(0) {
+			_jobs = new Job *[n];
+			for(int i = 0; i < n; i++)
+				_jobs[i] = new Job(*this);
+		}
+		~Parallel(void) {
+			for(int i = 0; i < _n; i++)
+				delete _jobs[i];
+			delete [] _jobs;
+		}
+		sys::Job *next(void) override { return _i < _n ? _jobs[_i++] : nullptr; }
+	private:
+		class Job: public sys::Job {
+		public:
+			Job(Parallel& par): _p(par) { }
+			void run(void) override {
+				int n = _p._t.pageCount();
+				for(int i = _p._next.fetchAdd(1, sys::RELAXED); i < n; i = _p._next.fetchAdd(1, sys::RELAXED))
+					_p._f(Page(_p._t, i));
+			}
+		private:
+			Parallel& _p;
+		};
+		const self_t& _t;
+		F& _f;
+		int _i, _n;
+		sys::Atomic<int> _next;
+		Job **_jobs;
+	};
+
+	template <int I> inline void put(char *p, int k) { }
+	template <int I, class V, class... Vs> inline void put(char *p, int k, const V& v, const Vs&... vs)
+		{ reinterpret_cast<typename col<I>::t *>(p + _off[I])[k] = v; put<I + 1>(p, k, vs...); }
+
+	template <class T> static void construct(char *p, int n)
+		{ for(int i = 0; i < n; i++) new(reinterpret_cast<T *>(p) + i) T(); }
+	template <class T> static void destroy(char *p, int n)
+		{ for(int i = 0; i < n; i++) reinterpret_cast<T *>(p)[i].~T(); }
+
+	void grow(void) {
+		static void (* const cons[])(char *, int) = { &construct<C>... };
+		char *raw = new char[_off[COLUMNS] + ALIGN + sizeof(char *)];
+		char *p = reinterpret_cast<char *>((t::intptr(raw) + sizeof(char *) + ALIGN - 1) & ~t::intptr(ALIGN - 1));
+		reinterpret_cast<char **>(p)[-1] = raw;
+		for(int i = 0; i < COLUMNS; i++)
+			cons[i](p + _off[i], _size);
+		_pages.add(p);
+		_used = 0;
+	}
+
+	void release(char *p) {
+		static void (* const dest[])(char *, int) = { &destroy<C>... };
+		for(int i = 0; i < COLUMNS; i++)
+			dest[i](p + _off[i], _size);
+		delete [] reinterpret_cast<char **>(p)[-1];
+	}
+
+	Vector<char *> _pages;
+	int _size, _msk, _shf, _used;
+	t::size _off[COLUMNS + 1];
+};
+
+}	// elm
+
+#endif /* ELM_DATA_COLUMNTABLE_H_ */
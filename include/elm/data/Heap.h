@@ -0,0 +1,235 @@
+/*
+ *	Heap and IndexedHeap classes interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_HEAP_H_
+#define ELM_DATA_HEAP_H_
+
+#include <elm/assert.h>
+#include <elm/compare.h>
+#include <elm/data/custom.h>
+#include <elm/data/Vector.h>
+
+namespace elm {
+
+// Heap class
+template <class T, class C = Comparator<T>, int D = 4>
+class Heap: public C {
+	static_assert(D >= 2, "heap arity must be at least 2");
+public:
+	typedef T t;
+	static const int ARITY = D;
+
+	inline Heap(const C& c = single<C>(), int cap = 16): C(c), _a(cap) { }
+
+	inline int count(void) const { return _a.count(); }
+	inline bool isEmpty(void) const { return _a.isEmpty(); }
+	inline operator bool(void) const { return !isEmpty(); }
+	inline const T& head(void) const { ASSERTP(!isEmpty(), "empty heap"); return _a[0]; }
+	inline void reset(void) { _a.clear(); }
+	inline void clear(void) { _a.clear(); }
+
+	void put(const T& x) {
+		_a.add(x);
+		up(_a.count() - 1);
+	}
+
+	T get(void) {
+		ASSERTP(!isEmpty(), "empty heap");
+		T r = _a[0];
+		T x = _a.pop();
+		if(!_a.isEmpty()) {
+			_a[0] = x;
+			down(0);
+		}
+		return r;
+	}
+
+	template <class CC> void putAll(const CC& c) {
+		for(const auto& x: c)
+			_a.add(x);
+		for(int i = (_a.count() - 2) / D; i >= 0; i--)
+			down(i);
+	}
+
+private:
+	inline bool less(const T& x, const T& y) const { return C::doCompare(x, y) < 0; }
+
+	void up(int i) {
+		T x = _a[i];
+		while(i > 0) {
+			int p = (i - 1) / D;
+			if(!less(x, _a[p]))
+				break;
+			_a[i] = _a[p];
+			i = p;
+		}
+		_a[i] = x;
+	}
+
+	void down(int i) {
+		int n = _a.count();
+		T x = _a[i];
+		while(true) {
+			int c = D * i + 1;
+			if(c >= n)
+				break;
+			int b = c, e = c + D < n ? c + D : n;
+			for(int j = c + 1; j < e; j++)
+				if(less(_a[j], _a[b]))
+					b = j;
+			if(!less(_a[b], x))
+				break;
+			_a[i] = _a[b];
+			i = b;
+		}
+		_a[i] = x;
+	}
+
+	Vector<T> _a;
+};
+
+
+// IndexedHeap class
+template <class T, class C = Comparator<T>, int D = 4>
+class IndexedHeap: public C {
+	static_assert(D >= 2, "heap arity must be at least 2");
+public:
+	typedef T t;
+	typedef int handle_t;
+	static const int ARITY = D;
+	static const handle_t NONE = -1;
+
+	inline IndexedHeap(const C& c = single<C>(), int cap = 16): C(c), _heap(cap), _pos(cap), _vals(cap) { }
+
+	inline int count(void) const { return _heap.count(); }
+	inline bool isEmpty(void) const { return _heap.isEmpty(); }
+	inline operator bool(void) const { return !isEmpty(); }
+	inline bool contains(handle_t h) const { return h >= 0 && h < _pos.count() && _pos[h] >= 0; }
+	inline const T& at(handle_t h) const { ASSERTP(contains(h), "bad handle"); return _vals[h]; }
+	inline const T& operator[](handle_t h) const { return at(h); }
+	inline const T& head(void) const { ASSERTP(!isEmpty(), "empty heap"); return _vals[_heap[0]]; }
+	inline handle_t headHandle(void) const { ASSERTP(!isEmpty(), "empty heap"); return _heap[0]; }
+
+	void reset(void) {
+		_heap.clear();
+		_free.clear();
+		for(int i = _pos.count() - 1; i >= 0; i--) {
+			_pos[i] = NONE;
+			_free.add(i);
+		}
+	}
+	inline void clear(void) { reset(); }
+
+	handle_t put(const T& x) {
+		handle_t h;
+		if(!_free.isEmpty()) {
+			h = _free.pop();
+			_vals[h] = x;
+		}
+		else {
+			h = _vals.count();
+			_vals.add(x);
+			_pos.add(handle_t(NONE));
+		}
+		_pos[h] = _heap.count();
+		_heap.add(h);
+		up(_pos[h]);
+		return h;
+	}
+
+	T get(void) {
+		ASSERTP(!isEmpty(), "empty heap");
+		handle_t h = _heap[0];
+		removeAt(0);
+		return _vals[h];
+	}
+
+	void decreaseKey(handle_t h, const T& x) {
+		ASSERTP(contains(h), "bad handle");
+		ASSERTP(C::doCompare(x, _vals[h]) <= 0, "key is not decreased");
+		_vals[h] = x;
+		up(_pos[h]);
+	}
+
+	void update(handle_t h, const T& x) {
+		ASSERTP(contains(h), "bad handle");
+		_vals[h] = x;
+		up(_pos[h]);
+		down(_pos[h]);
+	}
+
+	void remove(handle_t h) {
+		ASSERTP(contains(h), "bad handle");
+		removeAt(_pos[h]);
+	}
+
+private:
+	inline bool less(handle_t x, handle_t y) const { return C::doCompare(_vals[x], _vals[y]) < 0; }
+	inline void place(int i, handle_t h) { _heap[i] = h; _pos[h] = i; }
+
+	void removeAt(int i) {
+		handle_t h = _heap[i], l = _heap.pop();
+		_pos[h] = NONE;
+		_free.add(h);
+		if(i < _heap.count()) {
+			place(i, l);
+			up(i);
+			down(_pos[l]);
+		}
+	}
+
+	void up(int i) {
+		handle_t h = _heap[i];
+		while(i > 0) {
+			int p = (i - 1) / D;
+			if(!less(h, _heap[p]))
+				break;
+			place(i, _heap[p]);
+			i = p;
+		}
+		place(i, h);
+	}
+
+	void down(int i) {
+		int n = _heap.count();
+		handle_t h = _heap[i];
+		while(true) {
+			int c = D * i + 1;
+			if(c >= n)
+				break;
+			int b = c, e = c + D < n ? c + D : n;
+			for(int j = c + 1; j < e; j++)
+				if(less(_heap[j], _heap[b]))
+					b = j;
+			if(!less(_heap[b], h))
+				break;
+			place(i, _heap[b]);
+			i = b;
+		}
+		place(i, h);
+	}
+
+	Vector<handle_t> _heap, _pos, _free;
+	Vector<T> _vals;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_HEAP_H_ */
@@ -0,0 +1,197 @@
+/*
+ *	PerfectHashMap class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_PERFECTHASHMAP_H_
+#define ELM_DATA_PERFECTHASHMAP_H_
+
+#include <elm/assert.h>
+#include <elm/hash.h>
+#include <elm/data/Vector.h>
+#include <elm/util/Option.h>
+#include <elm/util/Pair.h>
+
+namespace elm {
+
+template <class K, class T, class H = HashKey<K> >
+class PerfectHashMap {
+public:
+	typedef K key_t;
+	typedef T val_t;
+	typedef Pair<K, T> pair_t;
+	static const int BUCKET_SIZE = 4;
+	static const int MAX_SEED = 1 << 16;
+
+	inline PerfectHashMap(void): _seeds(nullptr), _slots(nullptr), _bmask(0), _smask(0), _frozen(true) { }
+	PerfectHashMap(const PerfectHashMap&) = delete;
+	PerfectHashMap& operator=(const PerfectHashMap&) = delete;
+	inline ~PerfectHashMap(void) { delete [] _seeds; delete [] _slots; }
+
+	inline void add(const K& key, const T& val) { _items.add(pair(key, val)); _frozen = false; }
+	inline void clear(void) { _items.clear(); _over.clear(); _frozen = false; }
+	inline bool isFrozen(void) const { return _frozen; }
+	inline const Vector<pair_t>& items(void) const { return _items; }
+
+	inline int count(void) const { return _items.count(); }
+	inline bool isEmpty(void) const { return _items.isEmpty(); }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	int indexOf(const K& key) const {
+		ASSERTP(_frozen, "PerfectHashMap must be frozen before look-up");
+		if(_slots == nullptr)
+			return -1;
+		t::uint64 h = H::hash(key);
+		int i = _slots[slot(h, _seeds[bucket(h)])];
+		if(i >= 0 && H::equals(_items[i].fst, key))
+			return i;
+		for(auto j: _over)
+			if(H::equals(_items[j].fst, key))
+				return j;
+		return -1;
+	}
+	inline Option<T> get(const K& key) const
+		{ int i = indexOf(key); if(i < 0) return none; else return _items[i].snd; }
+	inline const T& get(const K& key, const T& def) const
+		{ int i = indexOf(key); return i < 0 ? def : _items[i].snd; }
+	inline bool hasKey(const K& key) const { return indexOf(key) >= 0; }
+
+	void freeze(void) {
+		delete [] _seeds;
+		delete [] _slots;
+		_seeds = nullptr;
+		_slots = nullptr;
+		_over.clear();
+		_frozen = true;
+		int n = _items.count();
+		if(n == 0)
+			return;
+		int r = 1, s = 1;
+		while(r * BUCKET_SIZE < n)
+			r <<= 1;
+		while(s < n + n / 4)
+			s <<= 1;
+		t::uint64 *hs = new t::uint64[n];
+		for(int i = 0; i < n; i++)
+			hs[i] = H::hash(_items[i].fst);
+		_bmask = r - 1;
+		_seeds = new t::uint32[r];
+		for(int i = 0; i < r; i++)
+			_seeds[i] = 0;
+		while(!place(hs, r, s))
+			s <<= 1;
+		delete [] hs;
+	}
+
+private:
+
+	static inline t::uint64 mix(t::uint64 x) {
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccdULL;
+		x ^= x >> 33;
+		x *= 0xc4ceb9fe1a85ec53ULL;
+		x ^= x >> 33;
+		return x;
+	}
+	inline t::size bucket(t::uint64 h) const { return t::size(mix(h) >> 32) & _bmask; }
+	inline t::size slot(t::uint64 h, t::uint32 seed) const
+		{ return t::size(mix(h + (t::uint64(seed) + 1) * 0x9e3779b97f4a7c15ULL)) & _smask; }
+
+	bool place(const t::uint64 *hs, int r, int s) {
+		int n = _items.count();
+		delete [] _slots;
+		_slots = new int[s];
+		_smask = s - 1;
+		_over.clear();
+		for(int i = 0; i < s; i++)
+			_slots[i] = -1;
+
+		// group the keys by bucket
+		int *start = new int[r + 1], *order = new int[n], *used = new int[n];
+		for(int i = 0; i <= r; i++)
+			start[i] = 0;
+		for(int i = 0; i < n; i++)
+			start[bucket(hs[i]) + 1]++;
+		int max = 0;
+		for(int i = 0; i < r; i++) {
+			if(start[i + 1] > max)
+				max = start[i + 1];
+			start[i + 1] += start[i];
+		}
+		for(int i = 0; i < n; i++)
+			order[start[bucket(hs[i])]++] = i;
+		for(int i = r; i > 0; i--)
+			start[i] = start[i - 1];
+		start[0] = 0;
+
+		// find a seed for each bucket, biggest first
+		bool done = true;
+		for(int size = max; done && size > 0; size--)
+			for(int b = 0; done && b < r; b++) {
+				if(start[b + 1] - start[b] != size)
+					continue;
+
+				// keys with the same hash cannot be separated
+				int m = 0;
+				for(int i = start[b]; i < start[b + 1]; i++) {
+					bool dup = false;
+					for(int j = start[b]; !dup && j < i; j++)
+						dup = hs[order[j]] == hs[order[i]];
+					if(dup)
+						_over.add(order[i]);
+					else
+						order[start[b] + m++] = order[i];
+				}
+
+				// look for a seed placing all keys in free slots
+				t::uint32 seed;
+				for(seed = 0; seed < t::uint32(MAX_SEED); seed++) {
+					int u = 0;
+					for(; u < m; u++) {
+						int sl = slot(hs[order[start[b] + u]], seed);
+						if(_slots[sl] != -1)
+							break;
+						_slots[sl] = order[start[b] + u];
+						used[u] = sl;
+					}
+					if(u == m)
+						break;
+					while(u > 0)
+						_slots[used[--u]] = -1;
+				}
+				_seeds[b] = seed;
+				done = seed < t::uint32(MAX_SEED);
+			}
+
+		delete [] start;
+		delete [] order;
+		delete [] used;
+		return done;
+	}
+
+	Vector<pair_t> _items;
+	Vector<int> _over;
+	t::uint32 *_seeds;
+	int *_slots;
+	t::size _bmask, _smask;
+	bool _frozen;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_PERFECTHASHMAP_H_ */
@@ -0,0 +1,101 @@
+/*
+ *	RadixHeap class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_RADIXHEAP_H_
+#define ELM_DATA_RADIXHEAP_H_
+
+#include <elm/assert.h>
+#include <elm/int.h>
+#include <elm/data/Vector.h>
+#include <elm/util/Pair.h>
+
+namespace elm {
+
+template <class T, class K = t::uint32>
+class RadixHeap {
+	static_assert(K(-1) > K(0), "radix heap keys must be unsigned");
+public:
+	typedef T t;
+	typedef K key_t;
+	static const int BUCKETS = sizeof(K) * 8 + 1;
+
+	inline RadixHeap(void): _last(0), _cnt(0) { }
+
+	inline int count(void) const { return _cnt; }
+	inline bool isEmpty(void) const { return _cnt == 0; }
+	inline operator bool(void) const { return !isEmpty(); }
+	inline key_t last(void) const { return _last; }
+	inline const T& head(void) const { pull(); return _bucks[0].top().snd; }
+	inline key_t headKey(void) const { pull(); return _bucks[0].top().fst; }
+
+	void put(key_t k, const T& x) {
+		ASSERTP(k >= _last, "radix heap keys must be monotone");
+		_bucks[bucket(k)].add(pair(k, x));
+		_cnt++;
+	}
+
+	T get(void) {
+		pull();
+		_cnt--;
+		return _bucks[0].pop().snd;
+	}
+
+	void reset(void) {
+		for(int i = 0; i < BUCKETS; i++)
+			_bucks[i].clear();
+		_last = 0;
+		_cnt = 0;
+	}
+	inline void clear(void) { reset(); }
+
+private:
+	typedef Pair<K, T> item_t;
+
+	inline int bucket(key_t k) const {
+		key_t d = k ^ _last;
+		return (sizeof(K) <= 4 ? msb(elm::t::uint32(d)) : msb(elm::t::uint64(d))) + 1;
+	}
+
+	void pull(void) const {
+		ASSERTP(_cnt > 0, "empty radix heap");
+		if(!_bucks[0].isEmpty())
+			return;
+		int i = 1;
+		while(_bucks[i].isEmpty())
+			i++;
+		Vector<item_t>& b = _bucks[i];
+		key_t m = b[0].fst;
+		for(int j = 1; j < b.count(); j++)
+			if(b[j].fst < m)
+				m = b[j].fst;
+		_last = m;
+		for(int j = 0; j < b.count(); j++)
+			_bucks[bucket(b[j].fst)].add(b[j]);
+		b.clear();
+	}
+
+	mutable Vector<item_t> _bucks[BUCKETS];
+	mutable key_t _last;
+	int _cnt;
+};
+
+}	// elm
+
+#endif /* ELM_DATA_RADIXHEAP_H_ */
@@ -23,7 +23,9 @@
 
 #include "Adapter.h"
 #include "List.h"
+#include "quicksort.h"
 #include "util.h"
+#include "Vector.h"
 #include <elm/compare.h>
 #include <elm/util/Option.h>
 
@@ -91,8 +93,18 @@ public:
 		list.addLast(value);
 	}
 
-	template <class CC> inline void addAll (const CC &c)
-		{ list.addAll(c); }
+	template <class CC> void addAll(const CC &c) {
+		Vector<T> v;
+		for(const auto& x: c)
+			v.add(x);
+		quicksort(v, comparator());
+		typename list_t::PrecIter current(list);
+		for(const auto& x: v) {
+			while(current() && comparator().doCompare(x, *current) >= 0)
+				current++;
+			list.addBefore(current, x);
+		}
+	}
 	inline void remove(const T &item) { list.remove(item); }
 	template <class CC> inline void removeAll(const CC &c)
 		{ list.removeAll(c); }
@@ -0,0 +1,337 @@
+/*
+ *	radix and counting sorts
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_DATA_RADIXSORT_H_
+#define ELM_DATA_RADIXSORT_H_
+
+#include <type_traits>
+#include <utility>
+#include <elm/assert.h>
+#include <elm/util/Pair.h>
+#include <elm/sys/Barrier.h>
+#include <elm/sys/JobScheduler.h>
+#include <elm/sys/System.h>
+
+namespace elm {
+
+// key extraction
+template <class T> struct RadixKey {
+	static_assert(std::is_unsigned<T>::value, "RadixKey<T> requires an integer type or a custom key extractor");
+	typedef T key_t;
+	inline key_t operator()(const T& x) const { return x; }
+};
+template <class T> struct RadixSignedKey {
+	typedef typename std::make_unsigned<T>::type key_t;
+	inline key_t operator()(T x) const { return key_t(x) ^ (key_t(1) << (sizeof(T) * 8 - 1)); }
+};
+template <> struct RadixKey<signed char>: RadixSignedKey<signed char> { };
+template <> struct RadixKey<short>: RadixSignedKey<short> { };
+template <> struct RadixKey<int>: RadixSignedKey<int> { };
+template <> struct RadixKey<long>: RadixSignedKey<long> { };
+template <> struct RadixKey<long long>: RadixSignedKey<long long> { };
+template <> struct RadixKey<char> {
+	typedef unsigned char key_t;
+	inline key_t operator()(char x) const { return std::is_signed<char>::value ? key_t(x) ^ 0x80 : key_t(x); }
+};
+template <class T> struct RadixKey<T *> {
+	typedef t::intptr key_t;
+	inline key_t operator()(T *x) const { return key_t(x); }
+};
+template <class K, class V> struct RadixKey<Pair<K, V> > {
+	typedef typename RadixKey<K>::key_t key_t;
+	inline key_t operator()(const Pair<K, V>& x) const { return RadixKey<K>()(x.fst); }
+};
+
+namespace radix {
+
+static const int BITS = 8, DIGITS = 1 << BITS, SMALL = 32;
+
+template <class A> struct type { typedef typename std::remove_reference<decltype(std::declval<A&>()[0])>::type t; };
+
+template <class K> inline int digit(K k, int d) { return int((k >> (d * BITS)) & (DIGITS - 1)); }
+
+template <class A, class K>
+struct key_of { typedef typename std::remove_cv<typename std::remove_reference<decltype(std::declval<const K&>()(std::declval<A&>()[0]))>::type>::type t; };
+
+// one scattering pass of LSD sort
+template <class S, class D, class K>
+inline void scatter(S& src, D& dst, int n, const K& key, int d, int *off) {
+	for(int i = 0; i < n; i++) {
+		const auto& x = src[i];
+		dst[off[digit(key(x), d)]++] = x;
+	}
+}
+
+// insertion sort on keys, used for small buckets
+template <class A, class K>
+void insertion(A& a, int lo, int hi, const K& key) {
+	for(int i = lo + 1; i < hi; i++) {
+		typename type<A>::t x = a[i];
+		auto k = key(x);
+		int j = i;
+		for(; j > lo && k < key(a[j - 1]); j--)
+			a[j] = a[j - 1];
+		a[j] = x;
+	}
+}
+
+// in-place MSD sort (American flag sort)
+template <class A, class K>
+void msd(A& a, int lo, int hi, const K& key, int d) {
+	if(hi - lo <= SMALL) {
+		insertion(a, lo, hi, key);
+		return;
+	}
+	int cnt[DIGITS] = { 0 }, next[DIGITS], end[DIGITS];
+	for(int i = lo; i < hi; i++)
+		cnt[digit(key(a[i]), d)]++;
+	int p = lo;
+	for(int i = 0; i < DIGITS; i++) {
+		next[i] = p;
+		p += cnt[i];
+		end[i] = p;
+	}
+	for(int b = 0; b < DIGITS; b++)
+		while(next[b] < end[b]) {
+			typename type<A>::t x = a[next[b]];
+			int c = digit(key(x), d);
+			while(c != b) {
+				typename type<A>::t y = a[next[c]];
+				a[next[c]++] = x;
+				x = y;
+				c = digit(key(x), d);
+			}
+			a[next[b]++] = x;
+		}
+	if(d > 0)
+		for(int b = 0, s = lo; b < DIGITS; s = end[b], b++)
+			if(end[b] - s > 1)
+				msd(a, s, end[b], key, d - 1);
+}
+
+}	// radix
+
+// LSD radix sort
+template <class A, class K = RadixKey<typename radix::type<A>::t> >
+void radixsort(A& a, const K& key = K()) {
+	typedef typename radix::type<A>::t item_t;
+	typedef typename radix::key_of<A, K>::t key_t;
+	static const int D = sizeof(key_t);
+	int n = a.count();
+	if(n <= radix::SMALL) {
+		radix::insertion(a, 0, n, key);
+		return;
+	}
+
+	// compute all histograms at once
+	int (*cnt)[radix::DIGITS] = new int[D][radix::DIGITS];
+	for(int d = 0; d < D; d++)
+		for(int i = 0; i < radix::DIGITS; i++)
+			cnt[d][i] = 0;
+	for(int i = 0; i < n; i++) {
+		key_t k = key(a[i]);
+		for(int d = 0; d < D; d++)
+			cnt[d][radix::digit(k, d)]++;
+	}
+
+	// perform the passes, skipping the constant digits
+	item_t *buf = new item_t[n];
+	bool in_buf = false;
+	for(int d = 0; d < D; d++) {
+		if(cnt[d][radix::digit(key(in_buf ? buf[0] : a[0]), d)] == n)
+			continue;
+		int off[radix::DIGITS];
+		for(int i = 0, s = 0; i < radix::DIGITS; i++) {
+			off[i] = s;
+			s += cnt[d][i];
+		}
+		if(in_buf)
+			radix::scatter(buf, a, n, key, d, off);
+		else
+			radix::scatter(a, buf, n, key, d, off);
+		in_buf = !in_buf;
+	}
+	if(in_buf)
+		for(int i = 0; i < n; i++)
+			a[i] = buf[i];
+	delete [] buf;
+	delete [] cnt;
+}
+
+// MSD radix sort
+template <class A, class K = RadixKey<typename radix::type<A>::t> >
+inline void msdRadixsort(A& a, const K& key = K()) {
+	radix::msd(a, 0, a.count(), key, int(sizeof(typename radix::key_of<A, K>::t)) - 1);
+}
+
+// counting sort
+template <class A, class K = RadixKey<typename radix::type<A>::t> >
+void countingsort(A& a, int range, const K& key = K()) {
+	typedef typename radix::type<A>::t item_t;
+	int n = a.count();
+	int *off = new int[range + 1];
+	for(int i = 0; i <= range; i++)
+		off[i] = 0;
+	for(int i = 0; i < n; i++) {
+		ASSERTP(t::uint64(key(a[i])) < t::uint64(range), "key out of range");
+		off[key(a[i]) + 1]++;
+	}
+	for(int i = 0; i < range; i++)
+		off[i + 1] += off[i];
+	item_t *buf = new item_t[n];
+	for(int i = 0; i < n; i++)
+		buf[off[key(a[i])]++] = a[i];
+	for(int i = 0; i < n; i++)
+		a[i] = buf[i];
+	delete [] buf;
+	delete [] off;
+}
+
+namespace radix {
+
+// parallel LSD sort
+template <class A, class K>
+class Parallel: public sys::JobProducer {
+	typedef typename type<A>::t item_t;
+	typedef typename key_of<A, K>::t key_t;
+public:
+	Parallel(A& a, const K& key, int threads)
+	: _a(a), _key(key), _n(a.count()), _cnt(threads), _given(0), _barrier(threads), _in_buf(false) {
+		_buf = new item_t[_n];
+		_hist = new int[_cnt][DIGITS];
+		_jobs = new Job *[_cnt];
+		for(int i = 0; i < _cnt; i++)
+			_jobs[i] = new Job(*this, i);
+	}
+	~Parallel(void) {
+		for(int i = 0; i < _cnt; i++)
+			delete _jobs[i];
+		delete [] _jobs;
+		delete [] _hist;
+		delete [] _buf;
+	}
+
+	void sort(void) {
+		sys::JobScheduler sched(*this);
+		sched.setThreadCount(_cnt);
+		sched.start();
+	}
+
+	sys::Job *next(void) override { return _given < _cnt ? _jobs[_given++] : nullptr; }
+
+private:
+	class Job: public sys::Job {
+	public:
+		Job(Parallel& p, int i): _p(p), _i(i) { }
+		void run(void) override { _p.work(_i); }
+	private:
+		Parallel& _p;
+		int _i;
+	};
+
+	void work(int w) {
+		int lo = int(t::int64(_n) * w / _cnt), hi = int(t::int64(_n) * (w + 1) / _cnt);
+		for(int d = 0; d < int(sizeof(key_t)); d++) {
+
+			// count the digits of the chunk
+			int *h = _hist[w];
+			for(int i = 0; i < DIGITS; i++)
+				h[i] = 0;
+			if(_in_buf)
+				for(int i = lo; i < hi; i++)
+					h[digit(_key(_buf[i]), d)]++;
+			else
+				for(int i = lo; i < hi; i++)
+					h[digit(_key(_a[i]), d)]++;
+
+			// compute the offsets
+			if(_barrier.wait()) {
+				int s = 0;
+				_skip = false;
+				for(int i = 0; i < DIGITS; i++) {
+					int c = 0;
+					for(int j = 0; j < _cnt; j++)
+						c += _hist[j][i];
+					if(c == _n)
+						_skip = true;
+					for(int j = 0; j < _cnt; j++) {
+						int x = _hist[j][i];
+						_hist[j][i] = s;
+						s += x;
+					}
+				}
+			}
+			_barrier.wait();
+
+			// scatter the chunk
+			if(!_skip) {
+				if(_in_buf)
+					for(int i = lo; i < hi; i++) {
+						const item_t& x = _buf[i];
+						_a[h[digit(_key(x), d)]++] = x;
+					}
+				else
+					for(int i = lo; i < hi; i++) {
+						const item_t& x = _a[i];
+						_buf[h[digit(_key(x), d)]++] = x;
+					}
+			}
+			if(_barrier.wait() && !_skip)
+				_in_buf = !_in_buf;
+			_barrier.wait();
+		}
+
+		// copy back
+		if(_in_buf)
+			for(int i = lo; i < hi; i++)
+				_a[i] = _buf[i];
+	}
+
+	A& _a;
+	const K& _key;
+	int _n, _cnt, _given;
+	sys::Barrier _barrier;
+	bool _in_buf, _skip;
+	item_t *_buf;
+	int (*_hist)[DIGITS];
+	Job **_jobs;
+};
+
+}	// radix
+
+// parallel LSD radix sort
+template <class A, class K = RadixKey<typename radix::type<A>::t> >
+void parallelRadixsort(A& a, const K& key = K(), int threads = 0) {
+	if(threads <= 0)
+		threads = sys::System::coreCount();
+	int n = a.count();
+	if(threads > n / (radix::DIGITS * 4))
+		threads = n / (radix::DIGITS * 4);
+	if(threads <= 1) {
+		radixsort(a, key);
+		return;
+	}
+	radix::Parallel<A, K> p(a, key, threads);
+	p.sort();
+}
+
+}	// elm
+
+#endif /* ELM_DATA_RADIXSORT_H_ */
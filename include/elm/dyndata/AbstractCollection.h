@@ -22,6 +22,7 @@
 #ifndef ELM_DYNDATA_ABSTRACTCOLLECTION_H
 #define ELM_DYNDATA_ABSTRACTCOLLECTION_H
 
+#include <type_traits>
 #include <elm/PreIterator.h>
 #include <elm/ptr.h>
 
@@ -35,6 +36,53 @@ public:
 	virtual bool ended(void) const = 0;
 	virtual T item(void) const = 0;
 	virtual void next(void) = 0;
+	virtual int fill(T *buf, int max)
+		{ int n = 0; for(; n < max && !ended(); n++) { buf[n] = item(); next(); } return n; }
+	virtual AbstractIter<T> *clone(void *) const { return nullptr; }
+};
+
+
+// IterBuffer class
+template <class T, int N, bool B = std::is_default_constructible<T>::value>
+class IterBuffer: public Lock {
+public:
+	inline IterBuffer(void): _pos(0), _cnt(0) { }
+	inline int offset(void) const { return _pos; }
+	inline bool ended(AbstractIter<T> *) const { return _pos >= _cnt; }
+	inline T item(AbstractIter<T> *) const { return _buf[_pos]; }
+	inline void next(AbstractIter<T> *i) { _pos++; if(_pos == _cnt) refill(i); }
+	inline void refill(AbstractIter<T> *i) { _pos = 0; _cnt = i == nullptr ? 0 : i->fill(_buf, N); }
+	int fill(AbstractIter<T> *i, T *buf, int max) {
+		int n = 0;
+		while(n < max && _pos < _cnt)
+			buf[n++] = _buf[_pos++];
+		if(n < max && i != nullptr)
+			n += i->fill(buf + n, max - n);
+		if(_pos == _cnt)
+			refill(i);
+		return n;
+	}
+	void copy(const IterBuffer<T, N, B>& b) {
+		_pos = b._pos;
+		_cnt = b._cnt;
+		for(int k = _pos; k < _cnt; k++)
+			_buf[k] = b._buf[k];
+	}
+private:
+	int _pos, _cnt;
+	T _buf[N];
+};
+
+template <class T, int N>
+class IterBuffer<T, N, false>: public Lock {
+public:
+	inline int offset(void) const { return 0; }
+	inline bool ended(AbstractIter<T> *i) const { return i == nullptr || i->ended(); }
+	inline T item(AbstractIter<T> *i) const { return i->item(); }
+	inline void next(AbstractIter<T> *i) { i->next(); }
+	inline void refill(AbstractIter<T> *) { }
+	inline int fill(AbstractIter<T> *i, T *buf, int max) { return i == nullptr ? 0 : i->fill(buf, max); }
+	inline void copy(const IterBuffer<T, N, false>&) { }
 };
 
 
@@ -42,15 +90,56 @@ public:
 template <class T>
 class Iter: public PreIterator<Iter<T>, T> {
 public:
-	inline Iter(AbstractIter<T> *iter): i(iter) { }
-	inline Iter(const Iter<T>& iter): i(iter.i) { }
-	inline AbstractIter<T> *instance(void) const { return &i; }
-	inline bool ended(void) const { return i->ended(); }
-	inline T item(void) const { return i->item(); }
-	inline void next(void) { i->next(); }
-	inline Iter<T>& operator=(const Iter<T>& iter) { i = iter.i; return *this; }
+	static const int BATCH = 16;
+	static const int SIZE = 64;
+	static const bool BATCHED = std::is_default_constructible<T>::value;
+
+	inline Iter(AbstractIter<T> *iter): i(iter), _inst(iter), _b(new buf_t()), _shared(_b) { _b->refill(_inst); }
+	inline Iter(const Iter<T>& iter): i(iter.i) { copy(iter); }
+	inline ~Iter(void) { release(); }
+	template <class I> static inline Iter<T> make(const I& i);
+
+	inline AbstractIter<T> *instance(void) const { return _inst; }
+	inline int offset(void) const { return _b->offset(); }
+	inline bool ended(void) const { return _b->ended(_inst); }
+	inline T item(void) const { return _b->item(_inst); }
+	inline void next(void) { _b->next(_inst); }
+	inline int fill(T *buf, int max) { return _b->fill(_inst, buf, max); }
+	inline Iter<T>& operator=(const Iter<T>& iter)
+		{ if(this != &iter) { release(); i = iter.i; copy(iter); } return *this; }
+
 protected:
 	LockPtr<AbstractIter<T> > i;
+
+private:
+	typedef IterBuffer<T, BATCH> buf_t;
+	inline Iter(void): _inst(nullptr), _b(&_local) { }
+	template <class I> inline void place(const I& i, std::true_type);
+	template <class I> inline void place(const I& i, std::false_type);
+	inline bool isInline(void) const { return static_cast<const void *>(_inst) == static_cast<const void *>(_mem); }
+	inline void release(void) { if(isInline()) _inst->~AbstractIter<T>(); }
+	void copy(const Iter<T>& iter) {
+		_inst = iter.isInline() ? iter._inst->clone(_mem) : iter._inst;
+		if(iter._shared) {
+			_b = iter._b;
+			_shared = iter._shared;
+		}
+		else {
+			_local.copy(*iter._b);
+			_b = &_local;
+			_shared = nullptr;
+		}
+	}
+
+	AbstractIter<T> *_inst;
+	buf_t *_b;
+	LockPtr<buf_t> _shared;
+	buf_t _local;
+	union {
+		char _mem[SIZE];
+		void *_align;
+		double _dalign;
+	};
 };
 
 // AbstractCollection class
@@ -22,6 +22,7 @@
 #ifndef ELM_DYNDATA_COLLECTION_H
 #define ELM_DYNDATA_COLLECTION_H
 
+#include <new>
 #include "AbstractCollection.h"
 
 namespace elm { namespace dyndata {
@@ -29,18 +30,50 @@ namespace elm { namespace dyndata {
 template <class T, class I>
 class IterInst: public elm::dyndata::AbstractIter<T> {
 public:
-	inline IterInst(const I& i): _i(i) { }
+	inline IterInst(const I& i): _i(i), _m(i) { }
 	virtual ~IterInst(void) { }
 	virtual bool ended(void) const { return _i.ended(); }
 	virtual T item(void) const { return _i.item(); }
 	virtual void next(void) { _i.next(); }
+	virtual int fill(T *buf, int max) {
+		I i(_i);
+		int n = 0;
+		for(; n < max && !i.ended(); n++) {
+			buf[n] = i.item();
+			i.next();
+		}
+		_m.~I();
+		new(&_m) I(_i);
+		_i.~I();
+		new(&_i) I(i);
+		return n;
+	}
+	virtual AbstractIter<T> *clone(void *mem) const { return new(mem) IterInst<T, I>(*this); }
 	inline const I& iter(void) const { return _i; }
+	inline I at(int k) const { I i = _m; while(k-- > 0) i.next(); return i; }
 private:
-	I _i;
+	I _i, _m;
 };
 template <class T, class I>
 inline IterInst<T, I> *iter(const I& i) { return new IterInst<T, I>(i); }
 
+template <class T> template <class I>
+inline void Iter<T>::place(const I& i, std::true_type)
+	{ _inst = new(_mem) IterInst<T, I>(i); }
+
+template <class T> template <class I>
+inline void Iter<T>::place(const I& i, std::false_type)
+	{ _inst = new IterInst<T, I>(i); this->i = _inst; _b = new buf_t(); _shared = _b; }
+
+template <class T> template <class I>
+inline Iter<T> Iter<T>::make(const I& i) {
+	typedef IterInst<T, I> inst_t;
+	Iter<T> r;
+	r.place(i, std::integral_constant<bool, sizeof(inst_t) <= SIZE && alignof(inst_t) <= alignof(double)>());
+	r._b->refill(r._inst);
+	return r;
+}
+
 
 // Collection class
 template <class T, class C>
@@ -52,7 +85,7 @@ public:
 	virtual int count(void) { return coll.count(); }
 	virtual bool contains(const T& item) const { return coll.contains(item); }
 	virtual bool isEmpty(void) const { return coll.isEmpty(); }
-	virtual Iter<T> items(void) const { return new IterInst<T, typename C::Iter>(coll.items()); }
+	virtual Iter<T> items(void) const { return Iter<T>::make(coll.items()); }
 
 protected:
 	C coll;
@@ -69,9 +102,11 @@ public:
 		{ for(auto iter = coll.items(); iter(); iter++) add(*iter); }
 	virtual void remove(const T& item) { Collection<T, C>::coll.remove(item); }
 	virtual void removeAll(const AbstractCollection<T>& coll)
-		{ for(auto iter = coll.items(); iter(); iter++) remove(iter); }
-	virtual void remove(const Iter<T>& iter)
-		{ Collection<T, C>::coll.remove(static_cast<const IterInst<T, typename C::Iter> *>(iter.instance())->iter()); }
+		{ for(auto iter = coll.items(); iter(); iter++) remove(*iter); }
+	virtual void remove(const Iter<T>& iter) {
+		auto inst = static_cast<const IterInst<T, typename C::Iter> *>(iter.instance());
+		Collection<T, C>::coll.remove(Iter<T>::BATCHED ? inst->at(iter.offset()) : inst->iter());
+	}
 };
 
 } } // elm::dyndata
@@ -42,10 +42,32 @@ struct enum_info: public enum_t<T> {
 	static inline value_t last(void) { return value_t("", T(0)); }
 
 	// usage
-	static cstring toString(T v)
-		{ for(int i = 0; values[i].name; i++) if(v == values[i].value) return values[i].name; return "???"; }
-	static T fromString(const string& name)
-		{ for(int i = 0; values[i].name; i++) if(name == values[i].name) return values[i].value; throw io::IOException("bad enum value"); }
+	static cstring toString(T v) {
+		const index_t& x = index();
+		if(x.dense != nullptr) {
+			t::int64 i = t::int64(v) - x.min;
+			if(i >= 0 && i < x.size && x.dense[i] >= 0)
+				return values[x.dense[i]].name;
+		}
+		else
+			for(int i = 0; values[i].name; i++) if(v == values[i].value) return values[i].name;
+		return "???";
+	}
+	static T fromString(const string& name) {
+		const index_t& x = index();
+		// lower bound: the leftmost equal name is the first declared one
+		int l = 0, h = x.count;
+		while(l < h) {
+			int m = (l + h) / 2;
+			if(name.compare(values[x.sorted[m]].name) > 0)
+				l = m + 1;
+			else
+				h = m;
+		}
+		if(l < x.count && name == values[x.sorted[l]].name)
+			return values[x.sorted[l]].value;
+		throw io::IOException("bad enum value");
+	}
 
 	// iterator on values
 	class iterator {
@@ -66,6 +88,50 @@ struct enum_info: public enum_t<T> {
 	};
 	inline static iterator begin(void) { return iterator(values, 0); }
 	inline static iterator end(void) { return iterator(values, -1); }
+
+private:
+	typedef struct index_t {
+		index_t(void): count(0), sorted(nullptr), dense(nullptr), min(0), size(0) {
+			while(values[count].name)
+				count++;
+			if(count == 0)
+				return;
+
+			// names sorted for binary search (stable: first declaration wins)
+			sorted = new int[count];
+			for(int i = 0; i < count; i++) {
+				int j = i;
+				for(; j > 0 && values[sorted[j - 1]].name.compare(values[i].name) > 0; j--)
+					sorted[j] = sorted[j - 1];
+				sorted[j] = i;
+			}
+
+			// direct table if the values are dense enough
+			t::int64 l = t::int64(values[0].value), h = l;
+			for(int i = 1; i < count; i++) {
+				t::int64 v = t::int64(values[i].value);
+				if(v < l)
+					l = v;
+				if(v > h)
+					h = v;
+			}
+			if(h - l < 4 * t::int64(count) + 16) {
+				min = l;
+				size = int(h - l + 1);
+				dense = new int[size];
+				for(int i = 0; i < size; i++)
+					dense[i] = -1;
+				for(int i = count - 1; i >= 0; i--)
+					dense[t::int64(values[i].value) - l] = i;
+			}
+		}
+		~index_t(void) { delete [] sorted; delete [] dense; }
+		int count;
+		int *sorted, *dense;
+		t::int64 min;
+		int size;
+	} index_t;
+	static const index_t& index(void) { static index_t i; return i; }
 };
 
 } // elm
@@ -37,6 +37,7 @@ namespace t { typedef t::intptr hash; }
 t::hash hash_string(const char *chars, int length);
 t::hash hash_cstring(const char *chars);
 t::hash hash_jenkins(const void *block, int size);
+t::hash hash_bytes(const void *block, int size);
 inline t::hash hash_ptr(const void *p) {
 #	ifdef ELM_32
 		return t::hash(p) >> 2;
@@ -85,7 +86,7 @@ public:
 
 template <> class HashKey<CString> {
 public:
-	static t::hash hash(CString key) { return hash_cstring(key.chars()); }
+	static t::hash hash(CString key) { return hash_bytes(key.chars(), key.length()); }
 	static inline bool equals(CString key1, CString key2) { return key1 == key2; }
 	inline t::hash computeHash(cstring key) const { return hash(key); }
 	inline bool isEqual(cstring key1, cstring key2) const { return equals(key1, key2); }
@@ -93,7 +94,7 @@ public:
 
 template <> class HashKey<String> {
 public:
-	static t::hash hash(const String& key) { return hash_string(key.chars(), key.length()); };
+	static t::hash hash(const String& key) { return hash_bytes(key.chars(), key.length()); };
 	static inline bool equals(const String& key1, const String& key2) { return key1 == key2; };
 	inline t::hash computeHash(string key) const { return hash(key); }
 	inline bool isEqual(string key1, string key2) const { return equals(key1, key2); }
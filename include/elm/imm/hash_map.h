@@ -0,0 +1,371 @@
+/*
+ *	imm::hash_map class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_IMM_HASH_MAP_H_
+#define ELM_IMM_HASH_MAP_H_
+
+#include <elm/assert.h>
+#include <elm/equiv.h>
+#include <elm/hash.h>
+#include <elm/int.h>
+#include <elm/PreIterator.h>
+#include <elm/alloc/DefaultAllocator.h>
+#include <elm/data/StaticStack.h>
+#include <elm/data/util.h>
+#include <elm/util/Option.h>
+
+namespace elm { namespace imm {
+
+template <class K, class T, class H = HashKey<K>, class E = Equiv<T> >
+class hash_map {
+	static const int
+		BITS = 5,
+		MASK = (1 << BITS) - 1,
+		MAX_DEPTH = (sizeof(t::hash) * 8 + BITS - 1) / BITS + 1;
+
+	class cell_t {
+	public:
+		inline cell_t(bool l): rc(0), leaf(l) { }
+		int rc;
+		bool leaf;
+	};
+
+	class leaf_t: public cell_t {
+	public:
+		inline leaf_t(t::hash hash, const K& k, const T& v, leaf_t *n)
+			: cell_t(true), h(hash), p(k, v), next(n) { retain(n); }
+		inline ~leaf_t(void) { release(next); }
+		t::hash h;
+		Pair<K, T> p;
+		leaf_t *next;
+	};
+
+	class branch_t: public cell_t {
+	public:
+		inline branch_t(t::uint32 m): cell_t(false), map(m) { }
+		inline int count(void) const { return countOnes(map); }
+		inline int index(t::uint32 bit) const { return countOnes(map & (bit - 1)); }
+		t::uint32 map;
+		cell_t *cells[1];
+
+		static branch_t *make(t::uint32 m) {
+			int n = countOnes(m);
+			void *p = DefaultAllocator::DEFAULT.allocate(sizeof(branch_t) + (n - 1) * sizeof(cell_t *));
+			return new(p) branch_t(m);
+		}
+		inline void destroy(void) {
+			for(int i = 0; i < count(); i++)
+				release(cells[i]);
+			this->~branch_t();
+			DefaultAllocator::DEFAULT.free(this);
+		}
+	};
+
+	inline hash_map(cell_t *r, int c): root(r), cnt(c) { retain(root); }
+
+public:
+	typedef hash_map<K, T, H, E> self_t;
+	static const hash_map<K, T, H, E> null;
+
+	inline hash_map(void): root(nullptr), cnt(0) { }
+	inline hash_map(const self_t& m): root(m.root), cnt(m.cnt) { retain(root); }
+	inline ~hash_map(void) { release(root); }
+	inline self_t& operator=(const self_t& m)
+		{ retain(m.root); release(root); root = m.root; cnt = m.cnt; return *this; }
+
+	// Collection concept
+	inline int count(void) const { return cnt; }
+	inline bool isEmpty(void) const { return root == nullptr; }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	class PairIter: public PreIterator<PairIter, const Pair<K, T>&> {
+	public:
+		inline PairIter(void): l(nullptr) { }
+		inline PairIter(const self_t& m): l(nullptr) { if(m.root != nullptr) down(m.root); }
+		inline bool ended(void) const { return l == nullptr; }
+		inline const Pair<K, T>& item(void) const { return l->p; }
+		void next(void) {
+			l = l->next;
+			while(l == nullptr && !s.isEmpty()) {
+				Pair<const branch_t *, int> t = s.pop();
+				if(t.snd < t.fst->count()) {
+					s.push(pair(t.fst, t.snd + 1));
+					down(t.fst->cells[t.snd]);
+				}
+			}
+		}
+		inline bool equals(const PairIter& i) const { return l == i.l && s.equals(i.s); }
+	private:
+		void down(const cell_t *c) {
+			while(!c->leaf) {
+				const branch_t *b = static_cast<const branch_t *>(c);
+				s.push(pair(b, 1));
+				c = b->cells[0];
+			}
+			l = static_cast<const leaf_t *>(c);
+		}
+		StaticStack<Pair<const branch_t *, int>, MAX_DEPTH> s;
+		const leaf_t *l;
+	};
+	inline Iterable<PairIter> pairs(void) const { return subiter(PairIter(*this), PairIter()); }
+
+	class Iter: public PreIterator<Iter, const T&> {
+	public:
+		inline Iter(void) { }
+		inline Iter(const self_t& m): i(m) { }
+		inline bool ended(void) const { return i.ended(); }
+		inline const T& item(void) const { return i.item().snd; }
+		inline void next(void) { i.next(); }
+		inline bool equals(const Iter& ii) const { return i.equals(ii.i); }
+	private:
+		PairIter i;
+	};
+	inline Iter begin(void) const { return Iter(*this); }
+	inline Iter end(void) const { return Iter(); }
+
+	class KeyIter: public PreIterator<KeyIter, const K&> {
+	public:
+		inline KeyIter(void) { }
+		inline KeyIter(const self_t& m): i(m) { }
+		inline bool ended(void) const { return i.ended(); }
+		inline const K& item(void) const { return i.item().fst; }
+		inline void next(void) { i.next(); }
+		inline bool equals(const KeyIter& ii) const { return i.equals(ii.i); }
+	private:
+		PairIter i;
+	};
+	inline Iterable<KeyIter> keys(void) const { return subiter(KeyIter(*this), KeyIter()); }
+
+	inline bool equals(const self_t& m) const
+		{ return root == m.root || (cnt == m.cnt && equals(root, m.root)); }
+	inline bool operator==(const self_t& m) const { return equals(m); }
+	inline bool operator!=(const self_t& m) const { return !equals(m); }
+	inline bool same(const self_t& m) const { return root == m.root; }
+
+	// Map concept
+	inline Option<T> get(const K& key) const
+		{ const leaf_t *l = find(key); if(l == nullptr) return none; else return some(l->p.snd); }
+	inline const T& get(const K& key, const T& def) const
+		{ const leaf_t *l = find(key); if(l == nullptr) return def; else return l->p.snd; }
+	inline bool hasKey(const K& key) const { return find(key) != nullptr; }
+
+	// persistent update
+	self_t put(const K& key, const T& val) const {
+		bool added = true;
+		cell_t *r = put(root, 0, H::hash(key), key, val, added);
+		return self_t(r, added ? cnt + 1 : cnt);
+	}
+
+	self_t remove(const K& key) const {
+		bool found = false;
+		cell_t *r = remove(root, 0, H::hash(key), key, found);
+		if(!found)
+			return *this;
+		return self_t(r, cnt - 1);
+	}
+
+private:
+
+	static inline void retain(cell_t *c) { if(c != nullptr) c->rc++; }
+	static inline void release(cell_t *c) { if(c != nullptr && --c->rc == 0) destroy(c); }
+	static inline void destroy(cell_t *c)
+		{ if(c->leaf) delete static_cast<leaf_t *>(c); else static_cast<branch_t *>(c)->destroy(); }
+	static inline t::uint32 bit(t::hash h, int shift)
+		{ return t::uint32(1) << ((t::uint64(h) >> shift) & MASK); }
+
+	const leaf_t *find(const K& key) const {
+		t::hash h = H::hash(key);
+		const cell_t *c = root;
+		for(int shift = 0; c != nullptr && !c->leaf; shift += BITS) {
+			const branch_t *b = static_cast<const branch_t *>(c);
+			t::uint32 m = bit(h, shift);
+			if(!(b->map & m))
+				return nullptr;
+			c = b->cells[b->index(m)];
+		}
+		for(const leaf_t *l = static_cast<const leaf_t *>(c); l != nullptr; l = l->next)
+			if(l->h == h && H::equals(l->p.fst, key))
+				return l;
+		return nullptr;
+	}
+
+	static leaf_t *without(const leaf_t *l, const K& key, bool& found) {
+		if(l == nullptr)
+			return nullptr;
+		if(H::equals(l->p.fst, key)) {
+			found = true;
+			return l->next;
+		}
+		leaf_t *n = without(l->next, key, found);
+		if(!found)
+			return const_cast<leaf_t *>(l);
+		return new leaf_t(l->h, l->p.fst, l->p.snd, n);
+	}
+
+	static branch_t *copy(const branch_t *b, t::uint32 m, int skip) {
+		branch_t *r = branch_t::make(m);
+		for(int i = 0, j = 0; i < b->count(); i++)
+			if(i != skip) {
+				r->cells[j] = b->cells[i];
+				retain(r->cells[j++]);
+			}
+		return r;
+	}
+
+	static cell_t *merge(leaf_t *l1, leaf_t *l2, int shift) {
+		t::uint32 m1 = bit(l1->h, shift), m2 = bit(l2->h, shift);
+		branch_t *b = branch_t::make(m1 | m2);
+		if(m1 == m2)
+			b->cells[0] = merge(l1, l2, shift + BITS);
+		else if(m1 < m2) {
+			b->cells[0] = l1;
+			b->cells[1] = l2;
+		}
+		else {
+			b->cells[0] = l2;
+			b->cells[1] = l1;
+		}
+		for(int i = 0; i < b->count(); i++)
+			retain(b->cells[i]);
+		return b;
+	}
+
+	static cell_t *put(cell_t *c, int shift, t::hash h, const K& key, const T& val, bool& added) {
+		if(c == nullptr)
+			return new leaf_t(h, key, val, nullptr);
+
+		// leaf case
+		if(c->leaf) {
+			leaf_t *l = static_cast<leaf_t *>(c);
+			if(l->h == h) {
+				bool found = false;
+				leaf_t *n = without(l, key, found);
+				added = !found;
+				return new leaf_t(h, key, val, n);
+			}
+			return merge(l, new leaf_t(h, key, val, nullptr), shift);
+		}
+
+		// branch case
+		branch_t *b = static_cast<branch_t *>(c);
+		t::uint32 m = bit(h, shift);
+		int i = b->index(m);
+		if(!(b->map & m)) {
+			branch_t *r = branch_t::make(b->map | m);
+			for(int j = 0; j < i; j++)
+				r->cells[j] = b->cells[j];
+			r->cells[i] = new leaf_t(h, key, val, nullptr);
+			for(int j = i; j < b->count(); j++)
+				r->cells[j + 1] = b->cells[j];
+			for(int j = 0; j < r->count(); j++)
+				retain(r->cells[j]);
+			return r;
+		}
+		else {
+			cell_t *s = put(b->cells[i], shift + BITS, h, key, val, added);
+			branch_t *r = copy(b, b->map, -1);
+			release(r->cells[i]);
+			r->cells[i] = s;
+			retain(s);
+			return r;
+		}
+	}
+
+	static cell_t *remove(cell_t *c, int shift, t::hash h, const K& key, bool& found) {
+		if(c == nullptr)
+			return nullptr;
+
+		// leaf case
+		if(c->leaf) {
+			leaf_t *l = static_cast<leaf_t *>(c);
+			if(l->h != h)
+				return c;
+			return without(l, key, found);
+		}
+
+		// branch case
+		branch_t *b = static_cast<branch_t *>(c);
+		t::uint32 m = bit(h, shift);
+		if(!(b->map & m))
+			return c;
+		int i = b->index(m);
+		cell_t *s = remove(b->cells[i], shift + BITS, h, key, found);
+		if(!found)
+			return c;
+		if(s == nullptr) {
+			if(b->count() == 1)
+				return nullptr;
+			if(b->count() == 2 && b->cells[1 - i]->leaf)
+				return b->cells[1 - i];
+			return copy(b, b->map & ~m, i);
+		}
+		if(s->leaf && b->count() == 1)
+			return s;
+		branch_t *r = copy(b, b->map, -1);
+		release(r->cells[i]);
+		r->cells[i] = s;
+		retain(s);
+		return r;
+	}
+
+	static bool equals(const leaf_t *l1, const leaf_t *l2) {
+		int n1 = 0, n2 = 0;
+		for(const leaf_t *l = l1; l != nullptr; l = l->next)
+			n1++;
+		for(const leaf_t *l = l2; l != nullptr; l = l->next)
+			n2++;
+		if(n1 != n2)
+			return false;
+		for(const leaf_t *l = l1; l != nullptr; l = l->next) {
+			const leaf_t *k = l2;
+			while(k != nullptr && !H::equals(k->p.fst, l->p.fst))
+				k = k->next;
+			if(k == nullptr || !E::equals(k->p.snd, l->p.snd))
+				return false;
+		}
+		return true;
+	}
+
+	static bool equals(const cell_t *c1, const cell_t *c2) {
+		if(c1 == c2)
+			return true;
+		if(c1 == nullptr || c2 == nullptr || c1->leaf != c2->leaf)
+			return false;
+		if(c1->leaf)
+			return equals(static_cast<const leaf_t *>(c1), static_cast<const leaf_t *>(c2));
+		const branch_t *b1 = static_cast<const branch_t *>(c1), *b2 = static_cast<const branch_t *>(c2);
+		if(b1->map != b2->map)
+			return false;
+		for(int i = 0; i < b1->count(); i++)
+			if(!equals(b1->cells[i], b2->cells[i]))
+				return false;
+		return true;
+	}
+
+	cell_t *root;
+	int cnt;
+};
+
+template <class K, class T, class H, class E>
+const hash_map<K, T, H, E> hash_map<K, T, H, E>::null;
+
+} }	// elm::imm
+
+#endif /* ELM_IMM_HASH_MAP_H_ */
@@ -0,0 +1,244 @@
+/*
+ *	imm::map class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_IMM_MAP_H_
+#define ELM_IMM_MAP_H_
+
+#include <elm/assert.h>
+#include <elm/compare.h>
+#include <elm/equiv.h>
+#include <elm/PreIterator.h>
+#include <elm/data/StaticStack.h>
+#include <elm/data/util.h>
+#include <elm/util/Option.h>
+
+namespace elm { namespace imm {
+
+template <class K, class T, class C = Comparator<K>, class E = Equiv<T> >
+class map {
+	static const int MAX_HEIGHT = 64;
+
+	class node_t {
+	public:
+		inline node_t(const K& k, const T& v, node_t *l, node_t *r)
+			: rc(0), p(k, v), left(l), right(r)
+			{ retain(l); retain(r); int hl = height(l), hr = height(r); h = (hl > hr ? hl : hr) + 1; }
+		inline ~node_t(void) { release(left); release(right); }
+		inline const K& key(void) const { return p.fst; }
+		inline const T& value(void) const { return p.snd; }
+		int rc, h;
+		Pair<K, T> p;
+		node_t *left, *right;
+	};
+
+	inline map(node_t *r, int c): root(r), cnt(c) { retain(root); }
+
+public:
+	typedef map<K, T, C, E> self_t;
+	static const map<K, T, C, E> null;
+
+	inline map(void): root(nullptr), cnt(0) { }
+	inline map(const self_t& m): root(m.root), cnt(m.cnt) { retain(root); }
+	inline ~map(void) { release(root); }
+	inline self_t& operator=(const self_t& m)
+		{ retain(m.root); release(root); root = m.root; cnt = m.cnt; return *this; }
+
+	// Collection concept
+	inline int count(void) const { return cnt; }
+	inline bool isEmpty(void) const { return root == nullptr; }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	class PairIter: public PreIterator<PairIter, const Pair<K, T>&> {
+	public:
+		inline PairIter(void) { }
+		inline PairIter(const self_t& m) { down(m.root); }
+		inline bool ended(void) const { return s.isEmpty(); }
+		inline const Pair<K, T>& item(void) const { return s.top()->p; }
+		inline void next(void) { const node_t *n = s.pop(); down(n->right); }
+		inline bool equals(const PairIter& i) const { return s.equals(i.s); }
+	private:
+		inline void down(const node_t *n) { for(; n != nullptr; n = n->left) s.push(n); }
+		StaticStack<const node_t *, MAX_HEIGHT> s;
+	};
+	inline Iterable<PairIter> pairs(void) const { return subiter(PairIter(*this), PairIter()); }
+
+	class Iter: public PreIterator<Iter, const T&> {
+	public:
+		inline Iter(void) { }
+		inline Iter(const self_t& m): i(m) { }
+		inline bool ended(void) const { return i.ended(); }
+		inline const T& item(void) const { return i.item().snd; }
+		inline void next(void) { i.next(); }
+		inline bool equals(const Iter& ii) const { return i.equals(ii.i); }
+	private:
+		PairIter i;
+	};
+	inline Iter begin(void) const { return Iter(*this); }
+	inline Iter end(void) const { return Iter(); }
+
+	class KeyIter: public PreIterator<KeyIter, const K&> {
+	public:
+		inline KeyIter(void) { }
+		inline KeyIter(const self_t& m): i(m) { }
+		inline bool ended(void) const { return i.ended(); }
+		inline const K& item(void) const { return i.item().fst; }
+		inline void next(void) { i.next(); }
+		inline bool equals(const KeyIter& ii) const { return i.equals(ii.i); }
+	private:
+		PairIter i;
+	};
+	inline Iterable<KeyIter> keys(void) const { return subiter(KeyIter(*this), KeyIter()); }
+
+	bool equals(const self_t& m) const {
+		if(root == m.root)
+			return true;
+		if(cnt != m.cnt)
+			return false;
+		for(PairIter i(*this), j(m); i(); i++, j++)
+			if(C::compare((*i).fst, (*j).fst) != 0 || !E::equals((*i).snd, (*j).snd))
+				return false;
+		return true;
+	}
+	inline bool operator==(const self_t& m) const { return equals(m); }
+	inline bool operator!=(const self_t& m) const { return !equals(m); }
+	inline bool same(const self_t& m) const { return root == m.root; }
+
+	// Map concept
+	inline Option<T> get(const K& key) const
+		{ const node_t *n = find(key); if(n == nullptr) return none; else return some(n->value()); }
+	inline const T& get(const K& key, const T& def) const
+		{ const node_t *n = find(key); if(n == nullptr) return def; else return n->value(); }
+	inline bool hasKey(const K& key) const { return find(key) != nullptr; }
+
+	// persistent update
+	self_t put(const K& key, const T& val) const {
+		bool added = false;
+		node_t *r = put(root, key, val, added);
+		return self_t(r, added ? cnt + 1 : cnt);
+	}
+
+	self_t remove(const K& key) const {
+		bool found = false;
+		node_t *r = remove(root, key, found);
+		if(!found)
+			return *this;
+		return self_t(r, cnt - 1);
+	}
+
+private:
+
+	static inline void retain(node_t *n) { if(n != nullptr) n->rc++; }
+	static inline void release(node_t *n) { if(n != nullptr && --n->rc == 0) delete n; }
+	static inline void dispose(node_t *n) { if(n != nullptr && n->rc == 0) delete n; }
+	static inline int height(node_t *n) { return n == nullptr ? 0 : n->h; }
+
+	const node_t *find(const K& key) const {
+		for(const node_t *n = root; n != nullptr;) {
+			int c = C::compare(key, n->key());
+			if(c < 0)
+				n = n->left;
+			else if(c > 0)
+				n = n->right;
+			else
+				return n;
+		}
+		return nullptr;
+	}
+
+	static node_t *balance(const K& k, const T& v, node_t *l, node_t *r) {
+		node_t *res;
+		int hl = height(l), hr = height(r);
+		if(hl > hr + 1) {
+			if(height(l->left) >= height(l->right))
+				res = new node_t(l->key(), l->value(), l->left, new node_t(k, v, l->right, r));
+			else
+				res = new node_t(l->right->key(), l->right->value(),
+					new node_t(l->key(), l->value(), l->left, l->right->left),
+					new node_t(k, v, l->right->right, r));
+		}
+		else if(hr > hl + 1) {
+			if(height(r->right) >= height(r->left))
+				res = new node_t(r->key(), r->value(), new node_t(k, v, l, r->left), r->right);
+			else
+				res = new node_t(r->left->key(), r->left->value(),
+					new node_t(k, v, l, r->left->left),
+					new node_t(r->key(), r->value(), r->left->right, r->right));
+		}
+		else
+			return new node_t(k, v, l, r);
+		dispose(l);
+		dispose(r);
+		return res;
+	}
+
+	static node_t *put(node_t *n, const K& key, const T& val, bool& added) {
+		if(n == nullptr) {
+			added = true;
+			return new node_t(key, val, nullptr, nullptr);
+		}
+		int c = C::compare(key, n->key());
+		if(c < 0)
+			return balance(n->key(), n->value(), put(n->left, key, val, added), n->right);
+		else if(c > 0)
+			return balance(n->key(), n->value(), n->left, put(n->right, key, val, added));
+		else
+			return new node_t(key, val, n->left, n->right);
+	}
+
+	static node_t *removeMin(node_t *n, const node_t *& min) {
+		if(n->left == nullptr) {
+			min = n;
+			return n->right;
+		}
+		return balance(n->key(), n->value(), removeMin(n->left, min), n->right);
+	}
+
+	static node_t *remove(node_t *n, const K& key, bool& found) {
+		if(n == nullptr)
+			return nullptr;
+		int c = C::compare(key, n->key());
+		if(c < 0) {
+			node_t *l = remove(n->left, key, found);
+			return found ? balance(n->key(), n->value(), l, n->right) : n;
+		}
+		else if(c > 0) {
+			node_t *r = remove(n->right, key, found);
+			return found ? balance(n->key(), n->value(), n->left, r) : n;
+		}
+		found = true;
+		if(n->left == nullptr)
+			return n->right;
+		if(n->right == nullptr)
+			return n->left;
+		const node_t *m;
+		node_t *r = removeMin(n->right, m);
+		return balance(m->key(), m->value(), n->left, r);
+	}
+
+	node_t *root;
+	int cnt;
+};
+
+template <class K, class T, class C, class E>
+const map<K, T, C, E> map<K, T, C, E>::null;
+
+} }	// elm::imm
+
+#endif /* ELM_IMM_MAP_H_ */
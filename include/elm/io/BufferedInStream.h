@@ -36,6 +36,7 @@ public:
 	~BufferedInStream() override;
 
 	inline InStream& stream() const { return *in; }
+	inline int available(void) const { return top - pos; }
 	void setStream(InStream& str);
 	void reset();
 
@@ -35,16 +35,21 @@ public:
 	~StreamPipe(void);
 	int proceed(void);
 	string lastErrorMessage(void) const;
+	inline bool zeroCopy(void) const { return zero; }
+	inline void setZeroCopy(bool enabled) { zero = enabled; }
 private:
 	InStream& _in;
 	OutStream& _out;
 	enum {
 		OK = 0,
 		IN_ERROR,
-		OUT_ERROR
+		OUT_ERROR,
+		SYS_ERROR
 	} state;
 	int bufs;
 	char *buf;
+	bool zero;
+	int err;
 };
 
 } }	// elm::io
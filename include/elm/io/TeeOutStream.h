@@ -29,6 +29,8 @@ namespace elm { namespace io {
 class TeeOutStream: public OutStream {
 public:
 	TeeOutStream(OutStream& out1, OutStream& out2);
+	inline OutStream& out1(void) const { return _out1; }
+	inline OutStream& out2(void) const { return _out2; }
 	int write (const char *buffer, int size) override;
 	int flush (void) override;
 	cstring lastErrorMessage(void) override;
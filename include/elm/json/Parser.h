@@ -74,6 +74,7 @@ private:
 	void parseArray(io::InStream& in);
 	void parseValue(io::InStream& in, token_t t);
 	void parseString(io::InStream& in, char c);
+	t::uint16 parseHex(io::InStream& in);
 	void parseLitt(io::InStream& in, cstring litt);
 	void parseComment(io::InStream& in);
 	token_t parseBasedNumber(io::InStream& in);
@@ -26,6 +26,7 @@
 #include <elm/io/Output.h>
 #include <elm/string/CString.h>
 #include <elm/string/AutoString.h>
+#include <elm/log/Logger.h>
 
 namespace elm
 {
@@ -115,8 +116,9 @@ namespace elm
 	} // color namespace
 } // elm namespace
 
-#define ELM_DBG(str)   { if(elm::log::Debug::getDebugFlag()) elm::cout << elm::log::Debug::debugPrefix(__FILE__, __LINE__) << str << elm::color::RCol(); } // standard debug
-#define ELM_DBGLN(str) { if(elm::log::Debug::getDebugFlag()) elm::cout << elm::log::Debug::debugPrefix(__FILE__, __LINE__) << str << elm::color::RCol() << elm::io::endl; } // debug with new line
+#define ELM_DBG_CAPTURE(style, str) { if(elm::log::Debug::getDebugFlag() && elm::log::Logger::isEnabled(elm::log::Logger::DEBUG)) { elm::log::Capture _elm_cap(elm::log::Logger::DEBUG, elm::cout, style, __FILE__, __LINE__); _elm_cap << str; } }
+#define ELM_DBG(str)   ELM_DBG_CAPTURE(elm::log::Capture::DEBUG, str) // standard debug
+#define ELM_DBGLN(str) ELM_DBG_CAPTURE(elm::log::Capture::DEBUG_LINE, str) // debug with new line
 #define ELM_DBGV(level, str) { if(level & elm::log::Debug::getVerboseLevel()) ELM_DBG(str); } // verbose debug
 
 // aliases
@@ -0,0 +1,168 @@
+/*
+ *	Logger class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_LOG_LOGGER_H_
+#define ELM_LOG_LOGGER_H_
+
+#include <elm/io/Output.h>
+#include <elm/string/StringBuffer.h>
+#include <elm/sys/Atomic.h>
+
+#ifndef ELM_LOG_LEVEL
+#	define ELM_LOG_LEVEL 0
+#endif
+
+namespace elm { namespace log {
+
+class Capture;
+
+class Logger {
+	friend class Capture;
+public:
+	typedef enum {
+		TRACE = 0,
+		DEBUG = 1,
+		INFO = 2,
+		WARNING = 3,
+		ERROR = 4,
+		OFF = 5
+	} level_t;
+
+	typedef enum {
+		BLOCK = 0,
+		DROP = 1
+	} policy_t;
+
+	static const int RING_SIZE = 256;
+	static const int DATA_SIZE = 200;
+	static const int SINKS = 16;
+
+	static inline level_t level(void) { return level_t(_level.load(sys::RELAXED)); }
+	static inline void setLevel(level_t level) { _level.store(level, sys::RELAXED); }
+	static inline bool isEnabled(level_t level)
+		{ return level >= ELM_LOG_LEVEL && level >= Logger::level(); }
+	static inline bool isAsync(void) { return _async.load(sys::RELAXED); }
+
+	static inline policy_t policy(void) { return policy_t(_policy.load(sys::RELAXED)); }
+	static inline void setPolicy(policy_t policy) { _policy.store(policy, sys::RELAXED); }
+	static inline int ringSize(void) { return _ring_size; }
+	static void setRingSize(int size);
+
+	static void start(void);
+	static void stop(void);
+	static void flush(void);
+	static io::Output& open(io::OutStream& stream);
+	static void close(io::Output& out);
+	static t::uint64 dropped(void);
+	static cstring name(level_t level);
+
+private:
+	class Ring;
+	class Consumer;
+	class Holder;
+	class Sink;
+
+	typedef enum {
+		END = 0,
+		INT32,
+		UINT32,
+		INT64,
+		UINT64,
+		DOUBLE,
+		CHAR,
+		BOOL,
+		POINTER,
+		STRING
+	} tag_t;
+
+	typedef struct record_t {
+		t::uint64 time;
+		Sink *sink;
+		const char *file;
+		String *spill;
+		int line;
+		t::uint16 size;
+		t::uint8 level, style;
+		char data[DATA_SIZE];
+	} record_t;
+
+	static void print(io::Output& out, int tag, const char *p);
+	static void decode(io::Output& out, const record_t& r);
+	static void write(io::Output& out, const record_t& r, bool sync);
+	static Sink *find(io::Output& out);
+	static Consumer& consumer(void);
+	static Ring *ring(void);
+	static void wake(void);
+
+	static sys::Atomic<int> _level, _policy;
+	static sys::Atomic<bool> _async;
+	static int _ring_size;
+	static thread_local Holder _holder;
+	static Sink *_std[2];
+	static sys::Atomic<Sink *> _sinks[SINKS];
+};
+
+class Capture {
+public:
+	typedef enum {
+		PLAIN = 0,
+		LINE = 1,
+		TAG = 2,
+		DEBUG = 3,
+		DEBUG_LINE = 4
+	} style_t;
+
+	Capture(Logger::level_t level, io::Output& out, style_t style = TAG, const char *file = nullptr, int line = 0);
+	Capture(const Capture&) = delete;
+	Capture& operator=(const Capture&) = delete;
+	~Capture(void);
+
+	inline Capture& operator<<(bool v) { return put(Logger::BOOL, &v, sizeof(v)); }
+	inline Capture& operator<<(char v) { return put(Logger::CHAR, &v, sizeof(v)); }
+	inline Capture& operator<<(t::int32 v) { return put(Logger::INT32, &v, sizeof(v)); }
+	inline Capture& operator<<(t::uint32 v) { return put(Logger::UINT32, &v, sizeof(v)); }
+	inline Capture& operator<<(t::int64 v) { return put(Logger::INT64, &v, sizeof(v)); }
+	inline Capture& operator<<(t::uint64 v) { return put(Logger::UINT64, &v, sizeof(v)); }
+	inline Capture& operator<<(double v) { return put(Logger::DOUBLE, &v, sizeof(v)); }
+	inline Capture& operator<<(const void *v) { return put(Logger::POINTER, &v, sizeof(v)); }
+	inline Capture& operator<<(const char *v) { return *this << cstring(v); }
+	inline Capture& operator<<(cstring v) { return put(v.chars(), v.length()); }
+	inline Capture& operator<<(const string& v) { return put(v.chars(), v.length()); }
+	inline Capture& operator<<(io::EOL eol) { return put(Logger::CHAR, "\n", 1); }
+	template <class T> inline Capture& operator<<(const T& v)
+		{ if(_sb != nullptr) *_sb << v; else { StringBuffer b; b << v; int n = b.length(); put(b.toCString().chars(), n); } return *this; }
+
+private:
+	Capture& put(Logger::tag_t tag, const void *p, int size);
+	Capture& put(const char *s, int n);
+	void spill(void);
+	Logger::record_t *_r;
+	Logger::Ring *_ring;
+	io::Output& _out;
+	StringBuffer *_sb;
+	bool _drop;
+	Logger::record_t _local;
+};
+
+} }	// elm::log
+
+#define ELM_LOG(level, str) { if(elm::log::Logger::isEnabled(level)) { elm::log::Capture _elm_cap(level, elm::cerr, elm::log::Capture::TAG, __FILE__, __LINE__); _elm_cap << str; } }
+
+#endif /* ELM_LOG_LOGGER_H_ */
@@ -0,0 +1,132 @@
+/*
+ *	Reactor class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_NET_REACTOR_H_
+#define ELM_NET_REACTOR_H_
+
+#include <atomic>
+#include <elm/concur/BlockingQueue.h>
+#include <elm/concur/MPMCQueue.h>
+#include <elm/concur/MPSCQueue.h>
+#include <elm/data/Vector.h>
+#include <elm/net/Exception.h>
+#include <elm/sys/Thread.h>
+
+namespace elm { namespace net {
+
+class Reactor;
+
+class Channel {
+	friend class Reactor;
+public:
+	Channel(void);
+	virtual ~Channel(void);
+
+	inline Reactor& reactor(void) const { return *_reactor; }
+	inline int fd(void) const { return _fd; }
+
+	// input
+	inline const char *data(void) const { return _in.buf + _in.start; }
+	inline int available(void) const { return _in.size(); }
+	void consume(int size);
+
+	// output
+	void send(const void *buf, int size);
+	inline void send(cstring s) { send(s.chars(), s.length()); }
+	inline void send(const string& s) { send(s.chars(), s.length()); }
+	inline int pending(void) const { return _out.size(); }
+
+	void close(void);
+	inline bool isClosing(void) const { return _closing; }
+
+protected:
+	virtual void onOpen(void);
+	virtual void onRead(void) = 0;
+	virtual void onDrain(void);
+	virtual void onClose(void);
+
+private:
+	typedef struct buffer_t {
+		inline buffer_t(void): buf(nullptr), start(0), end(0), cap(0) { }
+		inline ~buffer_t(void) { delete [] buf; }
+		inline int size(void) const { return end - start; }
+		char *reserve(int size);
+		char *buf;
+		int start, end, cap;
+	} buffer_t;
+
+	bool flush(void);
+	Reactor *_reactor;
+	int _fd, _index;
+	buffer_t _in, _out;
+	t::uint32 _events;
+	bool _closing, _dead, _busy;
+};
+
+class Reactor {
+	friend class Channel;
+public:
+	static const int READ_SIZE = 16384;
+
+	Reactor(int port = -1);
+	Reactor(const Reactor&) = delete;
+	Reactor& operator=(const Reactor&) = delete;
+	virtual ~Reactor(void);
+
+	inline int port(void) const { return _port; }
+	inline int workers(void) const { return _wcnt; }
+	void setWorkers(int count);
+	inline int count(void) const { return _chans.count(); }
+	inline bool isOpen(void) const { return _efd >= 0; }
+
+	void open(void);
+	void run(void);
+	void stop(void);
+	void close(void);
+
+protected:
+	virtual Channel *make(void) = 0;
+
+private:
+	class Worker;
+	void accept(void);
+	void process(Channel *ch, t::uint32 events);
+	void dispatch(Channel *ch);
+	void call(Channel *ch);
+	void complete(Channel *ch);
+	void update(Channel *ch);
+	void destroy(Channel *ch);
+	void wake(void);
+	void startWorkers(void);
+	void stopWorkers(void);
+
+	int _port, _wcnt;
+	int _efd, _lfd, _wfd;
+	std::atomic<bool> _stop;
+	Vector<Channel *> _chans;
+	concur::BlockingQueue<concur::MPMCQueue<Channel *> > *_work;
+	concur::MPSCQueue<Channel *> _done;
+	Vector<Worker *> _workers;
+	Vector<sys::Thread *> _threads;
+};
+
+} }	// elm::net
+
+#endif /* ELM_NET_REACTOR_H_ */
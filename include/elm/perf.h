@@ -0,0 +1,51 @@
+/*
+ *	perf module interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_PERF_H_
+#define ELM_PERF_H_
+
+#include <elm/macros.h>
+#include <elm/perf/Clock.h>
+#include <elm/perf/Counter.h>
+#include <elm/perf/Trace.h>
+
+#ifndef ELM_NO_PERF
+#	define ELM_PERF_COUNTER(v, name)	static elm::perf::Counter v(name)
+#	define ELM_PERF_HISTOGRAM(v, name)	static elm::perf::Histogram v(name)
+#	define ELM_PERF_TIMER(v, name)		static elm::perf::Timer v(name)
+#	define ELM_PERF_COUNT(v)			(v).inc()
+#	define ELM_PERF_ADD(v, n)			(v).add(n)
+#	define ELM_PERF_SAMPLE(v, x)		(v).add(x)
+#	define ELM_PERF_TIME(v)				elm::perf::Timer::Scope ELM_CONCAT(__perf_time_, __LINE__)(v)
+#	define ELM_PERF_TRACE(name)			elm::perf::Trace::Scope ELM_CONCAT(__perf_trace_, __LINE__)(name)
+#	define ELM_PERF_INSTANT(name)		elm::perf::Trace::instant(name)
+#else
+#	define ELM_PERF_COUNTER(v, name)
+#	define ELM_PERF_HISTOGRAM(v, name)
+#	define ELM_PERF_TIMER(v, name)
+#	define ELM_PERF_COUNT(v)			do { } while(0)
+#	define ELM_PERF_ADD(v, n)			do { } while(0)
+#	define ELM_PERF_SAMPLE(v, x)		do { } while(0)
+#	define ELM_PERF_TIME(v)				do { } while(0)
+#	define ELM_PERF_TRACE(name)			do { } while(0)
+#	define ELM_PERF_INSTANT(name)		do { } while(0)
+#endif
+
+#endif /* ELM_PERF_H_ */
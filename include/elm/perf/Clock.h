@@ -0,0 +1,61 @@
+/*
+ *	perf::Clock class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_PERF_CLOCK_H_
+#define ELM_PERF_CLOCK_H_
+
+#include <elm/types.h>
+#if defined(__unix) || defined(__APPLE__)
+#	include <time.h>
+#else
+#	include <chrono>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#	include <x86intrin.h>
+#endif
+
+namespace elm { namespace perf {
+
+class Clock {
+public:
+
+	static inline t::uint64 now(void) {
+#		if defined(__unix) || defined(__APPLE__)
+			struct timespec ts;
+			clock_gettime(CLOCK_MONOTONIC, &ts);
+			return t::uint64(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#		else
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+#		endif
+	}
+
+	static inline t::uint64 cycles(void) {
+#		if defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+#		else
+			return now();
+#		endif
+	}
+};
+
+} }	// elm::perf
+
+#endif /* ELM_PERF_CLOCK_H_ */
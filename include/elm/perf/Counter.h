@@ -0,0 +1,132 @@
+/*
+ *	perf::Counter, perf::Histogram and perf::Timer classes interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_PERF_COUNTER_H_
+#define ELM_PERF_COUNTER_H_
+
+#include <atomic>
+#include <elm/io.h>
+#include <elm/data/Vector.h>
+#include <elm/perf/Clock.h>
+
+namespace elm {
+
+namespace json { class Saver; }
+
+namespace perf {
+
+class Stat {
+public:
+	static const int MAX_SLOTS = 4096;
+	typedef std::atomic<t::uint64> slot_t;
+
+	typedef enum {
+		COUNTER,
+		HISTOGRAM,
+		TIMER
+	} kind_t;
+
+	Stat(cstring name, kind_t kind, int size);
+	virtual ~Stat(void);
+	inline cstring name(void) const { return _name; }
+	inline kind_t kind(void) const { return _kind; }
+	void reset(void);
+
+	virtual void print(io::Output& out) const = 0;
+	virtual void save(json::Saver& saver) const = 0;
+
+	static void printAll(io::Output& out = cout);
+	static void saveAll(json::Saver& saver);
+	static void resetAll(void);
+
+	class Slots;
+
+protected:
+	inline void add(int i, t::uint64 n) const
+		{ slot_t& s = slot(i); s.store(s.load(std::memory_order_relaxed) + n, std::memory_order_relaxed); }
+	inline void max(int i, t::uint64 n) const
+		{ slot_t& s = slot(i); if(n > s.load(std::memory_order_relaxed)) s.store(n, std::memory_order_relaxed); }
+	t::uint64 sum(int i) const;
+	t::uint64 maximum(int i) const;
+
+private:
+	friend class Detacher;
+	static void collect(Vector<const Stat *>& all);
+	static void detach(Slots *slots);
+	inline slot_t& slot(int i) const
+		{ slot_t *s = _local; if(s == nullptr) s = attach(); return s[_base + i]; }
+	static slot_t *attach(void);
+	static thread_local slot_t *_local;
+
+	cstring _name;
+	kind_t _kind;
+	int _base, _size;
+	Stat *_next;
+};
+
+
+class Counter: public Stat {
+public:
+	inline Counter(cstring name): Stat(name, COUNTER, 1) { }
+	inline void inc(void) const { Stat::add(0, 1); }
+	inline void add(t::uint64 n) const { Stat::add(0, n); }
+	inline t::uint64 value(void) const { return sum(0); }
+	void print(io::Output& out) const override;
+	void save(json::Saver& saver) const override;
+};
+
+
+class Histogram: public Stat {
+public:
+	static const int BUCKETS = 65;
+	inline Histogram(cstring name): Stat(name, HISTOGRAM, BUCKETS + 3) { }
+	inline void add(t::uint64 x) const
+		{ Stat::add(0, 1); Stat::add(1, x); Stat::max(2, x); Stat::add(3 + bucketOf(x), 1); }
+	inline t::uint64 count(void) const { return sum(0); }
+	inline t::uint64 total(void) const { return sum(1); }
+	inline t::uint64 max(void) const { return maximum(2); }
+	inline t::uint64 bucket(int i) const { return sum(3 + i); }
+	inline double mean(void) const { t::uint64 c = count(); return c == 0 ? 0 : double(total()) / c; }
+	t::uint64 percentile(double p) const;
+	static inline int bucketOf(t::uint64 x) { return x == 0 ? 0 : 64 - __builtin_clzll(x); }
+	void print(io::Output& out) const override;
+	void save(json::Saver& saver) const override;
+protected:
+	inline Histogram(cstring name, kind_t kind): Stat(name, kind, BUCKETS + 3) { }
+};
+
+
+class Timer: public Histogram {
+public:
+	inline Timer(cstring name): Histogram(name, TIMER) { }
+
+	class Scope {
+	public:
+		inline Scope(const Timer& timer): _timer(timer), _start(Clock::now()) { }
+		inline ~Scope(void) { _timer.add(Clock::now() - _start); }
+	private:
+		const Timer& _timer;
+		t::uint64 _start;
+	};
+};
+
+} }	// elm::perf
+
+#endif /* ELM_PERF_COUNTER_H_ */
@@ -0,0 +1,72 @@
+/*
+ *	perf::Trace class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_PERF_TRACE_H_
+#define ELM_PERF_TRACE_H_
+
+#include <atomic>
+#include <elm/perf/Clock.h>
+
+namespace elm {
+
+namespace json { class Saver; }
+
+namespace perf {
+
+class Trace {
+public:
+	static const int DEFAULT_CAPACITY = 1 << 14;
+
+	typedef struct event_t {
+		const char *name;
+		t::uint64 ts, dur;
+		char ph;
+	} event_t;
+
+	class Buffer;
+
+	static inline bool isEnabled(void) { return _enabled.load(std::memory_order_relaxed); }
+	static void enable(bool enabled = true);
+	static void setCapacity(int capacity);
+	static void clear(void);
+	static void save(json::Saver& saver);
+
+	static inline void complete(const char *name, t::uint64 start, t::uint64 stop)
+		{ if(isEnabled()) record(name, start, stop - start, 'X'); }
+	static inline void instant(const char *name)
+		{ if(isEnabled()) record(name, Clock::now(), 0, 'i'); }
+
+	class Scope {
+	public:
+		inline Scope(const char *name): _name(name), _start(isEnabled() ? Clock::now() : 0) { }
+		inline ~Scope(void) { if(_start != 0) complete(_name, _start, Clock::now()); }
+	private:
+		const char *_name;
+		t::uint64 _start;
+	};
+
+private:
+	static void record(const char *name, t::uint64 ts, t::uint64 dur, char ph);
+	static std::atomic<bool> _enabled;
+};
+
+} }	// elm::perf
+
+#endif /* ELM_PERF_TRACE_H_ */
@@ -22,6 +22,7 @@
 #define ELM_RTTI_H
 
 #include <elm/dyndata/AbstractCollection.h>
+#include <elm/rtti/CallSite.h>
 #include <elm/rtti/Class.h>
 #include <elm/rtti/Enum.h>
 #include <elm/rtti/Tuple.h>
@@ -0,0 +1,79 @@
+/*
+ *	CallSite class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_RTTI_CALLSITE_H_
+#define ELM_RTTI_CALLSITE_H_
+
+#include <elm/string/AutoString.h>
+#include <elm/util/MessageException.h>
+#include "Class.h"
+
+namespace elm { namespace rtti {
+
+template <int N>
+class Frame {
+public:
+	template <class... A> inline Frame(const A&... args): _args{ Variant(args)... } { }
+	inline int count(void) const { return N; }
+	inline const Variant *args(void) const { return _args; }
+	inline const Variant& operator[](int i) const { return _args[i]; }
+	inline Variant& operator[](int i) { return _args[i]; }
+private:
+	Variant _args[N == 0 ? 1 : N];
+};
+
+template <class... A>
+class CallSite {
+public:
+	static const int ARITY = sizeof...(A);
+
+	CallSite(const Operation& op): _op(&op) { check(); }
+	CallSite(const AbstractClass& cls, cstring name): _op(cls.operation(name, ARITY)) {
+		if(_op == nullptr)
+			throw MessageException(_ << "no operation " << cls.name() << "::" << name << " with " << ARITY << " parameter(s)");
+		check();
+	}
+
+	inline const Operation& operation(void) const { return *_op; }
+	inline Variant operator()(const A&... args) const { return call(args...); }
+	inline Variant call(const A&... args) const { Frame<ARITY> f(args...); return _op->invoke(f.args()); }
+	inline Variant call(const Frame<ARITY>& frame) const { return _op->invoke(frame.args()); }
+
+private:
+	void check(void) {
+		if(_op->parameters().count() != ARITY)
+			throw MessageException(_ << _op->name() << " expects " << _op->parameters().count()
+				<< " argument(s) but " << ARITY << " are given");
+		const Type *types[ARITY == 0 ? 1 : ARITY] = { &type_of<A>()... };
+		for(int i = 0; i < ARITY; i++)
+			if(!_op->accepts(i, *types[i]))
+				throw MessageException(_ << "bad type " << *types[i]
+					<< " for argument " << i << " of " << _op->name());
+	}
+
+	const Operation *_op;
+};
+
+template <class... A>
+const int CallSite<A...>::ARITY;
+
+} }	// elm::rtti
+
+#endif /* ELM_RTTI_CALLSITE_H_ */
@@ -21,6 +21,7 @@
 #ifndef ELM_RTTI_ENUM_H_
 #define ELM_RTTI_ENUM_H_
 
+#include <elm/data/PerfectHashMap.h>
 #include <elm/data/Vector.h>
 #include "Type.h"
 
@@ -72,8 +73,13 @@ public:
 	virtual const Enumerable& asEnum(void) const;
 
 private:
+	void index(void);
 	Vector<Value> _values;
 	Vector<Value> _map;
+	PerfectHashMap<string, int> _names;
+	Vector<cstring> _dense;
+	int _min;
+	Vector<Value> _sorted;
 };
 
 inline rtti::Enum::Value value(cstring name, int value)
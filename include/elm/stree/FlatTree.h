@@ -0,0 +1,123 @@
+/*
+ *	stree::FlatTree class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_STREE_FLATTREE_H_
+#define ELM_STREE_FLATTREE_H_
+
+#include <elm/assert.h>
+#include <elm/compare.h>
+
+namespace elm { namespace stree {
+
+// FlatTree class
+template <class K, class T, class C = Comparator<K> >
+class FlatTree {
+public:
+	inline FlatTree(void): n(0), keys(nullptr), ranks(nullptr), ubs(nullptr), vals(nullptr), lbs(nullptr) { }
+	FlatTree(const FlatTree&) = delete;
+	FlatTree& operator=(const FlatTree&) = delete;
+	inline ~FlatTree(void) { release(); }
+
+	inline int count(void) const { return n; }
+	inline bool isEmpty(void) const { return n == 0; }
+
+	void prepare(int cnt) {
+		release();
+		n = cnt;
+		lbs = new K[n];
+		ubs = new K[n];
+		vals = new T[n];
+	}
+
+	inline void put(int i, const K& lb, const K& ub, const T& val)
+		{ ASSERTP(0 <= i && i < n, "index out of bounds"); lbs[i] = lb; ubs[i] = ub; vals[i] = val; }
+
+	void complete(void) {
+		keys = new K[n + 1];
+		ranks = new int[n + 1];
+		int i = 0;
+		layout(1, i);
+		delete [] lbs;
+		lbs = nullptr;
+	}
+
+	inline const T& get(const K& key, const T& def) const
+		{ const T *val = find(key); if(!val) return def; else return *val; }
+	inline const T& get(const K& key) const
+		{ const T *val = find(key); ASSERTP(val, "out of tree"); return *val; }
+	inline bool contains(const K& key) const { return find(key) != nullptr; }
+
+	const T *find(const K& key) const {
+		int k = 1;
+		while(k <= n) {
+#			ifdef __GNUC__
+				__builtin_prefetch(keys + 16 * k);
+#			endif
+			k = 2 * k + (C::compare(keys[k], key) <= 0);
+		}
+#		ifdef __GNUC__
+			k >>= __builtin_ffs(~k);
+#		else
+			while(k & 1) k >>= 1;
+			k >>= 1;
+#		endif
+		int r = (k == 0 ? n : ranks[k]) - 1;
+		if(r < 0 || C::compare(key, ubs[r]) >= 0)
+			return nullptr;
+		return vals + r;
+	}
+
+private:
+
+	void layout(int k, int& i) {
+		if(k > n)
+			return;
+		layout(2 * k, i);
+		keys[k] = lbs[i];
+		ranks[k] = i;
+		i++;
+		layout(2 * k + 1, i);
+	}
+
+	void release(void) {
+		delete [] keys;
+		delete [] ranks;
+		delete [] ubs;
+		delete [] vals;
+		delete [] lbs;
+		keys = nullptr;
+		ranks = nullptr;
+		ubs = nullptr;
+		vals = nullptr;
+		lbs = nullptr;
+		n = 0;
+	}
+
+	int n;
+	K *keys;
+	int *ranks;
+	K *ubs;
+	T *vals;
+	K *lbs;
+};
+
+} }	// elm::stree
+
+#endif /* ELM_STREE_FLATTREE_H_ */
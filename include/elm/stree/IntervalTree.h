@@ -0,0 +1,256 @@
+/*
+ *	stree::IntervalTree class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_STREE_INTERVALTREE_H_
+#define ELM_STREE_INTERVALTREE_H_
+
+#include <elm/assert.h>
+#include <elm/compare.h>
+#include <elm/PreIterator.h>
+#include <elm/data/custom.h>
+#include <elm/data/StaticStack.h>
+#include <elm/util/Option.h>
+
+namespace elm { namespace stree {
+
+// IntervalTree class
+template <class K, class T, class C = Comparator<K>, class A = DefaultAlloc>
+class IntervalTree: public A {
+	static const int MAX_HEIGHT = 64;
+public:
+	typedef IntervalTree<K, T, C, A> self_t;
+
+	class Segment {
+		friend class IntervalTree;
+	public:
+		inline const K& lowerBound(void) const { return lb; }
+		inline const K& upperBound(void) const { return ub; }
+		inline const T& value(void) const { return val; }
+		inline T& value(void) { return val; }
+	private:
+		inline Segment(const K& l, const K& u, const T& v)
+			: lb(l), ub(u), max(u), val(v), left(nullptr), right(nullptr), height(1) { }
+		inline static void *operator new(size_t s, A *a) { return a->allocate(s); }
+		inline void free(A& a) { this->~Segment(); a.free(this); }
+		K lb, ub, max;
+		T val;
+		Segment *left, *right;
+		int height;
+	};
+
+	inline IntervalTree(void): _root(nullptr), _cnt(0) { }
+	inline IntervalTree(const self_t& t): _root(nullptr), _cnt(0) { copy(t); }
+	inline ~IntervalTree(void) { clear(); }
+	inline const A& allocator(void) const { return *this; }
+	inline A& allocator(void) { return *this; }
+
+	// Collection concept
+	inline int count(void) const { return _cnt; }
+	inline bool isEmpty(void) const { return _cnt == 0; }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	class Iter: public PreIterator<Iter, const Segment&> {
+	public:
+		inline Iter(void): point(false), all(false) { }
+		inline Iter(const self_t& t): point(false), all(true) { visit(t._root); }
+		inline Iter(const self_t& t, const K& key): l(key), point(true), all(false) { visit(t._root); }
+		inline Iter(const self_t& t, const K& low, const K& high): l(low), u(high), point(false), all(false)
+			{ visit(t._root); }
+		inline bool ended(void) const { return s.isEmpty(); }
+		inline const Segment& item(void) const { return *s.top(); }
+		inline void next(void) { const Segment *n = s.pop(); push(n->right, n); find(); }
+		inline bool equals(const Iter& i) const { return s.equals(i.s); }
+	private:
+		inline bool pruned(const Segment *n) const
+			{ return !all && C::compare(n->max, l) <= 0; }
+		inline bool before(const Segment *n) const
+			{ return all || (point ? C::compare(n->lb, l) <= 0 : C::compare(n->lb, u) < 0); }
+		inline bool matches(const Segment *n) const
+			{ return before(n) && (all || C::compare(n->ub, l) > 0); }
+		void push(const Segment *n, const Segment *p) {
+			if(p != nullptr && !before(p))
+				return;
+			while(n != nullptr && !pruned(n)) {
+				s.push(n);
+				n = n->left;
+			}
+		}
+		void find(void) {
+			while(!s.isEmpty() && !matches(s.top())) {
+				const Segment *n = s.pop();
+				push(n->right, n);
+			}
+		}
+		inline void visit(const Segment *n) { push(n, nullptr); find(); }
+		StaticStack<const Segment *, MAX_HEIGHT> s;
+		K l, u;
+		bool point, all;
+	};
+	inline Iter begin(void) const { return Iter(*this); }
+	inline Iter end(void) const { return Iter(); }
+
+	// query
+	inline Iter stab(const K& key) const { return Iter(*this, key); }
+	inline Iter overlap(const K& low, const K& high) const { return Iter(*this, low, high); }
+	inline bool contains(const K& key) const { return !stab(key).ended(); }
+	inline bool overlaps(const K& low, const K& high) const { return !overlap(low, high).ended(); }
+	inline Option<T> get(const K& key) const
+		{ Iter i = stab(key); if(i.ended()) return none; else return some(i.item().value()); }
+	inline const T& get(const K& key, const T& def) const
+		{ Iter i = stab(key); if(i.ended()) return def; else return i.item().value(); }
+
+	// MutableCollection concept
+	void clear(void) {
+		StaticStack<Segment *, MAX_HEIGHT> s;
+		if(_root != nullptr)
+			s.push(_root);
+		while(!s.isEmpty()) {
+			Segment *n = s.pop();
+			if(n->left != nullptr)
+				s.push(n->left);
+			if(n->right != nullptr)
+				s.push(n->right);
+			n->free(*this);
+		}
+		_root = nullptr;
+		_cnt = 0;
+	}
+
+	inline void add(const K& low, const K& high, const T& val)
+		{ ASSERTP(C::compare(low, high) < 0, "empty segment"); _root = insert(_root, new(this) Segment(low, high, val)); _cnt++; }
+
+	bool remove(const K& low, const K& high) {
+		bool done = false;
+		_root = remove(_root, low, high, done);
+		if(done)
+			_cnt--;
+		return done;
+	}
+
+	void copy(const self_t& t) {
+		clear();
+		for(const auto& s: t)
+			add(s.lowerBound(), s.upperBound(), s.value());
+	}
+	inline self_t& operator=(const self_t& t) { copy(t); return *this; }
+
+private:
+
+	static inline int height(Segment *n) { return n == nullptr ? 0 : n->height; }
+
+	static inline void update(Segment *n) {
+		int lh = height(n->left), rh = height(n->right);
+		n->height = (lh > rh ? lh : rh) + 1;
+		n->max = n->ub;
+		if(n->left != nullptr && C::compare(n->left->max, n->max) > 0)
+			n->max = n->left->max;
+		if(n->right != nullptr && C::compare(n->right->max, n->max) > 0)
+			n->max = n->right->max;
+	}
+
+	static Segment *rotateRight(Segment *n) {
+		Segment *l = n->left;
+		n->left = l->right;
+		l->right = n;
+		update(n);
+		update(l);
+		return l;
+	}
+
+	static Segment *rotateLeft(Segment *n) {
+		Segment *r = n->right;
+		n->right = r->left;
+		r->left = n;
+		update(n);
+		update(r);
+		return r;
+	}
+
+	static Segment *balance(Segment *n) {
+		update(n);
+		int b = height(n->left) - height(n->right);
+		if(b > 1) {
+			if(height(n->left->left) < height(n->left->right))
+				n->left = rotateLeft(n->left);
+			return rotateRight(n);
+		}
+		else if(b < -1) {
+			if(height(n->right->right) < height(n->right->left))
+				n->right = rotateRight(n->right);
+			return rotateLeft(n);
+		}
+		else
+			return n;
+	}
+
+	static inline int compare(const Segment *n, const K& low, const K& high) {
+		int c = C::compare(low, n->lb);
+		return c != 0 ? c : C::compare(high, n->ub);
+	}
+
+	static Segment *insert(Segment *n, Segment *s) {
+		if(n == nullptr)
+			return s;
+		if(compare(n, s->lb, s->ub) < 0)
+			n->left = insert(n->left, s);
+		else
+			n->right = insert(n->right, s);
+		return balance(n);
+	}
+
+	static Segment *removeMin(Segment *n, Segment *& min) {
+		if(n->left == nullptr) {
+			min = n;
+			return n->right;
+		}
+		n->left = removeMin(n->left, min);
+		return balance(n);
+	}
+
+	Segment *remove(Segment *n, const K& low, const K& high, bool& done) {
+		if(n == nullptr)
+			return nullptr;
+		int c = compare(n, low, high);
+		if(c < 0)
+			n->left = remove(n->left, low, high, done);
+		else if(c > 0)
+			n->right = remove(n->right, low, high, done);
+		else {
+			Segment *l = n->left, *r = n->right;
+			n->free(*this);
+			done = true;
+			if(r == nullptr)
+				return l;
+			Segment *m;
+			r = removeMin(r, m);
+			m->left = l;
+			m->right = r;
+			return balance(m);
+		}
+		return balance(n);
+	}
+
+	Segment *_root;
+	int _cnt;
+};
+
+} }	// elm::stree
+
+#endif /* ELM_STREE_INTERVALTREE_H_ */
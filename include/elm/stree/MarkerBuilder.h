@@ -22,6 +22,7 @@
 #define ELM_STREE_MARKERBUILDER_H_
 
 #include <elm/stree/Builder.h>
+#include <elm/stree/FlatTree.h>
 #include <elm/avl/Map.h>
 
 namespace elm { namespace stree {
@@ -58,6 +59,23 @@ public:
 		tree.set(root, nodes);
 	}
 
+	void make(stree::FlatTree<K, T, C>& tree) {
+		tree.prepare(marks.count() < 2 ? 0 : marks.count() - 1);
+		int i = 0;
+		if(marks.count() < 2) {
+			tree.complete();
+			return;
+		}
+		auto iter = marks.pairs().begin();
+		Pair<K, T> l = *iter;
+		for(iter++; iter(); iter++) {
+			Pair<K, T> u = *iter;
+			tree.put(i++, l.fst, u.fst, l.snd);
+			l = u;
+		}
+		tree.complete();
+	}
+
 private:
 	avl::Map<K, T, C> marks;
 };
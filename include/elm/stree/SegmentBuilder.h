@@ -22,6 +22,7 @@
 #define ELM_STREE_SEGMENTBUILDER_H_
 
 #include <elm/stree/Builder.h>
+#include <elm/stree/FlatTree.h>
 #include <elm/avl/Map.h>
 
 namespace elm { namespace stree {
@@ -45,45 +46,18 @@ public:
 	}
 
 	void make(stree::Tree<K, T, C>& tree) {
-
-		// count the nodes
-		int cnt = 0;
-		{
-			iter_t iter(segs);
-			if(!iter)
-				return;
-			cnt++;
-			K p = iter.item().fst.snd;
-			iter++;
-			while(iter()) {
-				if(C::compare(iter.item().fst.fst, p) != 0)
-					cnt++;
-				p = iter.item().fst.snd;
-				cnt++;
-				iter++;
-			}
-		}
+		if(segs.isEmpty())
+			return;
 
 		// allocate the memory
-		node_t *nodes = Builder<K, T, C>::allocate(cnt);
+		node_t *nodes = Builder<K, T, C>::allocate(count());
 
 		// insert the bounds
 		int i = 0;
-		iter_t iter(segs);
-		nodes[i] = node_t(iter.item().fst.fst, iter.item().fst.snd);
-		nodes[i++].data = iter.item().snd;
-		K p = iter.item().fst.snd;
-		iter++;
-		while(iter()) {
-			if(C::compare(iter.item().fst.fst, p) != 0) {
-				nodes[i] = node_t(p, iter.item().fst.fst);
-				nodes[i++].data = _def;
-			}
-			nodes[i] = node_t(iter.item().fst.fst, iter.item().fst.snd);
-			nodes[i++].data = iter.item().snd;
-			p = iter.item().fst.snd;
-			iter++;
-		}
+		scan([&](const K& l, const K& u, const T& v) {
+			nodes[i] = node_t(l, u);
+			nodes[i++].data = v;
+		});
 
 		// build the tree
 		int root = Builder<K, T, C>::make(nodes, i, 0, i - 1);
@@ -92,7 +66,37 @@ public:
 		tree.set(root, nodes);
 	}
 
+	void make(stree::FlatTree<K, T, C>& tree) {
+		tree.prepare(count());
+		int i = 0;
+		scan([&](const K& l, const K& u, const T& v) { tree.put(i++, l, u, v); });
+		tree.complete();
+	}
+
 private:
+
+	int count(void) {
+		int cnt = 0;
+		scan([&](const K&, const K&, const T&) { cnt++; });
+		return cnt;
+	}
+
+	template <class F> void scan(F f) {
+		iter_t iter(segs);
+		if(!iter)
+			return;
+		f(iter.item().fst.fst, iter.item().fst.snd, iter.item().snd);
+		K p = iter.item().fst.snd;
+		iter++;
+		while(iter()) {
+			if(C::compare(iter.item().fst.fst, p) != 0)
+				f(p, iter.item().fst.fst, _def);
+			f(iter.item().fst.fst, iter.item().fst.snd, iter.item().snd);
+			p = iter.item().fst.snd;
+			iter++;
+		}
+	}
+
 	map_t segs;
 	T _def;
 };
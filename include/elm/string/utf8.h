@@ -55,6 +55,33 @@ private:
 	char_t c;
 };
 
+// bulk operations
+bool isValid(const char *s, t::size n);
+bool isASCII(const char *s, t::size n);
+t::size count(const char *s, t::size n);
+t::size toUTF16(const char *s, t::size n, t::uint16 *buf);
+t::size toUTF32(const char *s, t::size n, char_t *buf);
+t::size fromUTF16(const t::uint16 *s, t::size n, char *buf);
+t::size fromUTF32(const char_t *s, t::size n, char *buf);
+string fromUTF16(const t::uint16 *s, t::size n);
+string fromUTF32(const char_t *s, t::size n);
+
+inline bool isValid(const char *s) { return isValid(s, cstring(s).length()); }
+inline bool isValid(cstring s) { return isValid(s.chars(), s.length()); }
+inline bool isValid(const string& s) { return isValid(s.chars(), s.length()); }
+inline bool isASCII(const char *s) { return isASCII(s, cstring(s).length()); }
+inline bool isASCII(cstring s) { return isASCII(s.chars(), s.length()); }
+inline bool isASCII(const string& s) { return isASCII(s.chars(), s.length()); }
+inline t::size count(const char *s) { return count(s, cstring(s).length()); }
+inline t::size count(cstring s) { return count(s.chars(), s.length()); }
+inline t::size count(const string& s) { return count(s.chars(), s.length()); }
+inline t::size toUTF16(const char *s, t::uint16 *buf) { return toUTF16(s, cstring(s).length(), buf); }
+inline t::size toUTF16(cstring s, t::uint16 *buf) { return toUTF16(s.chars(), s.length(), buf); }
+inline t::size toUTF16(const string& s, t::uint16 *buf) { return toUTF16(s.chars(), s.length(), buf); }
+inline t::size toUTF32(const char *s, char_t *buf) { return toUTF32(s, cstring(s).length(), buf); }
+inline t::size toUTF32(cstring s, char_t *buf) { return toUTF32(s.chars(), s.length(), buf); }
+inline t::size toUTF32(const string& s, char_t *buf) { return toUTF32(s.chars(), s.length(), buf); }
+
 } }	// elm::utf8
 
 #endif	// ELM_STRING_UTF8
@@ -0,0 +1,84 @@
+/*
+ *	sys::Atomic class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_ATOMIC_H_
+#define ELM_SYS_ATOMIC_H_
+
+#include <atomic>
+
+namespace elm { namespace sys {
+
+typedef std::memory_order memory_order_t;
+const memory_order_t RELAXED = std::memory_order_relaxed;
+const memory_order_t ACQUIRE = std::memory_order_acquire;
+const memory_order_t RELEASE = std::memory_order_release;
+const memory_order_t ACQ_REL = std::memory_order_acq_rel;
+const memory_order_t SEQ_CST = std::memory_order_seq_cst;
+
+inline void fence(memory_order_t order = SEQ_CST) { std::atomic_thread_fence(order); }
+
+inline void pause(void) {
+#	if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#	elif defined(__aarch64__)
+		asm volatile("yield");
+#	endif
+}
+
+template <class T>
+class Atomic {
+public:
+	typedef T t;
+	inline constexpr Atomic(T x = T()): _v(x) { }
+	Atomic(const Atomic&) = delete;
+	Atomic& operator=(const Atomic&) = delete;
+
+	inline T load(memory_order_t order = SEQ_CST) const { return _v.load(order); }
+	inline void store(T x, memory_order_t order = SEQ_CST) { _v.store(x, order); }
+	inline T exchange(T x, memory_order_t order = SEQ_CST) { return _v.exchange(x, order); }
+	inline bool compareExchange(T& expected, T desired, memory_order_t order = SEQ_CST)
+		{ return _v.compare_exchange_strong(expected, desired, order); }
+	inline bool compareExchangeWeak(T& expected, T desired, memory_order_t order = SEQ_CST)
+		{ return _v.compare_exchange_weak(expected, desired, order); }
+
+	inline T fetchAdd(T x, memory_order_t order = SEQ_CST) { return _v.fetch_add(x, order); }
+	inline T fetchSub(T x, memory_order_t order = SEQ_CST) { return _v.fetch_sub(x, order); }
+	inline T fetchAnd(T x, memory_order_t order = SEQ_CST) { return _v.fetch_and(x, order); }
+	inline T fetchOr(T x, memory_order_t order = SEQ_CST) { return _v.fetch_or(x, order); }
+	inline T fetchXor(T x, memory_order_t order = SEQ_CST) { return _v.fetch_xor(x, order); }
+
+	inline operator T(void) const { return load(); }
+	inline Atomic& operator=(T x) { store(x); return *this; }
+	inline T operator++(void) { return fetchAdd(1) + 1; }
+	inline T operator++(int) { return fetchAdd(1); }
+	inline T operator--(void) { return fetchSub(1) - 1; }
+	inline T operator--(int) { return fetchSub(1); }
+	inline T operator+=(T x) { return fetchAdd(x) + x; }
+	inline T operator-=(T x) { return fetchSub(x) - x; }
+
+	inline std::atomic<T>& base(void) { return _v; }
+
+private:
+	std::atomic<T> _v;
+};
+
+} }	// elm::sys
+
+#endif /* ELM_SYS_ATOMIC_H_ */
@@ -0,0 +1,57 @@
+/*
+ *	sys::Barrier and sys::Latch classes interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_BARRIER_H_
+#define ELM_SYS_BARRIER_H_
+
+#include <elm/sys/Futex.h>
+
+namespace elm { namespace sys {
+
+class Barrier {
+public:
+	inline Barrier(int count): _count(count), _left(count), _gen(0) { }
+	Barrier(const Barrier&) = delete;
+	Barrier& operator=(const Barrier&) = delete;
+	inline int count(void) const { return _count; }
+	bool wait(void);
+private:
+	int _count;
+	Atomic<int> _left;
+	Futex::word_t _gen;
+};
+
+class Latch {
+public:
+	inline Latch(int count): _count(count) { }
+	Latch(const Latch&) = delete;
+	Latch& operator=(const Latch&) = delete;
+	inline int count(void) const { return _count.load(ACQUIRE); }
+	inline bool tryWait(void) const { return _count.load(ACQUIRE) == 0; }
+	void countDown(int n = 1);
+	void wait(void);
+	inline void arriveAndWait(void) { countDown(); wait(); }
+private:
+	Futex::word_t _count;
+};
+
+} }	// elm::sys
+
+#endif /* ELM_SYS_BARRIER_H_ */
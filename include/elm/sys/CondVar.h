@@ -0,0 +1,48 @@
+/*
+ *	sys::CondVar class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_CONDVAR_H_
+#define ELM_SYS_CONDVAR_H_
+
+#include <elm/sys/Mutex.h>
+
+namespace elm { namespace sys {
+
+class CondVar {
+public:
+	inline constexpr CondVar(void): _seq(0), _waiters(0) { }
+	CondVar(const CondVar&) = delete;
+	CondVar& operator=(const CondVar&) = delete;
+
+	void wait(Mutex& mutex);
+	template <class P> inline void wait(Mutex& mutex, P pred)
+		{ while(!pred()) wait(mutex); }
+	inline void notify(void) { if(_waiters.load(RELAXED) != 0) wake(1); }
+	inline void notifyAll(void) { if(_waiters.load(RELAXED) != 0) wake(-1); }
+
+private:
+	void wake(int count);
+	Futex::word_t _seq;
+	Atomic<int> _waiters;
+};
+
+} }	// elm::sys
+
+#endif /* ELM_SYS_CONDVAR_H_ */
@@ -0,0 +1,63 @@
+/*
+ *	sys::Futex class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_FUTEX_H_
+#define ELM_SYS_FUTEX_H_
+
+#include <elm/io.h>
+#include <elm/sys/Atomic.h>
+
+namespace elm { namespace sys {
+
+class Futex {
+public:
+	typedef Atomic<t::uint32> word_t;
+	static void wait(word_t& word, t::uint32 value);
+	static void wake(word_t& word, int count = 1);
+	static void wakeAll(word_t& word);
+};
+
+class LockStats {
+public:
+	typedef enum {
+		SPINLOCK = 0,
+		MUTEX,
+		RWLOCK,
+		CONDVAR,
+		BARRIER,
+		LATCH,
+		ONCE,
+		KIND_COUNT
+	} kind_t;
+	static void enable(bool enabled = true);
+	static inline bool isEnabled(void) { return _enabled.load(RELAXED); }
+	static void record(kind_t kind, t::uint64 wait);
+	static t::uint64 count(kind_t kind);
+	static t::uint64 total(kind_t kind);
+	static t::uint64 max(kind_t kind);
+	static void reset(void);
+	static void print(io::Output& out);
+private:
+	static Atomic<bool> _enabled;
+};
+
+} }	// elm::sys
+
+#endif /* ELM_SYS_FUTEX_H_ */
@@ -21,6 +21,7 @@
 #ifndef ELM_SYS_JOBSCHEDULER_H_
 #define ELM_SYS_JOBSCHEDULER_H_
 
+#include <elm/sys/CondVar.h>
 #include <elm/sys/Thread.h>
 
 namespace elm { namespace sys {
@@ -66,8 +67,9 @@ private:
 	void init(void);
 	virtual void run(void);
 	JobProducer *prod;
-	Mutex *mutex;
-	int cnt;
+	Mutex mutex;
+	CondVar cond;
+	int cnt, active;
 	Thread **thds;
 	enum {
 		WAIT = 0,
@@ -0,0 +1,62 @@
+/*
+ *	sys::Mutex class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_MUTEX_H_
+#define ELM_SYS_MUTEX_H_
+
+#include <elm/sys/Futex.h>
+#include <elm/sys/SpinLock.h>
+
+namespace elm { namespace sys {
+
+class CondVar;
+
+class Mutex {
+	friend class CondVar;
+public:
+	static const int SPIN_COUNT = 100;
+
+	inline constexpr Mutex(void): _state(FREE) { }
+	Mutex(const Mutex&) = delete;
+	Mutex& operator=(const Mutex&) = delete;
+
+	inline void lock(void)
+		{ t::uint32 s = FREE; if(!_state.compareExchange(s, LOCKED, ACQUIRE)) lockSlow(); }
+	inline bool tryLock(void)
+		{ t::uint32 s = FREE; return _state.compareExchange(s, LOCKED, ACQUIRE); }
+	inline void unlock(void)
+		{ if(_state.exchange(FREE, RELEASE) == CONTENDED) Futex::wake(_state); }
+	inline bool isLocked(void) const { return _state.load(RELAXED) != FREE; }
+
+	static Mutex *make(void);
+
+private:
+	static const t::uint32
+		FREE = 0,
+		LOCKED = 1,
+		CONTENDED = 2;
+	void lockSlow(void);
+	void lockContended(void);
+	Futex::word_t _state;
+};
+
+} }	// elm::sys
+
+#endif /* ELM_SYS_MUTEX_H_ */
@@ -0,0 +1,63 @@
+/*
+ *	sys::Once class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_ONCE_H_
+#define ELM_SYS_ONCE_H_
+
+#include <elm/sys/Futex.h>
+
+namespace elm { namespace sys {
+
+class Once {
+public:
+	inline constexpr Once(void): _state(NONE) { }
+	Once(const Once&) = delete;
+	Once& operator=(const Once&) = delete;
+
+	inline bool isDone(void) const { return _state.load(ACQUIRE) == DONE; }
+
+	template <class F>
+	inline void call(F f) {
+		if(isDone() || !enter())
+			return;
+		try {
+			f();
+		}
+		catch(...) {
+			abort();
+			throw;
+		}
+		leave();
+	}
+
+private:
+	static const t::uint32
+		NONE = 0,
+		RUNNING = 1,
+		DONE = 2;
+	bool enter(void);
+	void leave(void);
+	void abort(void);
+	Futex::word_t _state;
+};
+
+} }	// elm::sys
+
+#endif /* ELM_SYS_ONCE_H_ */
@@ -55,11 +55,15 @@ public:
 	void resetPaths(void);
 	Plugin *plug(const string& path);
 	Plugin *plugFile(sys::Path path);
+	bool plugAll(const Vector<string>& names, Vector<Plugin *>& plugins, int thread_count = 0);
 	inline String hook(void) const { return _hook; }
 	string getLastError(void);
 	inline bool quiet(void) const { return _quiet; }
 	inline void setQuiet(bool quiet) { _quiet = quiet; }
 	bool isPlugged(string name) const;
+	void useIndex(sys::Path path = "");
+	void saveIndex(void);
+	inline bool isIndexed(void) const { return _index != nullptr; }
 
 	// deprecated
 	virtual void onError(String message);
@@ -99,6 +103,9 @@ public:
 	};
 
 private:
+	class Index;
+	class ELD;
+	class Loader;
 
 	static Vector<Plugger *> pluggers;
 	CString _hook;
@@ -107,11 +114,14 @@ private:
 	Vector<String> _paths;
 	error_t err;
 	bool _quiet;
+	Index *_index;
 	static void leave(Plugin *plugin);
-	Plugin *plug(Plugin *plugin, void *handle);
+	Plugin *plug(Plugin *plugin, void *handle, bool started = false);
 	inline Vector<Plugin *>& statics(void) { return Plugin::static_plugins; }
 	void onError(error_level_t level, const string& message);
 	Plugin *lookELD(const Path& path, error_t& err, Vector<Plugin *>& deps);
+	void getELD(const sys::Path& path, ELD& eld);
+	Plugin *open(const sys::Path& path, void *& handle, error_t& err, string& msg) const;
 
 	// portability functions
 	static void *link(sys::Path lib);
@@ -90,7 +90,7 @@ protected:
 	Version _plugin_version;
 
 private:
-	void plug(void *handle);
+	void plug(void *handle, bool started = false);
 	static void step(void);
 	static Plugin *get(cstring hook, const string& name);
 	void setPath(const Path& path) { _path = path; }
@@ -31,6 +31,7 @@ public:
 	virtual int returnCode(void) = 0;
 	virtual void kill(void) = 0;
 	virtual void wait(void) = 0;
+	virtual int id(void);
 };
 
 } } // elm::system
@@ -0,0 +1,61 @@
+/*
+ *	ProcessMonitor class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_PROCESS_MONITOR_H
+#define ELM_SYS_PROCESS_MONITOR_H
+
+#include <functional>
+#include <elm/data/Vector.h>
+#include <elm/sys/Process.h>
+
+namespace elm { namespace sys {
+
+// ProcessMonitor class
+class ProcessMonitor {
+public:
+	typedef std::function<void(Process& process)> handler_t;
+
+	ProcessMonitor(void);
+	ProcessMonitor(const ProcessMonitor&) = delete;
+	ProcessMonitor& operator=(const ProcessMonitor&) = delete;
+	~ProcessMonitor(void);
+
+	inline int count(void) const { return _entries.count(); }
+	inline bool isEmpty(void) const { return _entries.isEmpty(); }
+	inline operator bool(void) const { return !isEmpty(); }
+
+	void watch(Process& process, handler_t handler);
+	int poll(int timeout = -1);
+	void waitAll(void);
+	void wake(void);
+
+private:
+	typedef struct entry_t {
+		Process *process;
+		handler_t handler;
+		int fd;
+	} entry_t;
+	Vector<entry_t *> _entries;
+	int _wake[2];
+};
+
+} }	// elm::sys
+
+#endif	// ELM_SYS_PROCESS_MONITOR_H
@@ -0,0 +1,79 @@
+/*
+ *	ProcessPool class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_PROCESS_POOL_H
+#define ELM_SYS_PROCESS_POOL_H
+
+#include <elm/data/Vector.h>
+#include <elm/sys/CondVar.h>
+#include <elm/sys/ProcessBuilder.h>
+#include <elm/sys/ProcessMonitor.h>
+#include <elm/sys/Thread.h>
+
+namespace elm { namespace sys {
+
+// ProcessPool class
+class ProcessPool {
+public:
+
+	class Job {
+		friend class ProcessPool;
+	public:
+		~Job(void);
+		SystemInStream& output(void);
+		int wait(void);
+		bool isDone(void);
+		inline const string& error(void) const { return _error; }
+	private:
+		Job(ProcessPool& pool, const ProcessBuilder& builder, bool capture);
+		ProcessPool& _pool;
+		ProcessBuilder _builder;
+		Process *_process;
+		SystemInStream *_out;
+		string _error;
+		int _code;
+		bool _capture, _started, _done;
+	};
+
+	ProcessPool(int count = 0);
+	ProcessPool(const ProcessPool&) = delete;
+	ProcessPool& operator=(const ProcessPool&) = delete;
+	~ProcessPool(void);
+
+	inline int count(void) const { return _count; }
+	Job *submit(const ProcessBuilder& builder, bool capture = true);
+	void waitAll(void);
+
+private:
+	class Driver;
+	void start(Job *job);
+	int _count, _running, _head;
+	bool _stop;
+	Mutex _lock;
+	CondVar _cond;
+	Vector<Job *> _queue;
+	ProcessMonitor _monitor;
+	Driver *_driver;
+	Thread *_thread;
+};
+
+} }	// elm::sys
+
+#endif	// ELM_SYS_PROCESS_POOL_H
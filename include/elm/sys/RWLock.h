@@ -0,0 +1,82 @@
+/*
+ *	sys::RWLock class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_RWLOCK_H_
+#define ELM_SYS_RWLOCK_H_
+
+#include <elm/sys/Futex.h>
+
+namespace elm { namespace sys {
+
+class RWLock {
+public:
+	inline constexpr RWLock(void): _state(0), _seq(0), _waiters(0), _writers(0) { }
+	RWLock(const RWLock&) = delete;
+	RWLock& operator=(const RWLock&) = delete;
+
+	inline void lockRead(void) {
+		t::uint32 s = _state.load(RELAXED);
+		if((s & WRITER) != 0 || _writers.load(RELAXED) != 0 || !_state.compareExchangeWeak(s, s + 1, ACQUIRE))
+			lockReadSlow();
+	}
+	inline void unlockRead(void)
+		{ if(_state.fetchSub(1, RELEASE) == 1) wake(); }
+	inline void lockWrite(void)
+		{ t::uint32 s = 0; if(!_state.compareExchange(s, WRITER, ACQUIRE)) lockWriteSlow(); }
+	inline void unlockWrite(void)
+		{ _state.store(0, RELEASE); wake(); }
+	inline bool tryLockRead(void) {
+		t::uint32 s = _state.load(RELAXED);
+		return (s & WRITER) == 0 && _state.compareExchange(s, s + 1, ACQUIRE);
+	}
+	inline bool tryLockWrite(void)
+		{ t::uint32 s = 0; return _state.compareExchange(s, WRITER, ACQUIRE); }
+	inline int readers(void) const { return _state.load(RELAXED) & ~WRITER; }
+	inline bool isWriteLocked(void) const { return (_state.load(RELAXED) & WRITER) != 0; }
+
+	class ReadGuard {
+	public:
+		inline ReadGuard(RWLock& lock): _lock(lock) { _lock.lockRead(); }
+		inline ~ReadGuard(void) { _lock.unlockRead(); }
+	private:
+		RWLock& _lock;
+	};
+
+	class WriteGuard {
+	public:
+		inline WriteGuard(RWLock& lock): _lock(lock) { _lock.lockWrite(); }
+		inline ~WriteGuard(void) { _lock.unlockWrite(); }
+	private:
+		RWLock& _lock;
+	};
+
+private:
+	static const t::uint32 WRITER = 0x80000000;
+	inline void wake(void) { fence(); if(_waiters.load(RELAXED) != 0) wakeSlow(); }
+	void lockReadSlow(void);
+	void lockWriteSlow(void);
+	void wakeSlow(void);
+	Futex::word_t _state, _seq;
+	Atomic<int> _waiters, _writers;
+};
+
+} }	// elm::sys
+
+#endif /* ELM_SYS_RWLOCK_H_ */
@@ -0,0 +1,57 @@
+/*
+ *	sys::SpinLock class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_SYS_SPINLOCK_H_
+#define ELM_SYS_SPINLOCK_H_
+
+#include <elm/sys/Atomic.h>
+
+namespace elm { namespace sys {
+
+class SpinLock {
+public:
+	inline constexpr SpinLock(void): _locked(false) { }
+	SpinLock(const SpinLock&) = delete;
+	SpinLock& operator=(const SpinLock&) = delete;
+
+	inline void lock(void) { if(_locked.exchange(true, ACQUIRE)) lockSlow(); }
+	inline bool tryLock(void) { return !_locked.load(RELAXED) && !_locked.exchange(true, ACQUIRE); }
+	inline void unlock(void) { _locked.store(false, RELEASE); }
+	inline bool isLocked(void) const { return _locked.load(RELAXED); }
+
+private:
+	void lockSlow(void);
+	Atomic<bool> _locked;
+};
+
+template <class L>
+class Guard {
+public:
+	inline Guard(L& lock): _lock(lock) { _lock.lock(); }
+	inline ~Guard(void) { _lock.unlock(); }
+	Guard(const Guard&) = delete;
+	Guard& operator=(const Guard&) = delete;
+private:
+	L& _lock;
+};
+
+} }	// elm::sys
+
+#endif /* ELM_SYS_SPINLOCK_H_ */
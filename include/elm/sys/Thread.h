@@ -21,6 +21,7 @@
 #ifndef ELM_SYSTEM_THREAD_H_
 #define ELM_SYSTEM_THREAD_H_
 
+#include <elm/sys/Mutex.h>
 #include <elm/sys/SystemException.h>
 #include <elm/util/MessageException.h>
 
@@ -81,16 +82,6 @@ protected:
 
 inline Runnable& Runnable::current(void) { return Thread::current()->runnable(); }
 
-
-class Mutex {
-public:
-	static Mutex *make(void);
-	virtual ~Mutex(void);
-	virtual void lock(void) = 0;
-	virtual void unlock(void) = 0;
-	virtual bool tryLock(void) = 0;
-};
-
 } }	// elm::sys
 
 #endif /* ELM_SYSTEM_THREAD_H_ */
@@ -28,6 +28,8 @@
 
 namespace elm {
 
+namespace json { class Saver; }
+
 // TestCase class
 class TestCase {
 	CString _name;
@@ -37,7 +39,7 @@ public:
 	TestCase(CString name);
 	void initialize(void);
 	virtual ~TestCase(void);
-	inline cstring name(void) { return _name; }
+	inline cstring name(void) const { return _name; }
 	void perform(cstring file, int line, cstring action);
 	void test(CString file, int line, CString text);
 	void failed(void);
@@ -53,9 +55,10 @@ public:
 			cout << '\t' << result << " != " << reference << "\n";
 	}
 
-	void prepare(void);
-	void complete(void);
+	virtual void prepare(void);
+	virtual void complete(void);
 	void perform(void);
+	virtual bool isBenchmark(void) const { return false; }
 	inline bool isSuccessful(void) const { return errors == 0; }
 	inline bool hasFailed(void) const { return errors != 0; }
 	inline bool isFullPath() const { return full_path; }
@@ -85,6 +88,64 @@ private:
 };
 
 
+// Benchmark class
+class Benchmark: public TestCase {
+public:
+	static const int SAMPLES = 30;
+	static const int MIN_SAMPLES = 5;
+	static const int WARMUP = 3;
+	static const t::uint64 SAMPLE_TIME = 2000000;
+	static const t::uint64 MAX_TIME = 1000000000;
+
+	typedef struct result_t {
+		cstring label;
+		t::uint64 iterations;
+		int samples;
+		double median, p99, mad, mean, min;
+	} result_t;
+
+	Benchmark(cstring name);
+	inline const List<result_t>& results(void) const { return _results; }
+	void prepare(void) override;
+	void complete(void) override;
+	bool isBenchmark(void) const override { return true; }
+	void save(json::Saver& saver) const;
+
+	template <class T> static inline void doNotOptimize(const T& x) {
+#		if defined(__GNUC__)
+			asm volatile("" : : "r,m"(x) : "memory");
+#		else
+			sink(&x);
+#		endif
+	}
+	static inline void clobberMemory(void) {
+#		if defined(__GNUC__)
+			asm volatile("" : : : "memory");
+#		else
+			sink(nullptr);
+#		endif
+	}
+
+	class Run {
+	public:
+		Run(Benchmark& bench, cstring label);
+		inline bool operator()(void) { if(_left != 0) { _left--; return true; } else return next(); }
+	private:
+		bool next(void);
+		void finish(void);
+		Benchmark& _bench;
+		cstring _label;
+		t::uint64 _left, _batch, _start, _total, _iters;
+		int _state, _count, _n;
+		double _samples[SAMPLES];
+	};
+
+private:
+	static void sink(const void *p);
+	List<result_t> _results;
+};
+
+
 // Macros
 //#define ELM_CHECK_MAKE(name, actions) class name##Test: public { name##Test(void)
 #define ELM_CHECK_BEGIN(name)	{ elm::TestCase __case(name); __case.prepare();
@@ -109,6 +170,16 @@ private:
 #define ELM_TEST_END \
 		} \
 	} __test;
+#define ELM_BENCH_BEGIN(name) \
+	static class name##Bench: public elm::Benchmark { \
+	public: \
+		name##Bench(void): elm::Benchmark(#name) { } \
+	protected: \
+		virtual void execute(void) {
+#define ELM_BENCH(label)		for(elm::Benchmark::Run __run(*this, label); __run(); )
+#define ELM_BENCH_END \
+		} \
+	} __bench;
 #define ELM_TEST_MAIN int main(int argc, const char **argv) { return TestSet::def.run(argc, argv); }
 
 // shortcuts
@@ -126,6 +197,9 @@ private:
 #	define TEST_END	 ELM_TEST_END
 #	define CHECK_RETURN	ELM_CHECK_RETURN
 #	define TEST_MAIN ELM_TEST_MAIN
+#	define BENCH_BEGIN(name) ELM_BENCH_BEGIN(name)
+#	define BENCH(label) ELM_BENCH(label)
+#	define BENCH_END ELM_BENCH_END
 #endif
 
 } // elm
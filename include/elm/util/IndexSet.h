@@ -0,0 +1,178 @@
+/*
+ *	IndexSet class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ * 
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software 
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_UTIL_INDEXSET_H_
+#define ELM_UTIL_INDEXSET_H_
+
+#include <elm/assert.h>
+#include <elm/io.h>
+#include <elm/PreIterator.h>
+#include <elm/util/BitVector.h>
+
+namespace elm {
+
+// IndexSet class
+class IndexSet {
+	typedef t::uint64 word_t;
+	typedef t::uint32 index_t;
+public:
+	static const int MIN_CAP = 4;
+
+	inline IndexSet(void): _size(0), _cnt(0), _cap(0), _dense(false), _ids(nullptr) { }
+	IndexSet(int size, bool set = false);
+	IndexSet(const IndexSet& set);
+	IndexSet(const BitVector& vec);
+	inline ~IndexSet(void) { release(); }
+
+	inline int size(void) const { return _size; }
+	inline bool isDense(void) const { return _dense; }
+	inline bool isEmpty(void) const { return _cnt == 0; }
+	inline int countOnes(void) const { return _cnt; }
+	inline int countBits(void) const { return _cnt; }
+	inline int countZeroes(void) const { return _size - _cnt; }
+
+	inline bool bit(int i) const {
+		ASSERTP(0 <= i && i < _size, "index out of bounds");
+		if(_dense)
+			return (_bits[i >> 6] >> (i & 63)) & 1;
+		int p = find(i);
+		return p < _cnt && _ids[p] == index_t(i);
+	}
+	void set(int i);
+	void clear(int i);
+	inline void set(int i, bool value) { if(value) set(i); else clear(i); }
+	void set(void);
+	void clear(void);
+	void copy(const IndexSet& set);
+
+	bool includes(const IndexSet& set) const;
+	inline bool includesStrictly(const IndexSet& set) const { return _cnt > set._cnt && includes(set); }
+	inline bool equals(const IndexSet& set) const { return _cnt == set._cnt && includes(set); }
+	bool meets(const IndexSet& set) const;
+
+	void applyNot(void);
+	void applyOr(const IndexSet& set);
+	void applyAnd(const IndexSet& set);
+	void applyReset(const IndexSet& set);
+	inline IndexSet makeNot(void) const { IndexSet r(*this); r.applyNot(); return r; }
+	inline IndexSet makeOr(const IndexSet& set) const { IndexSet r(*this); r.applyOr(set); return r; }
+	inline IndexSet makeAnd(const IndexSet& set) const { IndexSet r(*this); r.applyAnd(set); return r; }
+	inline IndexSet makeReset(const IndexSet& set) const { IndexSet r(*this); r.applyReset(set); return r; }
+
+	BitVector toBitVector(void) const;
+	void print(io::Output& out) const;
+
+	// Iter class
+	class Iter: public PreIterator<Iter, int> {
+	public:
+		inline Iter(void): _s(nullptr), _i(0), _w(0), _v(-1) { }
+		inline Iter(const IndexSet& s): _s(&s), _i(-1), _w(0), _v(-1) { next(); }
+		inline bool ended(void) const { return _v < 0; }
+		inline int item(void) const { return _v; }
+		inline void next(void) {
+			if(!_s->_dense) {
+				_i++;
+				_v = _i < _s->_cnt ? int(_s->_ids[_i]) : -1;
+			}
+			else {
+				while(_w == 0) {
+					if(++_i >= _s->words()) {
+						_v = -1;
+						return;
+					}
+					_w = _s->_bits[_i];
+				}
+				_v = (_i << 6) + __builtin_ctzll(_w);
+				_w &= _w - 1;
+			}
+		}
+		inline bool equals(const Iter& i) const { return _v == i._v; }
+	private:
+		const IndexSet *_s;
+		int _i;
+		word_t _w;
+		int _v;
+	};
+	typedef Iter OneIterator;
+	inline Iter begin(void) const { return Iter(*this); }
+	inline Iter end(void) const { return Iter(); }
+
+	// Ref delegate
+	class Ref {
+	public:
+		inline Ref(IndexSet& s, int i): _s(s), _i(i) { }
+		inline bool get(void) const { return _s.bit(_i); }
+		inline void set(void) { _s.set(_i); }
+		inline void clear(void) { _s.clear(_i); }
+		inline void set(bool b) { if(b) set(); else clear(); }
+		inline operator bool(void) const { return get(); }
+		inline Ref& operator=(bool b) { set(b); return *this;}
+	private:
+		IndexSet& _s;
+		int _i;
+	};
+
+	// operators
+	inline operator bool(void) const						{ return !isEmpty(); }
+	inline bool operator[](int i) const						{ return bit(i); }
+	inline Ref operator[](int i)							{ return Ref(*this, i); }
+	inline IndexSet operator~(void) const					{ return makeNot(); }
+	inline IndexSet operator|(const IndexSet& set) const	{ return makeOr(set); }
+	inline IndexSet operator&(const IndexSet& set) const	{ return makeAnd(set); }
+	inline IndexSet operator+(const IndexSet& set) const	{ return makeOr(set); }
+	inline IndexSet operator-(const IndexSet& set) const	{ return makeReset(set); }
+	inline IndexSet& operator=(const IndexSet& set)			{ copy(set); return *this; }
+	inline IndexSet& operator|=(const IndexSet& set)		{ applyOr(set); return *this; }
+	inline IndexSet& operator&=(const IndexSet& set)		{ applyAnd(set); return *this; }
+	inline IndexSet& operator+=(const IndexSet& set)		{ applyOr(set); return *this; }
+	inline IndexSet& operator-=(const IndexSet& set)		{ applyReset(set); return *this; }
+	inline bool operator==(const IndexSet& set) const		{ return equals(set); }
+	inline bool operator!=(const IndexSet& set) const		{ return !equals(set); }
+	inline bool operator<(const IndexSet& set) const		{ return set.includesStrictly(*this); }
+	inline bool operator<=(const IndexSet& set) const		{ return set.includes(*this); }
+	inline bool operator>(const IndexSet& set) const		{ return includesStrictly(set); }
+	inline bool operator>=(const IndexSet& set) const		{ return includes(set); }
+
+	inline t::size __size(void) const
+		{ return sizeof(*this) + (_dense ? words() * sizeof(word_t) : _cap * sizeof(index_t)); }
+
+private:
+	inline int words(void) const { return (_size + 63) >> 6; }
+	inline int limit(void) const { return (_size + 31) >> 5; }
+	int find(int i) const;
+	void release(void);
+	void toDense(void);
+	void toSparse(void);
+	void recount(void);
+
+	int _size, _cnt, _cap;
+	bool _dense;
+	union {
+		index_t *_ids;
+		word_t *_bits;
+	};
+};
+
+inline io::Output& operator<<(io::Output& out, const IndexSet& set)
+	{ set.print(out); return out; }
+
+}	// elm
+
+#endif /* ELM_UTIL_INDEXSET_H_ */
@@ -31,6 +31,7 @@
 #include <elm/xom/Node.h>
 #include <elm/xom/NodeFactory.h>
 #include <elm/xom/ParentNode.h>
+#include <elm/xom/Reader.h>
 #include <elm/xom/String.h>
 #include <elm/xom/Text.h>
 
@@ -39,6 +39,13 @@ public:
 	virtual void setRootElement(Element *root);
 	virtual String toString(void);
 	virtual String toXML(void);
+
+	// Non-XOM methods
+	String store(const char_t *str);
+
+private:
+	class Arena;
+	Arena *_arena;
 };
 
 } } // elm::xom
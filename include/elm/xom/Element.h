@@ -40,6 +40,8 @@ public:
 	virtual int	getAttributeCount(void);
 	virtual Option<String> getAttributeValue(String name);
 	virtual Option<String> getAttributeValue(String localName, String ns);
+	Option<String> getAttributeView(String name);
+	Option<String> getAttributeView(String localName, String ns);
 	virtual Elements *getChildElements(void);
 	virtual Elements *getChildElements(String name);
 	virtual Elements *getChildElements(String localName, String ns);
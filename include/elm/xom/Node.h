@@ -22,6 +22,7 @@
 #ifndef ELM_XOM_NODE_H
 #define ELM_XOM_NODE_H
 
+#include <cstddef>
 #include <elm/xom/String.h>
 
 namespace elm { namespace xom {
@@ -68,7 +69,17 @@ protected:
 	String internGetValue(void);
 	String internToXML(void);
 	static void freeNode(void *node);
+	static void modified(void *node, bool deep = false);
+	static bool inArena(const Node *node);
+	void disown(void);
+	static void release(void *node, bool disconnect);
+	static void drop(void *node, bool disconnect);
+	static String view(void *node);
 public:
+	static void *operator new(std::size_t size);
+	static void *operator new(std::size_t size, Document *doc);
+	static void operator delete(void *block);
+	static void operator delete(void *block, Document *doc);
 	virtual ~Node(void);
 	inline void *getNode(void) const;
 
@@ -88,6 +99,7 @@ public:
 
 	// Non-XOM methods
 	int line(void) const;
+	String getValueView(void);
 };
 
 
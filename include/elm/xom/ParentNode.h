@@ -7,16 +7,19 @@
 #ifndef ELM_XOM_PARENT_NODE_H
 #define ELM_XOM_PARENT_NODE_H
 
+#include <atomic>
 #include <elm/xom/Node.h>
 
 namespace elm { namespace xom {
 
 // ParentNode class
 class ParentNode: public Node {
+	friend class Node;
 protected:
-	inline ParentNode(void * node): Node(node) { };
+	inline ParentNode(void * node): Node(node), kids(nullptr) { };
 	void internSetBaseURI(String URI);
 public:
+	virtual ~ParentNode(void);
 	virtual void appendChild(Node *child);
 	virtual int	indexOf(Node *child);
 	virtual void insertChild(Node *child, int position);
@@ -28,6 +31,12 @@ public:
 	// Node overload
 	virtual Node *getChild(int index);
 	virtual int getChildCount(void);
+
+private:
+	class Children;
+	Children *children(void);
+	void invalidate(void);
+	std::atomic<Children *> kids;
 };
 
 } } // elm::xom
@@ -0,0 +1,82 @@
+/*
+ *	xom::Reader class interface
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef ELM_XOM_READER_H
+#define ELM_XOM_READER_H
+
+#include <elm/io/InStream.h>
+#include <elm/util/Option.h>
+#include <elm/xom/String.h>
+
+namespace elm { namespace xom {
+
+class Document;
+class NodeFactory;
+
+// Reader class
+class Reader {
+public:
+	typedef enum event_t {
+		NONE = 0,
+		START_ELEMENT,
+		END_ELEMENT,
+		TEXT,
+		COMMENT,
+		PROCESSING_INSTRUCTION
+	} event_t;
+
+	Reader(CString path, NodeFactory *factory = nullptr);
+	Reader(io::InStream& in, CString base_uri = "", NodeFactory *factory = nullptr);
+	~Reader(void);
+
+	bool next(void);
+	void skip(void);
+	inline event_t event(void) const { return _event; }
+	inline bool ended(void) const { return _event == NONE; }
+
+	int depth(void) const;
+	int line(void) const;
+	bool isEmpty(void) const;
+	String baseURI(void) const;
+	String name(void) const;
+	String localName(void) const;
+	String namespaceURI(void) const;
+	String value(void) const;
+
+	int attributeCount(void) const;
+	String attributeName(int index) const;
+	String attributeValue(int index) const;
+	Option<String> getAttributeValue(String name) const;
+
+	Document *expand(bool deep = true);
+
+private:
+	void init(void);
+	void check(int result);
+	void *reader;
+	NodeFactory *fact;
+	event_t _event;
+	bool pending;
+	int pres;
+};
+
+} } // elm::xom
+
+#endif // ELM_XOM_READER_H
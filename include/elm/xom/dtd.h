@@ -25,6 +25,7 @@
 #include <elm/data/List.h>
 #include <elm/io/InStream.h>
 #include <elm/xom.h>
+#include <elm/xom/Reader.h>
 
 namespace elm { namespace dtd {
 
@@ -44,6 +45,7 @@ class Parser {
 public:
 
 	static const t::uint32 CROP = 0x01;
+	static const int WINDOW = 64;
 
 	Parser(Factory& factory, Element& element, t::uint32 flags = CROP);
 
@@ -80,9 +82,13 @@ public:
 	void recordID(xom::String id, Element& element);
 
 	void parse(xom::Element *xelt);
+	void parse(xom::Reader& reader);
 
 private:
 	void setNode();
+	xom::Node *child(int i);
+	xom::Node *streamed(int i);
+	void release();
 
 	struct backpatch_t {
 		inline backpatch_t(AbstractAttribute *a, void *o, xom::Element *xe)
@@ -106,6 +112,11 @@ private:
 	t::uint32 _flags;
 	xom::Element *_last_error;
 	Vector<AbstractAttribute *> _posts;
+	xom::Reader *_reader;
+	xom::Document *_root;
+	Vector<xom::Node *> _window;
+	int _wbase;
+	bool _rend;
 };
 
 
@@ -186,6 +197,7 @@ public:
 	void parse(Factory& factory, xom::Document *doc, t::uint32 flags = Parser::CROP);
 	void parse(Factory& factory, string uri, t::uint32 flags = Parser::CROP);
 	void parse(Factory& factory, io::InStream& in, t::uint32 flags = Parser::CROP);
+	void parse(Factory& factory, xom::Reader& reader, t::uint32 flags = Parser::CROP);
 
 protected:
 	void reset() override;
@@ -0,0 +1,247 @@
+/*
+ *	checksum::CRC32C class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <string.h>
+#include <elm/checksum/CRC32C.h>
+#include <elm/io/IOException.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#	define ELM_CRC32C_SSE42
+#	include <nmmintrin.h>
+#endif
+
+namespace elm { namespace checksum {
+
+/**
+ * @class CRC32C
+ * Compute the CRC-32C (Castagnoli polynomial 0x1EDC6F41) of a sequence of bytes.
+ * This CRC is used by iSCSI, ext4 or Btrfs and, on x86 processors supporting
+ * SSE 4.2, it is computed by a dedicated instruction processing 8 bytes per cycle.
+ * On other processors, a table-driven algorithm consuming 8 bytes at a time
+ * (slicing-by-8) is used.
+ *
+ * As other checksum engines, data are passed with one of the put() functions
+ * or, as CRC32C is an @ref io::OutStream, by writing to it. The result is
+ * obtained with sum().
+ *
+ * @ingroup checksum
+ */
+
+
+// slicing-by-8 tables
+class CRC32CTable {
+public:
+	CRC32CTable(void) {
+		for(int i = 0; i < 256; i++) {
+			t::uint32 c = i;
+			for(int j = 0; j < 8; j++)
+				c = (c >> 1) ^ (c & 1 ? 0x82f63b78 : 0);
+			tab[0][i] = c;
+		}
+		for(int i = 0; i < 256; i++)
+			for(int k = 1; k < 8; k++)
+				tab[k][i] = (tab[k - 1][i] >> 8) ^ tab[0][tab[k - 1][i] & 0xff];
+	}
+	t::uint32 tab[8][256];
+};
+
+static const CRC32CTable& table(void) {
+	static CRC32CTable t;
+	return t;
+}
+
+
+#ifdef ELM_CRC32C_SSE42
+__attribute__((target("sse4.2")))
+static t::uint32 update_sse42(t::uint32 crc, const t::uint8 *p, int len) {
+	while(len > 0 && (t::intptr(p) & 7) != 0) {
+		crc = _mm_crc32_u8(crc, *p++);
+		len--;
+	}
+#	ifdef __x86_64__
+		t::uint64 c = crc;
+		for(; len >= 8; p += 8, len -= 8) {
+			t::uint64 v;
+			memcpy(&v, p, 8);
+			c = _mm_crc32_u64(c, v);
+		}
+		crc = t::uint32(c);
+#	else
+		for(; len >= 4; p += 4, len -= 4) {
+			t::uint32 v;
+			memcpy(&v, p, 4);
+			crc = _mm_crc32_u32(crc, v);
+		}
+#	endif
+	for(; len > 0; len--)
+		crc = _mm_crc32_u8(crc, *p++);
+	return crc;
+}
+#endif
+
+
+/**
+ * Build a CRC32C engine.
+ */
+CRC32C::CRC32C(void): crc(0xffffffff) {
+}
+
+
+/**
+ */
+CRC32C::~CRC32C(void) {
+}
+
+
+/**
+ * @fn t::uint32 CRC32C::sum(void) const;
+ * Get the CRC of the data put up to now. More data can be put after this call.
+ * @return	Current CRC.
+ */
+
+
+/**
+ * @fn void CRC32C::reset(void);
+ * Reset the CRC to start a new computation.
+ */
+
+
+/**
+ * Test if the CRC computation is accelerated by the processor.
+ * @return	True if the hardware instruction is used, false else.
+ */
+bool CRC32C::isAccelerated(void) {
+#	ifdef ELM_CRC32C_SSE42
+		static bool acc = __builtin_cpu_supports("sse4.2");
+		return acc;
+#	else
+		return false;
+#	endif
+}
+
+
+/**
+ * Update a raw CRC-32C value (not complemented) with the given bytes
+ * using the best available implementation.
+ * @param crc		Raw CRC to update (0xffffffff to start).
+ * @param buffer	Buffer of bytes.
+ * @param length	Length of the buffer.
+ * @return			Updated raw CRC.
+ */
+t::uint32 CRC32C::update(t::uint32 crc, const void *buffer, int length) {
+#	ifdef ELM_CRC32C_SSE42
+		if(isAccelerated())
+			return update_sse42(crc, static_cast<const t::uint8 *>(buffer), length);
+#	endif
+	return updateTable(crc, buffer, length);
+}
+
+
+/**
+ * Same as update() but always use the table-driven implementation.
+ * @param crc		Raw CRC to update (0xffffffff to start).
+ * @param buffer	Buffer of bytes.
+ * @param length	Length of the buffer.
+ * @return			Updated raw CRC.
+ */
+t::uint32 CRC32C::updateTable(t::uint32 crc, const void *buffer, int length) {
+	const t::uint32 (*tab)[256] = table().tab;
+	const t::uint8 *p = static_cast<const t::uint8 *>(buffer);
+	for(; length >= 8; p += 8, length -= 8) {
+		t::uint32 lo = crc ^ (t::uint32(p[0]) | (t::uint32(p[1]) << 8) | (t::uint32(p[2]) << 16) | (t::uint32(p[3]) << 24));
+		t::uint32 hi = t::uint32(p[4]) | (t::uint32(p[5]) << 8) | (t::uint32(p[6]) << 16) | (t::uint32(p[7]) << 24);
+		crc = tab[7][lo & 0xff] ^ tab[6][(lo >> 8) & 0xff] ^ tab[5][(lo >> 16) & 0xff] ^ tab[4][lo >> 24]
+			^ tab[3][hi & 0xff] ^ tab[2][(hi >> 8) & 0xff] ^ tab[1][(hi >> 16) & 0xff] ^ tab[0][hi >> 24];
+	}
+	for(; length > 0; length--)
+		crc = (crc >> 8) ^ tab[0][(crc ^ *p++) & 0xff];
+	return crc;
+}
+
+
+/**
+ * Put a buffer in the CRC.
+ * @param buffer	Buffer to put.
+ * @param length	Buffer length.
+ */
+void CRC32C::put(const void *buffer, int length) {
+	crc = update(crc, buffer, length);
+}
+
+
+/**
+ * Put a C string in the CRC.
+ * @param str	C string to put in.
+ */
+void CRC32C::put(const CString& str) {
+	put(str.chars(), str.length());
+}
+
+
+/**
+ * Put a string in the CRC.
+ * @param str	String to put in.
+ */
+void CRC32C::put(const String& str) {
+	put(str.chars(), str.length());
+}
+
+
+/**
+ * Put an input stream in the CRC (read up to the end of the stream).
+ * @param in	Input stream to read.
+ * @throw io::IOException	If there is an error during stream read.
+ */
+void CRC32C::put(io::InStream& in) {
+	char buf[4096];
+	while(true) {
+		int r = in.read(buf, sizeof(buf));
+		if(r < 0)
+			throw io::IOException("CRC32C: error during stream read");
+		if(r == 0)
+			break;
+		put(buf, r);
+	}
+}
+
+
+/**
+ */
+int CRC32C::write(const char *buffer, int size) {
+	put(buffer, size);
+	return size;
+}
+
+
+/**
+ */
+int CRC32C::flush(void) {
+	return 0;
+}
+
+
+/**
+ */
+cstring CRC32C::lastErrorMessage(void) {
+	return "";
+}
+
+} } // elm::checksum
@@ -123,11 +123,16 @@ MD5::~MD5(void) {
  * @param length	Block length.
  */
 void MD5::put(const void *block, t::uint32 length) {
+	const unsigned char *p = static_cast<const unsigned char *>(block);
 	while(length + size > MD5_BUFFER) {
-		memcpy(buf + size, block, min(length, MD5_BUFFER - size));
+		t::uint32 n = MD5_BUFFER - size;
+		memcpy(buf + size, p, n);
+		size += n;
+		p += n;
+		length -= n;
 		update();
 	}
-	memcpy(buf + size, block, length);
+	memcpy(buf + size, p, length);
 	size += length;
 }
 
@@ -261,6 +266,9 @@ void MD5::finalize(void) {
 	unsigned char buffer [64]; // 512 bits
 	int i;
 
+	// consume full blocks
+	update();
+
 	// finish the block
 	if(size + 1 > 56) { // We have to create another block
 
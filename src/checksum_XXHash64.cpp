@@ -0,0 +1,277 @@
+/*
+ *	checksum::XXHash64 class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <string.h>
+#include <elm/arch.h>
+#include <elm/checksum/XXHash64.h>
+#include <elm/io/IOException.h>
+
+namespace elm { namespace checksum {
+
+/**
+ * @class XXHash64
+ * Non-cryptographic 64-bit hash function xxHash64 (https://github.com/Cyan4973/xxHash).
+ * It processes the input by stripes of 32 bytes with four independent
+ * accumulators and achieves several GB/s with an excellent distribution.
+ * The produced values are the same as the reference implementation.
+ *
+ * The hash can be computed in one call with hash() or incrementally
+ * with the put() functions or writing to it as an @ref io::OutStream.
+ * digest() returns the hash of the data put up to now.
+ *
+ * @ingroup checksum
+ */
+
+static const t::uint64
+	PRIME1 = 0x9E3779B185EBCA87ULL,
+	PRIME2 = 0xC2B2AE3D27D4EB4FULL,
+	PRIME3 = 0x165667B19E3779F9ULL,
+	PRIME4 = 0x85EBCA77C2B2AE63ULL,
+	PRIME5 = 0x27D4EB2F165667C5ULL;
+
+static inline t::uint64 rotl(t::uint64 x, int r) { return (x << r) | (x >> (64 - r)); }
+
+static inline t::uint64 read64(const t::uint8 *p) {
+#	ifdef ELM_LITTLE_ENDIAN
+		t::uint64 v;
+		memcpy(&v, p, 8);
+		return v;
+#	else
+		t::uint64 v = 0;
+		for(int i = 7; i >= 0; i--)
+			v = (v << 8) | p[i];
+		return v;
+#	endif
+}
+
+static inline t::uint32 read32(const t::uint8 *p) {
+	return t::uint32(p[0]) | (t::uint32(p[1]) << 8) | (t::uint32(p[2]) << 16) | (t::uint32(p[3]) << 24);
+}
+
+static inline t::uint64 round(t::uint64 acc, t::uint64 input) {
+	acc += input * PRIME2;
+	acc = rotl(acc, 31);
+	return acc * PRIME1;
+}
+
+static inline t::uint64 merge(t::uint64 acc, t::uint64 val) {
+	acc ^= round(0, val);
+	return acc * PRIME1 + PRIME4;
+}
+
+static inline const t::uint8 *stripes(t::uint64 v[4], const t::uint8 *p, const t::uint8 *end) {
+	t::uint64 v1 = v[0], v2 = v[1], v3 = v[2], v4 = v[3];
+	for(; p + 32 <= end; p += 32) {
+		v1 = round(v1, read64(p));
+		v2 = round(v2, read64(p + 8));
+		v3 = round(v3, read64(p + 16));
+		v4 = round(v4, read64(p + 24));
+	}
+	v[0] = v1; v[1] = v2; v[2] = v3; v[3] = v4;
+	return p;
+}
+
+static t::uint64 finalize(t::uint64 h, const t::uint8 *p, int len) {
+	for(; len >= 8; p += 8, len -= 8) {
+		h ^= round(0, read64(p));
+		h = rotl(h, 27) * PRIME1 + PRIME4;
+	}
+	if(len >= 4) {
+		h ^= t::uint64(read32(p)) * PRIME1;
+		h = rotl(h, 23) * PRIME2 + PRIME3;
+		p += 4;
+		len -= 4;
+	}
+	for(; len > 0; len--) {
+		h ^= (*p++) * PRIME5;
+		h = rotl(h, 11) * PRIME1;
+	}
+	h ^= h >> 33;
+	h *= PRIME2;
+	h ^= h >> 29;
+	h *= PRIME3;
+	h ^= h >> 32;
+	return h;
+}
+
+static inline t::uint64 converge(const t::uint64 v[4]) {
+	t::uint64 h = rotl(v[0], 1) + rotl(v[1], 7) + rotl(v[2], 12) + rotl(v[3], 18);
+	for(int i = 0; i < 4; i++)
+		h = merge(h, v[i]);
+	return h;
+}
+
+
+/**
+ * Compute the hash of a buffer in one call.
+ * @param buffer	Buffer to hash.
+ * @param length	Buffer length.
+ * @param seed		Seed of the hash (default to 0).
+ * @return			64-bit hash.
+ */
+t::uint64 XXHash64::hash(const void *buffer, int length, t::uint64 seed) {
+	const t::uint8 *p = static_cast<const t::uint8 *>(buffer), *end = p + length;
+	t::uint64 h;
+	if(length >= 32) {
+		t::uint64 v[4] = { seed + PRIME1 + PRIME2, seed + PRIME2, seed, seed - PRIME1 };
+		p = stripes(v, p, end);
+		h = converge(v);
+	}
+	else
+		h = seed + PRIME5;
+	h += t::uint64(length);
+	return finalize(h, p, end - p);
+}
+
+
+/**
+ * Build an XXHash64 engine.
+ * @param seed	Seed of the hash.
+ */
+XXHash64::XXHash64(t::uint64 seed) {
+	reset(seed);
+}
+
+
+/**
+ */
+XXHash64::~XXHash64(void) {
+}
+
+
+/**
+ * Reset the engine to start a new hash computation.
+ * @param seed	Seed of the hash.
+ */
+void XXHash64::reset(t::uint64 seed) {
+	_seed = seed;
+	v[0] = seed + PRIME1 + PRIME2;
+	v[1] = seed + PRIME2;
+	v[2] = seed;
+	v[3] = seed - PRIME1;
+	total = 0;
+	memsize = 0;
+}
+
+
+/**
+ * Get the hash of the data put up to now. More data can be put after this call.
+ * @return	64-bit hash.
+ */
+t::uint64 XXHash64::digest(void) const {
+	t::uint64 h;
+	if(total >= 32)
+		h = converge(v);
+	else
+		h = _seed + PRIME5;
+	h += total;
+	return finalize(h, mem, memsize);
+}
+
+
+/**
+ * Put a buffer in the hash.
+ * @param buffer	Buffer to put.
+ * @param length	Buffer length.
+ */
+void XXHash64::put(const void *buffer, int length) {
+	const t::uint8 *p = static_cast<const t::uint8 *>(buffer), *end = p + length;
+	total += length;
+
+	// complete the pending stripe
+	if(memsize + length < 32) {
+		memcpy(mem + memsize, p, length);
+		memsize += length;
+		return;
+	}
+	if(memsize != 0) {
+		int n = 32 - memsize;
+		memcpy(mem + memsize, p, n);
+		stripes(v, mem, mem + 32);
+		p += n;
+		memsize = 0;
+	}
+
+	// process full stripes and keep the remaining
+	p = stripes(v, p, end);
+	memsize = end - p;
+	memcpy(mem, p, memsize);
+}
+
+
+/**
+ * Put a C string in the hash.
+ * @param str	C string to put in.
+ */
+void XXHash64::put(const CString& str) {
+	put(str.chars(), str.length());
+}
+
+
+/**
+ * Put a string in the hash.
+ * @param str	String to put in.
+ */
+void XXHash64::put(const String& str) {
+	put(str.chars(), str.length());
+}
+
+
+/**
+ * Put an input stream in the hash (read up to the end of the stream).
+ * @param in	Input stream to read.
+ * @throw io::IOException	If there is an error during stream read.
+ */
+void XXHash64::put(io::InStream& in) {
+	char buf[4096];
+	while(true) {
+		int r = in.read(buf, sizeof(buf));
+		if(r < 0)
+			throw io::IOException("XXHash64: error during stream read");
+		if(r == 0)
+			break;
+		put(buf, r);
+	}
+}
+
+
+/**
+ */
+int XXHash64::write(const char *buffer, int size) {
+	put(buffer, size);
+	return size;
+}
+
+
+/**
+ */
+int XXHash64::flush(void) {
+	return 0;
+}
+
+
+/**
+ */
+cstring XXHash64::lastErrorMessage(void) {
+	return "";
+}
+
+} } // elm::checksum
@@ -775,6 +775,8 @@ public:
  * @par Implemented by:
  * @li @ref BinomialQueue
  * @li @ref BiDiList
+ * @li @ref Heap
+ * @li @ref IndexedHeap
  * @li @ref ListQueue
  * @li @ref VectorQueue
  *
@@ -0,0 +1,547 @@
+/*
+ *	concur module implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/concur.h>
+
+namespace elm { namespace concur {
+
+/**
+ * @defgroup concur Concurrent Data Structures
+ *
+ * This module provides data structures that may be shared between threads
+ * without locks. The queues follow the naming of @ref VectorQueue: put()
+ * to enqueue, get() to dequeue and isEmpty() to test emptiness. As they do
+ * not block, put() and get() return a boolean telling if the operation
+ * succeeded.
+ *
+ * The available queues are:
+ * @li @ref SPSCQueue -- bounded ring buffer for one producer and one consumer,
+ * @li @ref MPMCQueue -- bounded queue for any number of producers and consumers,
+ * @li @ref MPSCQueue -- unbounded queue for any number of producers and one consumer.
+ *
+ * Each one can be wrapped in a @ref BlockingQueue to make the consumer
+ * (and the producer for bounded queues) sleep while the operation cannot
+ * be performed:
+ * @code
+ * 	#include <elm/concur.h>
+ *
+ * 	BlockingQueue<SPSCQueue<Batch *> > queue(256);
+ *
+ * 	// producer thread
+ * 	queue.put(batch);
+ * 	...
+ * 	queue.close();
+ *
+ * 	// consumer thread
+ * 	Batch *batch;
+ * 	while(queue.get(batch))
+ * 		process(batch);
+ * @endcode
+ *
+ * The sleeping is supported by @ref Waiter that is based on @ref sys::Futex.
+ *
+ * @ref ConcurrentHashMap is a hash map that can be shared between threads:
+ * look-ups do not lock and getOrCompute() computes the value of a key
+ * only once, whatever the number of threads asking for it:
+ * @code
+ * 	ConcurrentHashMap<const Function *, Summary *> summaries;
+ *
+ * 	// in any worker thread
+ * 	Summary *s = summaries.getOrCompute(f, [](const Function *f) { return analyze(f); });
+ * @endcode
+ */
+
+
+/**
+ * @class SPSCQueue
+ * Bounded lock-free queue for exactly one producer thread and one consumer
+ * thread. The implementation is a ring buffer whose head and tail are
+ * stored in different cache lines, each side caching the last seen value
+ * of the other side index to avoid cache line transfers.
+ *
+ * @param T		Type of stored items (must be default-constructible and assignable).
+ * @ingroup concur
+ */
+
+/**
+ * @fn SPSCQueue::SPSCQueue(int capacity);
+ * Build a queue.
+ * @param capacity	Capacity of the queue (rounded up to the next power of 2).
+ */
+
+/**
+ * @fn int SPSCQueue::capacity(void) const;
+ * Get the capacity of the queue.
+ * @return	Queue capacity.
+ */
+
+/**
+ * @fn int SPSCQueue::size(void) const;
+ * Get the number of items in the queue. As the queue may be modified
+ * concurrently, the result is only a snapshot.
+ * @return	Number of items.
+ */
+
+/**
+ * @fn bool SPSCQueue::isEmpty(void) const;
+ * Test if the queue is empty.
+ * @return	True if the queue is empty, false else.
+ */
+
+/**
+ * @fn bool SPSCQueue::put(const T& x);
+ * Put an item in the queue. Must only be called by the producer thread.
+ * @param x		Item to put.
+ * @return		True if the item has been put, false if the queue is full.
+ */
+
+/**
+ * @fn bool SPSCQueue::get(T& x);
+ * Get an item from the queue. Must only be called by the consumer thread.
+ * @param x		Assigned to the got item.
+ * @return		True if an item has been got, false if the queue is empty.
+ */
+
+
+/**
+ * @class MPMCQueue
+ * Bounded lock-free queue supporting any number of producer and consumer
+ * threads. This is the algorithm of D. Vyukov: each cell of the ring
+ * buffer contains a sequence number telling if the cell is ready to be
+ * written or read for a given position. Producers (resp. consumers) only
+ * contend on a CAS of the tail (resp. the head).
+ *
+ * @param T		Type of stored items (must be default-constructible and assignable).
+ * @ingroup concur
+ */
+
+/**
+ * @fn MPMCQueue::MPMCQueue(int capacity);
+ * Build a queue.
+ * @param capacity	Capacity of the queue (rounded up to the next power of 2).
+ */
+
+/**
+ * @fn int MPMCQueue::capacity(void) const;
+ * Get the capacity of the queue.
+ * @return	Queue capacity.
+ */
+
+/**
+ * @fn int MPMCQueue::size(void) const;
+ * Get an approximation of the number of items in the queue.
+ * @return	Number of items.
+ */
+
+/**
+ * @fn bool MPMCQueue::isEmpty(void) const;
+ * Test if the queue is empty (approximation if the queue is modified
+ * concurrently).
+ * @return	True if the queue is empty, false else.
+ */
+
+/**
+ * @fn bool MPMCQueue::put(const T& x);
+ * Put an item in the queue.
+ * @param x		Item to put.
+ * @return		True if the item has been put, false if the queue is full.
+ */
+
+/**
+ * @fn bool MPMCQueue::get(T& x);
+ * Get an item from the queue.
+ * @param x		Assigned to the got item.
+ * @return		True if an item has been got, false if the queue is empty.
+ */
+
+
+/**
+ * @class MPSCQueue
+ * Unbounded queue supporting any number of producer threads and only one
+ * consumer thread. This is the intrusive queue of D. Vyukov: a producer
+ * only performs one atomic exchange and the consumer performs no atomic
+ * read-modify-write. Items are allocated in separate nodes.
+ *
+ * Notice that a producer interrupted between its exchange and the linking
+ * of its node may make the queue temporarily look empty to the consumer.
+ *
+ * @param T		Type of stored items (must be default-constructible and assignable).
+ * @ingroup concur
+ */
+
+/**
+ * @fn bool MPSCQueue::isEmpty(void) const;
+ * Test if the queue is empty. Must only be called by the consumer.
+ * @return	True if the queue is empty, false else.
+ */
+
+/**
+ * @fn bool MPSCQueue::put(const T& x);
+ * Put an item in the queue.
+ * @param x		Item to put.
+ * @return		Always true.
+ */
+
+/**
+ * @fn bool MPSCQueue::get(T& x);
+ * Get an item from the queue. Must only be called by the consumer thread.
+ * @param x		Assigned to the got item.
+ * @return		True if an item has been got, false if the queue is empty.
+ */
+
+
+/**
+ * @class BlockingQueue
+ * Wrapper around one of the lock-free queues of this module that blocks
+ * the calling thread when the queue is empty on get() or full on put().
+ * The lock-free fast path is kept: the threads only sleep, using a
+ * @ref Waiter, when the operation cannot be done.
+ *
+ * The queue can be closed with close(): then the blocked threads are woken
+ * up, put() fails and get() fails as soon as the queue is empty.
+ *
+ * @param Q		Type of the wrapped queue (one of @ref SPSCQueue, @ref MPMCQueue
+ * 				or @ref MPSCQueue).
+ * @ingroup concur
+ */
+
+/**
+ * @fn BlockingQueue::BlockingQueue(A... args);
+ * Build the queue.
+ * @param args	Arguments passed to the wrapped queue constructor.
+ */
+
+/**
+ * @fn Q& BlockingQueue::queue(void);
+ * Get the wrapped queue.
+ * @return	Wrapped queue.
+ */
+
+/**
+ * @fn bool BlockingQueue::isEmpty(void) const;
+ * Test if the queue is empty.
+ * @return	True if the queue is empty, false else.
+ */
+
+/**
+ * @fn bool BlockingQueue::isClosed(void) const;
+ * Test if the queue is closed.
+ * @return	True if the queue is closed, false else.
+ */
+
+/**
+ * @fn bool BlockingQueue::tryPut(const t& x);
+ * Put an item without blocking.
+ * @param x		Item to put.
+ * @return		True if the item has been put, false if the queue is full.
+ */
+
+/**
+ * @fn bool BlockingQueue::tryGet(t& x);
+ * Get an item without blocking.
+ * @param x		Assigned to the got item.
+ * @return		True if an item has been got, false if the queue is empty.
+ */
+
+/**
+ * @fn bool BlockingQueue::put(const t& x);
+ * Put an item in the queue, blocking while the queue is full.
+ * @param x		Item to put.
+ * @return		True if the item has been put, false if the queue has been closed.
+ */
+
+/**
+ * @fn bool BlockingQueue::get(t& x);
+ * Get an item from the queue, blocking while the queue is empty.
+ * @param x		Assigned to the got item.
+ * @return		True if an item has been got, false if the queue is closed and empty.
+ */
+
+/**
+ * @fn void BlockingQueue::close(void);
+ * Close the queue and wake up the blocked threads.
+ */
+
+
+/**
+ * @class ConcurrentHashMap
+ * Hash map that can be shared between threads. The keys are hashed and
+ * compared with the same @ref HashKey as @ref HashMap.
+ *
+ * Look-ups (get(), hasKey()) do not take any lock: the bucket chains are
+ * only modified by atomic pointer updates and the nodes are immutable once
+ * published. Updates (put(), remove(),
+ * getOrCompute()) lock one of @ref STRIPES mutexes selected by the key hash
+ * so that threads working on different keys do not compete.
+ *
+ * The table doubles its size when the average chain length reaches 3/4.
+ * This resize is incremental: the new table is installed beside the old one
+ * and each update moves @ref CHUNK buckets until the old table is empty.
+ * Moved buckets are marked so that look-ups continue in the new table.
+ *
+ * As look-ups run without lock, removed or replaced nodes and old tables
+ * are reclaimed by epochs. Each access runs in a read section counted,
+ * according to the parity of the current epoch, in one of @ref READERS
+ * counters spread over the threads. When @ref RECLAIM nodes have been
+ * retired, an update moves them to a batch and advances the epoch: the batch
+ * is freed as soon as the readers of the previous parity are gone. Hence
+ * the values are returned by copy and the memory used by the map stays
+ * proportional to its content. A thread blocked in a computation of
+ * getOrCompute() only delays the reclamation.
+ *
+ * @param K		Type of keys.
+ * @param T		Type of values (must be default-constructible and copyable).
+ * @param H		Hashing and equality of keys (default to @ref HashKey<K>).
+ * @ingroup concur
+ */
+
+/**
+ * @fn ConcurrentHashMap::ConcurrentHashMap(int size);
+ * Build a map.
+ * @param size	Initial number of buckets (rounded up to a power of 2
+ * 				at least equal to @ref STRIPES).
+ */
+
+/**
+ * @fn Option<T> ConcurrentHashMap::get(const K& key) const;
+ * Look for the value of a key.
+ * @param key	Looked key.
+ * @return		Value of the key if any, none else.
+ */
+
+/**
+ * @fn T ConcurrentHashMap::get(const K& key, const T& def) const;
+ * Look for the value of a key.
+ * @param key	Looked key.
+ * @param def	Default value.
+ * @return		Value of the key if any, def else.
+ */
+
+/**
+ * @fn bool ConcurrentHashMap::hasKey(const K& key) const;
+ * Test if the map contains a key.
+ * @param key	Looked key.
+ * @return		True if the key is in the map, false else.
+ */
+
+/**
+ * @fn int ConcurrentHashMap::count(void) const;
+ * Count the number of keys in the map. If the map is concurrently modified,
+ * the result is only an approximation.
+ * @return	Number of keys.
+ */
+
+/**
+ * @fn bool ConcurrentHashMap::isEmpty(void) const;
+ * Test if the map is empty.
+ * @return	True if the map is empty, false else.
+ */
+
+/**
+ * @fn int ConcurrentHashMap::capacity(void) const;
+ * Get the current number of buckets.
+ * @return	Number of buckets.
+ */
+
+/**
+ * @fn void ConcurrentHashMap::put(const K& key, const T& val);
+ * Set the value of a key, replacing any existing value.
+ * @param key	Key to set.
+ * @param val	Value of the key.
+ */
+
+/**
+ * @fn bool ConcurrentHashMap::remove(const K& key);
+ * Remove a key from the map.
+ * @param key	Key to remove.
+ * @return		True if the key has been removed, false if it was not in the map.
+ */
+
+/**
+ * @fn T ConcurrentHashMap::getOrCompute(const K& key, F f);
+ * Get the value of a key, computing it by calling f(key) if the key is not
+ * in the map. f() is called without any lock held (and may use the map) and
+ * only once per key: the threads asking for a key whose value is being
+ * computed sleep until the computation is done.
+ *
+ * If f() throws an exception, the key is not added, the exception is
+ * propagated to the caller and the waiting threads try to compute it again.
+ *
+ * @param key	Looked key.
+ * @param f		Function computing the value of a key.
+ * @return		Value of the key.
+ */
+
+/**
+ * @fn void ConcurrentHashMap::forEach(F f) const;
+ * Call f(key, value) for each pair of the map. Each key is visited at most
+ * once, even while the table is resized, but, if the map is concurrently
+ * modified, the keys added or replaced during the traversal may be missed.
+ * @param f		Function to call.
+ */
+
+/**
+ * @fn void ConcurrentHashMap::clear(void);
+ * Remove all keys and free the memory used by the map. Must not be called
+ * concurrently with another operation.
+ */
+
+
+/**
+ * @class ShardedCache
+ * Thread-safe version of @ref Cache. The keys are spread over several
+ * shards, each one being a @ref Cache protected by its own mutex, so that
+ * threads accessing different keys rarely compete. The budget is evenly
+ * split between the shards, each shard receiving at least a budget of 1.
+ *
+ * getOrCompute() computes the value outside of any lock: if several threads
+ * miss the same key at the same time, the value may be computed several times
+ * and only the first one is kept (the others are released with the cleaner
+ * built by the function passed to setCleaner()). Use @ref ConcurrentHashMap
+ * when a computation must be performed only once.
+ *
+ * When the cleaner frees the values, a value returned by get() or
+ * getOrCompute() may be freed at any time by the eviction performed by
+ * another thread. In this case, use pin() or pinOrCompute(): the returned
+ * @ref Ref keeps the value alive and the cleaner of an evicted entry is only
+ * invoked when its last reference is released.
+ *
+ * @param K		Type of keys.
+ * @param V		Type of values.
+ * @param H		Hashing of keys (default to @ref HashKey<K>).
+ * @ingroup concur
+ */
+
+/**
+ * @fn ShardedCache::ShardedCache(t::size budget, policy_t policy, int shards, int size);
+ * Build a sharded cache.
+ * @param budget	Maximum total cost of the entries.
+ * @param policy	Eviction policy of the shards (default to @ref Cache::LRU).
+ * @param shards	Number of shards (default to @ref SHARDS).
+ * @param size		Size of the hash table of each shard.
+ */
+
+/**
+ * @fn int ShardedCache::shards(void) const;
+ * Get the number of shards.
+ * @return	Number of shards.
+ */
+
+/**
+ * @fn V ShardedCache::getOrCompute(const K& key, F f);
+ * Look for a key and, if it is missing, compute its value with f(key) and
+ * add it to the cache.
+ * @param key	Looked key.
+ * @param f		Function computing the value of a key.
+ * @return		Value of the key.
+ */
+
+/**
+ * @fn Ref ShardedCache::pin(const K& key);
+ * Look for a key and pin its value: the value is not cleaned while the
+ * returned reference is alive, even if the entry is evicted meanwhile.
+ * @param key	Looked key.
+ * @return		Reference to the value, empty if the key is missing.
+ */
+
+/**
+ * @fn Ref ShardedCache::pinOrCompute(const K& key, F f);
+ * Same as getOrCompute() but pin the returned value (see pin()).
+ * @param key	Looked key.
+ * @param f		Function computing the value of a key.
+ * @return		Reference to the value of the key.
+ */
+
+/**
+ * @class ShardedCache::Ref
+ * Reference to a value of a @ref ShardedCache preventing its cleaning as long
+ * as it is alive. Refs may be copied and are empty when built by default.
+ */
+
+/*
+ * The other methods are the same as @ref Cache and apply to all shards
+ * (setCost(), setCleaner(), setBudget(), clear(), counters) or to the shard
+ * of the key (get(), put(), remove(), hasKey()).
+ */
+
+
+/**
+ * @class Waiter
+ * Event count allowing threads to sleep until a condition, tested without
+ * lock, becomes true. A waiting thread has to:
+ * @li call prepare() to get a key,
+ * @li test again the condition: if it is true, call cancel(),
+ * @li else call wait() with the key.
+ *
+ * The notifying thread makes the condition true and then calls notify() or
+ * notifyAll(). These calls are very cheap when no thread waits. A thread
+ * calling wait() returns as soon as a notification has been performed
+ * after the matching prepare().
+ *
+ * The waiting is implemented with a @ref sys::Futex.
+ *
+ * @ingroup concur
+ */
+
+/**
+ * @fn key_t Waiter::prepare(void);
+ * Prepare to wait.
+ * @return	Key to pass to wait().
+ */
+
+/**
+ * @fn void Waiter::cancel(void);
+ * Cancel a wait after prepare() because the condition became true.
+ */
+
+/**
+ * @fn void Waiter::notify(void);
+ * Wake up one waiting thread, if any.
+ */
+
+/**
+ * @fn void Waiter::notifyAll(void);
+ * Wake up all waiting threads.
+ */
+
+/**
+ * Wait for a notification.
+ * @param key	Key returned by prepare().
+ */
+void Waiter::wait(key_t key) {
+	while(_seq.load(sys::ACQUIRE) == key)
+		sys::Futex::wait(_seq, key);
+	_waiters.fetchSub(1, sys::RELAXED);
+}
+
+/**
+ * Perform a notification.
+ * @param all	True to wake up all threads, false for only one.
+ */
+void Waiter::wake(bool all) {
+	_seq.fetchAdd(1, sys::RELEASE);
+	if(all)
+		sys::Futex::wakeAll(_seq);
+	else
+		sys::Futex::wake(_seq);
+}
+
+} }	// elm::concur
@@ -162,6 +162,9 @@ namespace elm {
  * Data Structure | put  | get
  * -------------- | ---- | ----
  * BinomialQueue  | O(1) | O(log(n))
+ * Heap           | O(log(n)) | O(log(n))
+ * IndexedHeap    | O(log(n)) | O(log(n))
+ * RadixHeap      | O(1) | O(log(C))
  * SortedList     | O(n) | O(1)
  *
  *
@@ -0,0 +1,180 @@
+/*
+ *	Cache class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/Cache.h>
+
+namespace elm {
+
+/**
+ * @class Cache
+ * Map of bounded size used to memoize the results of computations.
+ * Each entry has a cost given by a cost function (1 by default) and
+ * the total cost of the entries is kept under a budget by evicting entries
+ * when a new one is added. The eviction follows one of the policies:
+ * @li @ref LRU -- the least recently used entry is evicted,
+ * @li @ref CLOCK -- an approximation of LRU where an access only sets a
+ * 		reference bit instead of moving the entry in the recency list,
+ * @li @ref SIZE -- the most costly entry among the @ref WINDOW least recently
+ * 		used ones is evicted.
+ *
+ * The cache counts the hits, the misses and the evictions to help tuning
+ * the budget. As the values may own resources, a @ref Cleaner may be attached
+ * to each entry: it is invoked and deleted when the entry leaves the cache
+ * (eviction, replacement, removal or clearing). Cleaners can also be built
+ * automatically with setCleaner():
+ * @code
+ * 	Cache<const Function *, Summary *> cache(64 << 20);
+ * 	cache.setCost([](const Function *f, Summary *s) { return s->size(); });
+ * 	cache.setCleaner([](const Function *f, Summary *s) { return new Deletor<Summary>(s); });
+ * 	...
+ * 	Summary *s = cache.getOrCompute(f, computeSummary);
+ * @endcode
+ * The entry being added or replaced is never evicted by its own addition:
+ * getOrCompute() and put() always leave it in the cache, even if its cost
+ * alone exceeds the budget (it is then the only entry until the next addition).
+ * Replacing the value of a key by the same value (according to ==, if
+ * available) drops the old cleaner without invoking it.
+ * As an evicted value may be released at any addition, a value got from the
+ * cache must not be used after the next addition.
+ *
+ * This class is not thread-safe: for a cache shared between threads,
+ * use @ref concur::ShardedCache.
+ *
+ * @param K		Type of keys.
+ * @param V		Type of values.
+ * @param H		Hashing of keys (default to @ref HashKey<K>).
+ * @ingroup data
+ */
+
+/**
+ * @fn Cache::Cache(t::size budget, policy_t policy, int size);
+ * Build a cache.
+ * @param budget	Maximum total cost of the entries.
+ * @param policy	Eviction policy (default to @ref LRU).
+ * @param size		Size of the underlying hash table.
+ */
+
+/**
+ * @fn void Cache::setCost(cost_t cost);
+ * Set the function computing the cost of an entry. Must be called
+ * while the cache is empty.
+ * @param cost	Cost function.
+ */
+
+/**
+ * @fn void Cache::setCleaner(cleaner_t cleaner);
+ * Set the function building the @ref Cleaner of entries added without
+ * explicit cleaner. The function may return null if there is nothing to clean.
+ * @param cleaner	Cleaner builder.
+ */
+
+/**
+ * @fn void Cache::setBudget(t::size budget);
+ * Change the budget, evicting entries if the used cost exceeds it.
+ * @param budget	New budget.
+ */
+
+/**
+ * @fn t::size Cache::budget(void) const;
+ * Get the budget of the cache.
+ * @return	Maximum total cost of the entries.
+ */
+
+/**
+ * @fn t::size Cache::used(void) const;
+ * Get the total cost of the entries in the cache.
+ * @return	Used cost.
+ */
+
+/**
+ * @fn t::uint64 Cache::hits(void) const;
+ * Get the number of accesses that found their key.
+ * @return	Number of hits.
+ */
+
+/**
+ * @fn t::uint64 Cache::misses(void) const;
+ * Get the number of accesses that did not find their key.
+ * @return	Number of misses.
+ */
+
+/**
+ * @fn t::uint64 Cache::evictions(void) const;
+ * Get the number of entries evicted to keep the budget.
+ * @return	Number of evictions.
+ */
+
+/**
+ * @fn void Cache::resetStats(void);
+ * Reset the hit, miss and eviction counters.
+ */
+
+/**
+ * @fn bool Cache::hasKey(const K& key) const;
+ * Test if a key is in the cache without changing its recency nor the counters.
+ * @param key	Looked key.
+ * @return		True if the key is in the cache, false else.
+ */
+
+/**
+ * @fn Option<V> Cache::peek(const K& key) const;
+ * Look for a key in the cache without changing its recency nor the counters.
+ * @param key	Looked key.
+ * @return		Value of the key if any, none else.
+ */
+
+/**
+ * @fn Option<V> Cache::get(const K& key);
+ * Look for a key in the cache.
+ * @param key	Looked key.
+ * @return		Value of the key if any, none else.
+ */
+
+/**
+ * @fn V Cache::getOrCompute(const K& key, F f);
+ * Look for a key in the cache and, if it is missing, compute its value with
+ * f(key) and add it to the cache.
+ * @param key	Looked key.
+ * @param f		Function computing the value of a key.
+ * @return		Value of the key.
+ */
+
+/**
+ * @fn void Cache::put(const K& key, const V& val, Cleaner *cleaner);
+ * Add or replace an entry in the cache.
+ * @param key		Key of the entry.
+ * @param val		Value of the entry.
+ * @param cleaner	Cleaner to invoke when the entry leaves the cache (optional).
+ */
+
+/**
+ * @fn bool Cache::remove(const K& key);
+ * Remove an entry, invoking its cleaner.
+ * @param key	Key of the entry.
+ * @return		True if the entry was in the cache, false else.
+ */
+
+/**
+ * @fn void Cache::clear(void);
+ * Remove all entries, invoking their cleaners.
+ */
+
+}	// elm
@@ -0,0 +1,220 @@
+/*
+ *	ColumnTable class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/ColumnTable.h>
+
+namespace elm {
+
+/**
+ * @class ColumnTable
+ * Table of rows stored column by column (struct of arrays). As in
+ * @ref FragTable, the rows are stored in pages of 2^n rows allocated as the
+ * table grows: the rows never move and adding a row never copies the table.
+ * Each page contains, for each column, a contiguous array of values aligned on
+ * @ref ALIGN bytes. Scanning or filtering over a column only touches
+ * the memory of this column and the loops over the raw page arrays
+ * are easily vectorized by the compiler:
+ * @code
+ * 	ColumnTable<Address, int, Inst *> insts;
+ * 	...
+ * 	int total = 0;
+ * 	insts.scan<1>([&](const int *sizes, int n, int base) {
+ * 		for(int i = 0; i < n; i++)
+ * 			total += sizes[i];
+ * 	});
+ * @endcode
+ *
+ * Pages can also be visited with forEachPage() or, in parallel,
+ * with forEachPageParallel().
+ *
+ * The column types must be default-constructible: all the rows of a page
+ * are constructed when the page is allocated.
+ *
+ * @param C		Types of the columns.
+ * @ingroup data
+ */
+
+/**
+ * @var int ColumnTable::COLUMNS;
+ * Number of columns.
+ */
+
+/**
+ * @var int ColumnTable::ALIGN;
+ * Alignment in bytes of the column arrays in a page.
+ */
+
+/**
+ * @class ColumnTable::col
+ * Provides in t the type of column I.
+ */
+
+/**
+ * @class ColumnTable::Page
+ * Page of a @ref ColumnTable as passed to forEachPage() and forEachPageParallel().
+ */
+
+/**
+ * @fn int ColumnTable::Page::index(void) const;
+ * Get the page index.
+ * @return	Page index.
+ */
+
+/**
+ * @fn int ColumnTable::Page::base(void) const;
+ * Get the index of the first row of the page.
+ * @return	First row index.
+ */
+
+/**
+ * @fn int ColumnTable::Page::length(void) const;
+ * Get the number of rows in the page.
+ * @return	Row count.
+ */
+
+/**
+ * @fn col<I>::t *ColumnTable::Page::column(void) const;
+ * Get the array of the values of column I in the page.
+ * @return	Column array.
+ */
+
+/**
+ * @fn ColumnTable::ColumnTable(int size_pow);
+ * Build an empty table.
+ * @param size_pow	Page size as a power of 2 (default to 2^12 rows).
+ */
+
+/**
+ * @fn int ColumnTable::pageSize(void) const;
+ * Get the number of rows in a page.
+ * @return	Page size.
+ */
+
+/**
+ * @fn int ColumnTable::pagePower(void) const;
+ * Get the page size as a power of 2.
+ * @return	Page size power.
+ */
+
+/**
+ * @fn int ColumnTable::pageCount(void) const;
+ * Get the number of allocated pages.
+ * @return	Page count.
+ */
+
+/**
+ * @fn int ColumnTable::pageLength(int p) const;
+ * Get the number of used rows in a page (only the last page may be partially used).
+ * @param p	Page index.
+ * @return	Number of rows in the page.
+ */
+
+/**
+ * @fn int ColumnTable::count(void) const;
+ * Get the number of rows.
+ * @return	Row count.
+ */
+
+/**
+ * @fn const col<I>::t& ColumnTable::get(int row) const;
+ * Get the value of column I in a row.
+ * @param row	Row index.
+ * @return		Column value.
+ */
+
+/**
+ * @fn col<I>::t& ColumnTable::get(int row);
+ * Get a reference on the value of column I in a row.
+ * @param row	Row index.
+ * @return		Column value reference.
+ */
+
+/**
+ * @fn void ColumnTable::set(int row, const col<I>::t& v);
+ * Set the value of column I in a row.
+ * @param row	Row index.
+ * @param v		Set value.
+ */
+
+/**
+ * @fn const col<I>::t *ColumnTable::column(int p) const;
+ * Get the array of values of column I in page p.
+ * @param p		Page index.
+ * @return		Column array (containing pageLength(p) used values).
+ */
+
+/**
+ * @fn int ColumnTable::add(const C&... vals);
+ * Add a row at the end of the table.
+ * @param vals	Values of the columns.
+ * @return		Index of the added row.
+ */
+
+/**
+ * @fn int ColumnTable::alloc(int n);
+ * Add n default rows at the end of the table.
+ * @param n		Number of added rows.
+ * @return		Index of the first added row.
+ */
+
+/**
+ * @fn void ColumnTable::shrink(int length);
+ * Reduce the number of rows of the table. The pages that become unused are released.
+ * @param length	New row count.
+ */
+
+/**
+ * @fn void ColumnTable::clear(void);
+ * Remove all rows and release the pages.
+ */
+
+/**
+ * @fn void ColumnTable::forEachPage(F f) const;
+ * Call f with a @ref Page for each page of the table, in order.
+ * @param f		Function to call.
+ */
+
+/**
+ * @fn void ColumnTable::scan(F f) const;
+ * Call f(const col<I>::t *values, int n, int base) for each page
+ * with the array of column I, the number of rows and the index of the first row.
+ * @param f		Function to call.
+ */
+
+/**
+ * @fn void ColumnTable::select(P pred, Vector<int>& rows) const;
+ * Add to rows, in order, the index of the rows whose value of column I
+ * satisfies the given predicate.
+ * @param pred	Predicate on column values.
+ * @param rows	Vector receiving the row indexes.
+ */
+
+/**
+ * @fn void ColumnTable::forEachPageParallel(F f, int threads) const;
+ * Call f with a @ref Page for each page of the table, in parallel.
+ * The pages are distributed dynamically among the threads and f
+ * must support concurrent calls. The function returns when all pages
+ * have been processed.
+ * @param f			Function to call.
+ * @param threads	Number of threads (0 for the number of cores).
+ */
+
+}	// elm
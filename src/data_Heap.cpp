@@ -0,0 +1,143 @@
+/*
+ *	Heap and IndexedHeap classes implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/Heap.h>
+
+namespace elm {
+
+/**
+ * @class Heap
+ * Priority queue implemented as a d-ary heap stored in a contiguous @ref Vector.
+ * The head of the queue is the smallest item according to the comparator.
+ * Compared to @ref BinomialQueue, no node is allocated per item and the
+ * children of a node are contiguous in memory, which makes put() and get()
+ * much faster in practice. A bigger arity makes the heap flatter, and so
+ * put() cheaper, at the cost of more comparisons in get(): the default
+ * arity of 4 is a good trade-off for small items.
+ *
+ * The performance of the queue are:
+ * * head - O(1)
+ * * put - O(log n)
+ * * get - O(d log n)
+ * * memory - one item per element.
+ *
+ * @par Implemented concepts
+ * @li @ref elm::concept::Queue
+ *
+ * @param T		Type of items.
+ * @param C		Comparator type (default to @ref Comparator).
+ * @param D		Arity of the heap (default to 4).
+ * @ingroup data
+ */
+
+/**
+ * @fn Heap::Heap(const C& c, int cap);
+ * Build an empty heap.
+ * @param c		Comparator instance to use.
+ * @param cap	Initial capacity.
+ */
+
+/**
+ * @fn void Heap::put(const T& x);
+ * Add an item to the heap.
+ * @param x		Added item.
+ */
+
+/**
+ * @fn T Heap::get(void);
+ * Remove the head item of the heap and return it.
+ * @return	Removed head item.
+ * @warning	It is an error to call this method on an empty heap.
+ */
+
+/**
+ * @fn void Heap::putAll(const CC& c);
+ * Add all items of the given collection. The heap is rebuilt bottom-up,
+ * in O(n), instead of adding the items one by one.
+ * @param c		Collection of added items.
+ */
+
+
+/**
+ * @class IndexedHeap
+ * d-ary heap whose items are identified by a handle returned by put(). The handle
+ * allows to test if the item is still in the heap, to read it, to change its
+ * priority (decreaseKey(), update()) or to remove it from the heap, as required
+ * by shortest path (Dijkstra-like) algorithms or priority-driven fixpoint worklists.
+ * The heap itself only moves integer handles while the items are stored in
+ * a side table indexed by the handles. Handles of removed items are reused
+ * by the following put().
+ *
+ * The performance of the queue are:
+ * * head, contains - O(1)
+ * * put, decreaseKey - O(log n)
+ * * get, update, remove - O(d log n)
+ *
+ * @par Implemented concepts
+ * @li @ref elm::concept::Queue
+ *
+ * @param T		Type of items.
+ * @param C		Comparator type (default to @ref Comparator).
+ * @param D		Arity of the heap (default to 4).
+ * @ingroup data
+ */
+
+/**
+ * @fn IndexedHeap::handle_t IndexedHeap::put(const T& x);
+ * Add an item to the heap.
+ * @param x		Added item.
+ * @return		Handle of the item.
+ */
+
+/**
+ * @fn bool IndexedHeap::contains(handle_t h) const;
+ * Test if the item of the given handle is in the heap.
+ * @param h		Tested handle.
+ * @return		True if the item is in the heap, false else.
+ */
+
+/**
+ * @fn IndexedHeap::handle_t IndexedHeap::headHandle(void) const;
+ * Get the handle of the head item.
+ * @return	Head item handle.
+ */
+
+/**
+ * @fn void IndexedHeap::decreaseKey(handle_t h, const T& x);
+ * Replace the item of the given handle by a smaller or equal one.
+ * @param h		Handle of the changed item.
+ * @param x		New item value.
+ */
+
+/**
+ * @fn void IndexedHeap::update(handle_t h, const T& x);
+ * Replace the item of the given handle whatever its new priority.
+ * @param h		Handle of the changed item.
+ * @param x		New item value.
+ */
+
+/**
+ * @fn void IndexedHeap::remove(handle_t h);
+ * Remove the item of the given handle from the heap.
+ * @param h		Handle of the removed item.
+ */
+
+}	// elm
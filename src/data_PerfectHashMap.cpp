@@ -0,0 +1,110 @@
+/*
+ *	PerfectHashMap class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/PerfectHashMap.h>
+
+namespace elm {
+
+/**
+ * @class PerfectHashMap
+ * Map built once and then looked up many times. Items are first added
+ * with add() and, once all items are there, freeze() computes a perfect hash
+ * function (hash-and-displace scheme): keys are split in small buckets and,
+ * for each bucket, a seed is searched that places all its keys in free slots
+ * of the table. A look-up then costs one hash of the key, one access to the seed
+ * table, one access to the slot table and one key comparison, whatever
+ * the number of items.
+ *
+ * Keys with the same hash value cannot be separated: they are recorded
+ * in a small overflow list that is scanned linearly after a failed slot look-up.
+ * If several items have equal keys, the first added one is found.
+ *
+ * Look-ups are only allowed on a frozen map; any add() or clear() unfreezes it.
+ * Once frozen, the map is read-only and can be looked up concurrently by
+ * several threads.
+ *
+ * @param K		Type of keys.
+ * @param T		Type of values.
+ * @param H		Hashing of keys (default to @ref HashKey<K>).
+ * @ingroup data
+ */
+
+/**
+ * @fn void PerfectHashMap::add(const K& key, const T& val);
+ * Add an item to the map. The map becomes unfrozen.
+ * @param key	Key of the item.
+ * @param val	Value of the item.
+ */
+
+/**
+ * @fn void PerfectHashMap::clear(void);
+ * Remove all items. The map becomes unfrozen.
+ */
+
+/**
+ * @fn bool PerfectHashMap::isFrozen(void) const;
+ * Test if the map is frozen, that is, can be looked up.
+ * @return	True if the map is frozen, false else.
+ */
+
+/**
+ * @fn const Vector<pair_t>& PerfectHashMap::items(void) const;
+ * Get the items of the map in addition order.
+ * @return	Items of the map.
+ */
+
+/**
+ * @fn void PerfectHashMap::freeze(void);
+ * Compute the perfect hash function of the current items. The size of the
+ * slot table starts at 1.25 times the number of items and is doubled
+ * until a seed is found for each bucket.
+ */
+
+/**
+ * @fn int PerfectHashMap::indexOf(const K& key) const;
+ * Look for the index of an item in items().
+ * @param key	Looked key.
+ * @return		Index of the item or -1 if the key is not found.
+ */
+
+/**
+ * @fn Option<T> PerfectHashMap::get(const K& key) const;
+ * Look for the value of a key.
+ * @param key	Looked key.
+ * @return		Found value or none.
+ */
+
+/**
+ * @fn const T& PerfectHashMap::get(const K& key, const T& def) const;
+ * Look for the value of a key.
+ * @param key	Looked key.
+ * @param def	Default value.
+ * @return		Found value or def if the key is not found.
+ */
+
+/**
+ * @fn bool PerfectHashMap::hasKey(const K& key) const;
+ * Test if a key is in the map.
+ * @param key	Looked key.
+ * @return		True if the key is found, false else.
+ */
+
+}	// elm
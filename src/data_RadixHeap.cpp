@@ -0,0 +1,78 @@
+/*
+ *	RadixHeap class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/RadixHeap.h>
+
+namespace elm {
+
+/**
+ * @class RadixHeap
+ * Priority queue for monotone unsigned integer keys: the key of an added item
+ * must be greater or equal to the key of the last removed item, as in
+ * Dijkstra-like shortest path algorithms. The items are stored in buckets
+ * according to the highest bit differing between their key and the last
+ * removed key. When the bucket of the smallest keys is empty, the first
+ * non-empty bucket is redistributed in the lower buckets: as an item can only
+ * move to lower buckets, each item is moved at most once per key bit.
+ *
+ * The performance of the queue are:
+ * * put - O(1)
+ * * get - O(log C) amortized, C being the key range.
+ *
+ * @param T		Type of items.
+ * @param K		Type of keys (unsigned integer, default to t::uint32).
+ * @ingroup data
+ */
+
+/**
+ * @fn void RadixHeap::put(key_t k, const T& x);
+ * Add an item with the given key.
+ * @param k		Item key (must be greater or equal to last()).
+ * @param x		Added item.
+ */
+
+/**
+ * @fn T RadixHeap::get(void);
+ * Remove the item with the smallest key and return it.
+ * @return	Removed item.
+ * @warning	It is an error to call this method on an empty heap.
+ */
+
+/**
+ * @fn const T& RadixHeap::head(void) const;
+ * Get the item with the smallest key.
+ * @return	Head item.
+ */
+
+/**
+ * @fn key_t RadixHeap::headKey(void) const;
+ * Get the smallest key of the heap.
+ * @return	Smallest key.
+ */
+
+/**
+ * @fn key_t RadixHeap::last(void) const;
+ * Get the key of the last removed item, that is, the lowest key that
+ * can be added.
+ * @return	Last removed key.
+ */
+
+}	// elm
@@ -125,6 +125,15 @@ namespace elm {
  * @param item	Item to remove.
  */
 
+/**
+ * @fn void SortedList::addAll(const CC& c);
+ * Add all items of the given collection. The items are first copied in a
+ * vector and sorted, then merged with the list in one traversal:
+ * this costs O(m log m + n) instead of O(m n) for repeated add().
+ * As with add(), an item is inserted after the equal items already in the list.
+ * @param c		Collection of items to add.
+ */
+
 
 /**
  * @class SortedList::Iterator
@@ -0,0 +1,101 @@
+/*
+ *	radix and counting sorts implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/radixsort.h>
+
+namespace elm {
+
+/**
+ * @class RadixKey
+ * Default key extractor of radix sorts: it maps an item to an unsigned integer
+ * whose natural order is the order of the items. Unsigned integers are
+ * used as is, signed integers (including plain char when it is signed)
+ * have their sign bit flipped, pointers are converted to their address
+ * and @ref Pair are sorted on their first member. Other types are rejected
+ * at compile time and require a custom key extractor.
+ *
+ * A custom key extractor is any functor taking an item and returning
+ * an unsigned integer (the size of this integer fixes the number of passes).
+ *
+ * @param T	Type of sorted items.
+ * @ingroup data
+ */
+
+/**
+ * @fn void radixsort(A& array, const K& key);
+ * Sort the given array with a LSD radix sort on 8-bit digits. The histograms
+ * of all digits are computed in a single read of the array and the digits
+ * that are equal for all items are skipped: sorting small integers in 64-bit
+ * words only costs the passes of the non-null bytes. Each pass scatters
+ * the items between the array and a temporary buffer of the same size.
+ * The sort is stable and costs O(d n) where d is the number of useful digits.
+ *
+ * The array may be any random-access container providing count() and
+ * operator[] (@ref Vector, @ref Array, @ref FragTable, etc).
+ *
+ * @param array		Array to sort.
+ * @param key		Key extractor (default to @ref RadixKey).
+ * @ingroup data
+ */
+
+/**
+ * @fn void msdRadixsort(A& array, const K& key);
+ * Sort the given array with a MSD radix sort (American flag sort):
+ * items are permuted in place in 256 buckets according to their most significant
+ * digit and the buckets are sorted recursively on the next digit; small
+ * buckets are finished with an insertion sort. Unlike radixsort(), no temporary
+ * buffer is needed but the sort is not stable.
+ *
+ * @param array		Array to sort.
+ * @param key		Key extractor (default to @ref RadixKey).
+ * @ingroup data
+ */
+
+/**
+ * @fn void countingsort(A& array, int range, const K& key);
+ * Sort the given array whose keys are all in [0, range[ with a counting sort.
+ * The sort is stable and costs O(n + range). As @ref RadixKey flips
+ * the sign bit of signed integers, a key extractor must be given to sort
+ * signed integers or structured items.
+ *
+ * @param array		Array to sort.
+ * @param range		Upper bound (excluded) of the keys.
+ * @param key		Key extractor (default to @ref RadixKey).
+ * @ingroup data
+ */
+
+/**
+ * @fn void parallelRadixsort(A& array, const K& key, int threads);
+ * Parallel version of radixsort(). The array is split in as many chunks as
+ * threads and, for each digit, each thread counts the digits of its chunk,
+ * the offsets of each chunk in each bucket are computed from these histograms and
+ * each thread scatters its own chunk. The threads are run by a
+ * @ref sys::JobScheduler and synchronized by a @ref sys::Barrier. The sort is stable.
+ *
+ * Small arrays are sorted sequentially.
+ *
+ * @param array		Array to sort.
+ * @param key		Key extractor (default to @ref RadixKey).
+ * @param threads	Number of threads (default to the number of cores).
+ * @ingroup data
+ */
+
+}	// elm
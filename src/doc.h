@@ -38,12 +38,14 @@ namespace elm {
  * modules:
  * @li @ref alloc -- specialized allocators and interactive garbage collector,
  * @li @ref checksum -- checksum algorithms,
+ * @li @ref concur -- lock-free queues for inter-thread communication,
  * @li @ref data -- common generic data structures and associated facilities,
  * @li @ref dyndata -- data structure implementation using inheritance and virtual methods,
  * @li @ref ios -- unformatted and formatted input/output classes,
  * @li @ref json -- JSon format ELM implementation,
  * @li @ref net_mod -- network access abstraction classes,
  * @li @ref options -- command line option parsing classes,
+ * @li @ref perf -- performance counters, timers and tracing,
  * @li @ref serial -- serialization facilities,
  * @li @ref string -- character string facilities,
  * @li @ref system -- system abstraction facilities (file system, plugin, random number, process management),
@@ -153,9 +155,11 @@ namespace elm {
 /**
  * @defgroup checksum Checksum Engines
  *
- * This small modules provides two checksum engines:
+ * This small modules provides several checksum engines:
  * @li @ref checksum::Fletcher for fast checksumming,
- * @li @ref checksum::MD5 for MD5 checksum often used on the web.
+ * @li @ref checksum::MD5 for MD5 checksum often used on the web,
+ * @li @ref checksum::CRC32C for CRC-32C (Castagnoli), hardware-accelerated when SSE 4.2 is available,
+ * @li @ref checksum::XXHash64 for very fast non-cryptographic 64-bit hashing.
  *
  */
 
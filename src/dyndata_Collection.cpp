@@ -50,7 +50,7 @@ namespace elm { namespace dyndata {
  * @code
  * int count(const AbstractCollection<T>& coll) {
  * 	int c = 0;
- * 	for(Iter i(coll->iterator()); i; i++)
+ * 	for(Iter<T> i = coll.items(); i(); i++)
  * 		c++;
  * 	return c;
  * }
@@ -140,24 +140,111 @@ namespace elm { namespace dyndata {
 /**
  * @class AbstractIter
  * Interface class to implements an iterator as defined in @ref concept::Collection concept.
+ *
+ * Besides the item-by-item interface, fill() provides the items by batches:
+ * this allows to iterate with only one virtual call for several items.
+ * The default implementation of fill() is based on ended(), item() and next()
+ * but implementations are encouraged to override it.
+ *
  * @param T		Type of iterated values.
  * @ingroup dyndata
  */
 
+/**
+ * @fn int AbstractIter::fill(T *buf, int max);
+ * Copy the next items, at most max, in the given buffer and move the iterator
+ * after them.
+ * @param buf	Buffer to fill.
+ * @param max	Maximum number of items to copy.
+ * @return		Number of copied items (0 at end of iteration).
+ */
+
+/**
+ * @fn AbstractIter<T> *AbstractIter::clone(void *mem) const;
+ * Build a copy of the iterator in the given memory. Used by @ref Iter
+ * to copy the iterators it stores inline, that is, only the @ref IterInst
+ * built by Iter::make(). The default implementation ignores the memory and
+ * returns a null pointer.
+ * @param mem	Memory to build the copy in.
+ * @return		Built copy.
+ */
+
 
 /**
  * @class Iter
  * Wrapper class around @ref AbstractIter to more easily manage the usage and the release.
+ *
+ * The iterator reads the items by batches of @ref BATCH items with
+ * @ref AbstractIter::fill(): the loops on an Iter only perform one virtual call
+ * every @ref BATCH items. In addition, the iterators built with make() whose size
+ * is less than @ref SIZE are stored inside the Iter object: they do not
+ * require memory allocation and are copied when the Iter is copied.
+ * Bigger iterators and iterators passed as pointers are allocated on the heap and
+ * shared by the copies, together with their batch: the copies then move along
+ * the same sequence of items.
+ *
+ * As items are copied in a buffer of @ref BATCH items, batches are only used
+ * if T is default-constructible (see @ref BATCHED). Otherwise, the items are read
+ * one by one from the abstract iterator.
+ *
  * @param T		Type of iterated values.
  * @ingroup	dyndata
  */
 
+/**
+ * @var int Iter::BATCH;
+ * Number of items read at once from the abstract iterator.
+ */
+
+/**
+ * @var int Iter::SIZE;
+ * Maximal size of an iterator stored inside the Iter object.
+ */
+
+/**
+ * @var bool Iter::BATCHED;
+ * True if the items are read by batches, that is, if T is default-constructible.
+ */
+
+/**
+ * @fn Iter::Iter(AbstractIter<T> *iter);
+ * Build an iterator from a heap-allocated abstract iterator
+ * that is released with the last Iter using it.
+ * @param iter	Abstract iterator.
+ */
+
+/**
+ * @fn Iter<T> Iter::make(const I& i);
+ * Build an abstract iterator from a generic iterator. If the abstract iterator
+ * is small enough, it is stored inside the Iter object, the choice being
+ * performed at compile time. Requires to include <elm/dyndata/Collection.h>.
+ * @param i		Generic iterator.
+ * @param I		Type of the generic iterator.
+ * @return		Built iterator.
+ */
+
 /**
  * @fn AbstractIter<T> *Iter::instance(void) const;
  * Get the instance of the @ref AbstractIter used.
  * @return	Abstract iterator instance.
  */
 
+/**
+ * @fn int Iter::offset(void) const;
+ * Get the position of the current item in the last batch read from
+ * the abstract iterator. Without batches (see @ref BATCHED), it is always 0.
+ * @return	Current item offset.
+ */
+
+/**
+ * @fn int Iter::fill(T *buf, int max);
+ * Copy the next items, at most max, in the given buffer and move the iterator
+ * after them.
+ * @param buf	Buffer to fill.
+ * @param max	Maximum number of items to copy.
+ * @return		Number of copied items (0 at end of iteration).
+ */
+
 
 /**
  * @class Collection
@@ -182,11 +269,23 @@ namespace elm { namespace dyndata {
  * @class IterInst
  * Build a @red dyndata iterator from a generic iterator.
  *
+ * The iterator implements the batch interface @ref AbstractIter::fill()
+ * and keeps a copy of the generic iterator at the start of the last batch
+ * in order to retrieve the position of any item of the batch with at().
+ *
  * @param T		Type of iterated values.
  * @param I		Type of the iterator.
  * @ingroup dyndata
  */
 
+/**
+ * @fn I IterInst::at(int k) const;
+ * Get a generic iterator on the k-th item of the last batch
+ * provided by fill().
+ * @param k		Item offset in the batch.
+ * @return		Generic iterator on the item.
+ */
+
 
 /**
  * @fn IterInst<T, I> *iter(const I& i);
@@ -38,6 +38,10 @@ namespace elm { namespace imm {
  * It is quite limited because it has no way to collect the living instances of the data structures items.
  * Therefore, it requires the user to specialize it and to provided a collect() function responsible
  * to supply the list of living data structure items.
+ *
+ * The persistent maps, @ref imm::map (balanced tree) and @ref imm::hash_map
+ * (hash-array-mapped trie), use reference counting instead: they release
+ * their nodes automatically and do not require any collector.
  */
 
 
@@ -0,0 +1,213 @@
+/*
+ *	imm::map and imm::hash_map classes implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/imm/map.h>
+#include <elm/imm/hash_map.h>
+
+namespace elm { namespace imm {
+
+/**
+ * @class map
+ * Persistent map implemented as an AVL tree with path copying: put() and
+ * remove() return a new map in O(log n) that shares all untouched nodes
+ * with the original one. Copying a map is O(1) and gives a snapshot that is
+ * never affected by later updates.
+ *
+ * Unlike @ref list, the nodes are reference-counted and released as soon as
+ * no map uses them: no @ref list::Collector is required. The reference
+ * counters are not atomic: a map and its snapshots must not be shared between threads
+ * without external synchronization.
+ *
+ * @param K		Type of keys.
+ * @param T		Type of values.
+ * @param C		Comparator of keys (default to Comparator<K>).
+ * @param E		Equivalence of values used by equals() (default to Equiv<T>).
+ * @ingroup imm
+ */
+
+/**
+ * @fn int map::count(void) const;
+ * Get the number of pairs in the map (O(1)).
+ * @return	Number of pairs.
+ */
+
+/**
+ * @fn bool map::same(const map& m) const;
+ * Test if both maps share the same root, that is, the same content.
+ * This test is O(1) but may return false for maps with equal content
+ * built independently.
+ * @param m		Map to compare with.
+ * @return		True if both maps are physically the same.
+ */
+
+/**
+ * @fn bool map::equals(const map& m) const;
+ * Test if both maps contain the same pairs. Shared maps are detected
+ * in O(1) by pointer identity.
+ * @param m		Map to compare with.
+ * @return		True if both maps are equal.
+ */
+
+/**
+ * @fn map map::put(const K& key, const T& val) const;
+ * Build a new map where the given key is associated with the given value.
+ * The current map is not modified.
+ * @param key	Key to set.
+ * @param val	Associated value.
+ * @return		New map.
+ */
+
+/**
+ * @fn map map::remove(const K& key) const;
+ * Build a new map without the given key. The current map is not modified.
+ * If the key is not in the map, the returned map is the same as the current one.
+ * @param key	Key to remove.
+ * @return		New map.
+ */
+
+/**
+ * @fn Option<T> map::get(const K& key) const;
+ * Look for a key.
+ * @param key	Looked key.
+ * @return		Associated value or none.
+ */
+
+/**
+ * @fn const T& map::get(const K& key, const T& def) const;
+ * Look for a key.
+ * @param key	Looked key.
+ * @param def	Default value.
+ * @return		Associated value or the default value.
+ */
+
+/**
+ * @fn bool map::hasKey(const K& key) const;
+ * Test if the key is in the map.
+ * @param key	Tested key.
+ * @return		True if the key is defined, false else.
+ */
+
+/**
+ * @fn Iterable<PairIter> map::pairs(void) const;
+ * Get an iterator on the (key, value) pairs in increasing order of keys.
+ * @return	Pair iterator.
+ */
+
+/**
+ * @fn Iterable<KeyIter> map::keys(void) const;
+ * Get an iterator on the keys in increasing order.
+ * @return	Key iterator.
+ */
+
+
+/**
+ * @class hash_map
+ * Persistent hash map implemented as a hash-array-mapped trie (HAMT).
+ * Each level of the trie consumes 5 bits of the key hash and the
+ * branch nodes only store their used children, selected by a 32-bit map.
+ * Keys whose hashes fully collide are chained in the same leaf.
+ *
+ * put() and remove() copy only the path from the root to the modified leaf,
+ * that is O(log32 n) nodes. Removal shrinks the trie so that the shape of the
+ * trie only depends on its content: equals() compares the maps structurally
+ * and stops on shared sub-tries in O(1).
+ *
+ * As @ref map, the nodes are reference-counted and the counters are not atomic.
+ *
+ * @param K		Type of keys.
+ * @param T		Type of values.
+ * @param H		Hash key (default to HashKey<K>).
+ * @param E		Equivalence of values used by equals() (default to Equiv<T>).
+ * @ingroup imm
+ */
+
+/**
+ * @fn int hash_map::count(void) const;
+ * Get the number of pairs in the map (O(1)).
+ * @return	Number of pairs.
+ */
+
+/**
+ * @fn bool hash_map::same(const hash_map& m) const;
+ * Test if both maps share the same root, that is, the same content.
+ * @param m		Map to compare with.
+ * @return		True if both maps are physically the same.
+ */
+
+/**
+ * @fn bool hash_map::equals(const hash_map& m) const;
+ * Test if both maps contain the same pairs.
+ * @param m		Map to compare with.
+ * @return		True if both maps are equal.
+ */
+
+/**
+ * @fn hash_map hash_map::put(const K& key, const T& val) const;
+ * Build a new map where the given key is associated with the given value.
+ * The current map is not modified.
+ * @param key	Key to set.
+ * @param val	Associated value.
+ * @return		New map.
+ */
+
+/**
+ * @fn hash_map hash_map::remove(const K& key) const;
+ * Build a new map without the given key. The current map is not modified.
+ * If the key is not in the map, the returned map is the same as the current one.
+ * @param key	Key to remove.
+ * @return		New map.
+ */
+
+/**
+ * @fn Option<T> hash_map::get(const K& key) const;
+ * Look for a key.
+ * @param key	Looked key.
+ * @return		Associated value or none.
+ */
+
+/**
+ * @fn const T& hash_map::get(const K& key, const T& def) const;
+ * Look for a key.
+ * @param key	Looked key.
+ * @param def	Default value.
+ * @return		Associated value or the default value.
+ */
+
+/**
+ * @fn bool hash_map::hasKey(const K& key) const;
+ * Test if the key is in the map.
+ * @param key	Tested key.
+ * @return		True if the key is defined, false else.
+ */
+
+/**
+ * @fn Iterable<PairIter> hash_map::pairs(void) const;
+ * Get an iterator on the (key, value) pairs (in no specific order).
+ * @return	Pair iterator.
+ */
+
+/**
+ * @fn Iterable<KeyIter> hash_map::keys(void) const;
+ * Get an iterator on the keys (in no specific order).
+ * @return	Key iterator.
+ */
+
+} }	// elm::imm
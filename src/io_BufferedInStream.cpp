@@ -76,6 +76,13 @@ BufferedInStream::~BufferedInStream(void) {
  */
 
 
+/**
+ * @fn int BufferedInStream::available(void) const;
+ * Get the number of bytes read from the buffered stream but not consumed yet.
+ * @return	Number of bytes in the buffer.
+ */
+
+
 /**
  * Set the current stream to read. The buffer is reset.
  * @param str	New stream.
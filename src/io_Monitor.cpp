@@ -20,6 +20,7 @@
  *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 #include <elm/io/Monitor.h>
+#include <elm/log/Logger.h>
 #include <elm/sys/SystemIO.h>
 
 namespace elm { namespace io {
@@ -31,6 +32,9 @@ namespace elm { namespace io {
  * it provides access to standard input/output to communicate with the user
  * but it may be customized in any way without need of customization of classes
  * based on this class.
+ *
+ * Messages are passed to the @ref log::Logger: they are filtered according
+ * to the logger level and, if the logger is started, written asynchronously.
  * @ingroup ios
  */
 
@@ -54,6 +58,7 @@ Monitor::Monitor(const Monitor& monitor): out(monitor.out), err(monitor.err), lo
 /**
  */
 Monitor::~Monitor(void) {
+	log::Logger::flush();
 }
 
 
@@ -62,7 +67,10 @@ Monitor::~Monitor(void) {
  * @param message	Message to display.
  */
 void Monitor::info(const string& message) {
-	err << "INFO: " << message << io::endl;
+	if(log::Logger::isEnabled(log::Logger::INFO)) {
+		log::Capture c(log::Logger::INFO, err);
+		c << message;
+	}
 }
 
 
@@ -71,7 +79,10 @@ void Monitor::info(const string& message) {
  * @param message	Message to display.
  */
 void Monitor::error(const string& message) {
-	err << "ERROR: " << message << io::endl;
+	if(log::Logger::isEnabled(log::Logger::ERROR)) {
+		log::Capture c(log::Logger::ERROR, err);
+		c << message;
+	}
 }
 
 
@@ -80,7 +91,10 @@ void Monitor::error(const string& message) {
  * @param message	Message to display.
  */
 void Monitor::warn(const string& message) {
-	err << "WARNING: " << message << io::endl;
+	if(log::Logger::isEnabled(log::Logger::WARNING)) {
+		log::Capture c(log::Logger::WARNING, err);
+		c << message;
+	}
 }
 
 
@@ -23,14 +23,213 @@
 #include <elm/io/InStream.h>
 #include <elm/io/OutStream.h>
 #include <elm/assert.h>
+#include <string.h>
+#if defined(__linux__)
+#	include <errno.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#	include <sys/sendfile.h>
+#	include <sys/stat.h>
+#	include <elm/io/BufferedInStream.h>
+#	include <elm/io/BufferedOutStream.h>
+#	include <elm/io/TeeOutStream.h>
+#	include <elm/io/UnixInStream.h>
+#	include <elm/io/UnixOutStream.h>
+#endif
 
 namespace elm { namespace io {
 
+#if defined(__linux__)
+
+// result when the kernel cannot perform the copy
+static const t::int64 UNSUPPORTED = -2;
+
+// largest block passed to the kernel at once
+static const size_t CHUNK = 1 << 30;
+
+// get the file descriptor of a stream or -1 (looking through empty buffers)
+static int fdOf(InStream& in) {
+	BufferedInStream *b = dynamic_cast<BufferedInStream *>(&in);
+	if(b != nullptr)
+		return b->available() == 0 ? fdOf(b->stream()) : -1;
+	UnixInStream *s = dynamic_cast<UnixInStream *>(&in);
+	return s == nullptr ? -1 : s->fd();
+}
+static int fdOf(OutStream& out) {
+	BufferedOutStream *b = dynamic_cast<BufferedOutStream *>(&out);
+	if(b != nullptr)
+		return fdOf(b->stream());
+	UnixOutStream *s = dynamic_cast<UnixOutStream *>(&out);
+	return s == nullptr ? -1 : s->fd();
+}
+
+// test if a descriptor is open in append mode (rejected by splice() and
+// sendfile() only once some input may have been consumed)
+static inline bool appends(int fd) {
+	int f = fcntl(fd, F_GETFL);
+	return f >= 0 && (f & O_APPEND) != 0;
+}
+
+// test if the error means the kernel does not support the copy
+static inline bool unsupported(int e)
+	{ return e == EINVAL || e == ENOSYS || e == EXDEV || e == EOPNOTSUPP || e == EBADF; }
+
+// call f() until it returns 0 (end of input)
+template <class F>
+static t::int64 repeat(F f) {
+	t::int64 size = 0;
+	while(true) {
+		ssize_t r = f();
+		if(r > 0)
+			size += r;
+		else if(r == 0)
+			return size;
+		else if(errno == EINTR)
+			continue;
+		else if(size == 0 && unsupported(errno))
+			return UNSUPPORTED;
+		else
+			return -1;
+	}
+}
+
+// move exactly size bytes from a pipe to a descriptor
+static bool drain(int pipe, int out, t::int64 size) {
+	while(size > 0) {
+		ssize_t r = splice(pipe, nullptr, out, nullptr, size, SPLICE_F_MOVE | SPLICE_F_MORE);
+		if(r > 0)
+			size -= r;
+		else if(r < 0 && errno == EINTR)
+			continue;
+		else
+			return false;
+	}
+	return true;
+}
+
+// build a pipe of the given capacity
+static bool makePipe(int p[2], int size) {
+	if(pipe2(p, O_CLOEXEC) < 0)
+		return false;
+	fcntl(p[1], F_SETPIPE_SZ, size);
+	return true;
+}
+
+// copy between descriptors with the best available system call
+static t::int64 copy(int in, int out, int bufs) {
+	struct stat is, os;
+	if(fstat(in, &is) < 0 || fstat(out, &os) < 0)
+		return UNSUPPORTED;
+	t::int64 r;
+
+	// from a regular file (empty size for special files like /proc ones)
+	if(S_ISREG(is.st_mode) && is.st_size > 0) {
+		if(S_ISREG(os.st_mode)) {
+			r = repeat([in, out]() { return copy_file_range(in, nullptr, out, nullptr, CHUNK, 0); });
+			if(r != UNSUPPORTED)
+				return r;
+		}
+		r = repeat([in, out]() { return sendfile(out, in, nullptr, CHUNK); });
+		if(r != UNSUPPORTED)
+			return r;
+	}
+
+	// one end is a pipe
+	if(S_ISFIFO(is.st_mode) || S_ISFIFO(os.st_mode)) {
+		r = repeat([in, out]() { return splice(in, nullptr, out, nullptr, CHUNK, SPLICE_F_MOVE | SPLICE_F_MORE); });
+		if(r != UNSUPPORTED)
+			return r;
+	}
+
+	// through an intermediate pipe
+	int p[2];
+	if(!makePipe(p, bufs))
+		return UNSUPPORTED;
+	t::int64 size = 0;
+	while(true) {
+		ssize_t n = splice(in, nullptr, p[1], nullptr, bufs, SPLICE_F_MOVE | SPLICE_F_MORE);
+		if(n == 0)
+			break;
+		else if(n < 0) {
+			if(errno == EINTR)
+				continue;
+			size = size == 0 && unsupported(errno) ? UNSUPPORTED : -1;
+			break;
+		}
+		if(!drain(p[0], out, n)) {
+			size = -1;
+			break;
+		}
+		size += n;
+	}
+	int e = errno;
+	close(p[0]);
+	close(p[1]);
+	errno = e;
+	return size;
+}
+
+// copy to two descriptors, duplicating the data with tee()
+static t::int64 copy(int in, int out1, int out2, int bufs) {
+	int a[2], b[2];
+	if(!makePipe(a, bufs))
+		return UNSUPPORTED;
+	if(!makePipe(b, bufs)) {
+		close(a[0]);
+		close(a[1]);
+		return UNSUPPORTED;
+	}
+	t::int64 size = 0;
+	bool ok = true;
+	while(ok) {
+		ssize_t n = splice(in, nullptr, a[1], nullptr, bufs, SPLICE_F_MOVE | SPLICE_F_MORE);
+		if(n == 0)
+			break;
+		else if(n < 0) {
+			if(errno == EINTR)
+				continue;
+			size = size == 0 && unsupported(errno) ? UNSUPPORTED : -1;
+			break;
+		}
+		while(ok && n > 0) {
+			ssize_t d = tee(a[0], b[1], n, 0);
+			if(d < 0 && errno == EINTR)
+				continue;
+			ok = d > 0 && drain(b[0], out2, d) && drain(a[0], out1, d);
+			n -= d;
+			size += d;
+		}
+		if(!ok)
+			size = -1;
+	}
+	int e = errno;
+	close(a[0]);
+	close(a[1]);
+	close(b[0]);
+	close(b[1]);
+	errno = e;
+	return size;
+}
+
+#endif
+
 /**
  * @class StreamPipe
  * A stream pipe allows to pipe together a string of input stream and a string
  * of output stream. When the @ref proceed() method is called, the input stream
  * is read to the end and write back to the output stream.
+ *
+ * On Linux, when both streams are backed by file descriptors (@ref UnixInStream,
+ * @ref UnixOutStream and their sub-classes like system files, pipes or
+ * network connections, possibly wrapped in empty buffered streams), the bytes are moved by the kernel without passing
+ * through the pipe buffer: copy_file_range() between regular files,
+ * sendfile() from a regular file, splice() otherwise. If the output is
+ * a @ref TeeOutStream whose both outputs are backed by file descriptors,
+ * the data is duplicated with tee(). If the kernel does not support
+ * the copy, the stream pipe falls back to read and write through its buffer.
+ * Outputs opened in append mode (like the ones of System::appendFile())
+ * always use the buffer as the kernel refuses to splice to them.
+ * This behavior can be disabled with setZeroCopy().
  * @ingroup ios
  */
 
@@ -42,7 +241,7 @@ namespace elm { namespace io {
  * @param buffer_size	Size of the buffer.
  */
 StreamPipe::StreamPipe(InStream& in, OutStream& out, int buffer_size)
-: _in(in), _out(out), state(OK), bufs(buffer_size), buf(new char[buffer_size]) {
+: _in(in), _out(out), state(OK), bufs(buffer_size), buf(nullptr), zero(true), err(0) {
 }
 
 
@@ -58,6 +257,41 @@ StreamPipe::~StreamPipe(void) {
  * @return	Number of copied bytes or <0 if there is an error.
  */
 int StreamPipe::proceed(void) {
+
+#	if defined(__linux__)
+		int in = zero ? fdOf(_in) : -1;
+		if(in >= 0) {
+			t::int64 r = UNSUPPORTED;
+			TeeOutStream *tee = dynamic_cast<TeeOutStream *>(&_out);
+			int out = -1, out2 = -1;
+			if(tee != nullptr) {
+				out = fdOf(tee->out1());
+				out2 = fdOf(tee->out2());
+			}
+			else
+				out = fdOf(_out);
+			if(out >= 0 && (tee == nullptr || out2 >= 0) && !appends(out) && (out2 < 0 || !appends(out2))) {
+				if(_out.flush() < 0) {
+					state = OUT_ERROR;
+					return -1;
+				}
+				if(tee != nullptr)
+					r = copy(in, out, out2, bufs);
+				else
+					r = copy(in, out, bufs);
+			}
+			if(r == -1) {
+				err = errno;
+				state = SYS_ERROR;
+				return -1;
+			}
+			else if(r >= 0)
+				return int(r);
+		}
+#	endif
+
+	if(buf == nullptr)
+		buf = new char[bufs];
 	int size = 0;
 	while(true) {
 
@@ -67,7 +301,7 @@ int StreamPipe::proceed(void) {
 			state = IN_ERROR;
 			return -1;
 		}
-		else if(inr == InStream::ENDED)
+		else if(inr == 0 || inr == InStream::ENDED)
 			break;
 
 		// write the result
@@ -82,6 +316,21 @@ int StreamPipe::proceed(void) {
 }
 
 
+/**
+ * @fn bool StreamPipe::zeroCopy(void) const;
+ * Test if the copy performed by the kernel is enabled.
+ * @return	True if zero-copy is enabled (default), false else.
+ */
+
+
+/**
+ * @fn void StreamPipe::setZeroCopy(bool enabled);
+ * Enable or disable the copy performed by the kernel when both streams
+ * are backed by file descriptors.
+ * @param enabled	True to enable zero-copy, false to always use the buffer.
+ */
+
+
 /**
  * Get the message associated with the last error.
  * @return	Last error message.
@@ -91,6 +340,7 @@ string StreamPipe::lastErrorMessage(void) const {
 	case OK:		return "Success";
 	case IN_ERROR:	return _in.lastErrorMessage();
 	case OUT_ERROR:	return _out.lastErrorMessage();
+	case SYS_ERROR:	return strerror(err);
 	}
 	return "invalid state";
 }
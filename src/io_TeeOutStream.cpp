@@ -28,6 +28,9 @@ namespace elm { namespace io {
  * This class allows to divert the byte stream to two different outputs.
  * This may be useful to perform an output while performing a parallel
  * processing of the streamed data: size computation, checksumming, etc.
+ *
+ * When used as output of a @ref StreamPipe with both outputs backed by file
+ * descriptors, the data is duplicated by the kernel with tee().
  * @ingroup ios
  */
 
@@ -37,6 +40,18 @@ TeeOutStream::TeeOutStream(OutStream& out1, OutStream& out2)
 : _out1(out1), _out2(out2), state(OK) {
 }
 
+/**
+ * @fn OutStream& TeeOutStream::out1(void) const;
+ * Get the first output.
+ * @return	First output stream.
+ */
+
+/**
+ * @fn OutStream& TeeOutStream::out2(void) const;
+ * Get the second output.
+ * @return	Second output stream.
+ */
+
 /**
  */
 int TeeOutStream::write (const char *buffer, int size) {
@@ -21,7 +21,7 @@
 
 #include <elm/io/BufferedInStream.h>
 #include <elm/json/Parser.h>
-#include <elm/string/utf16.h>
+#include <elm/string/utf8.h>
 #include <elm/sys/System.h>
 
 namespace elm { namespace json {
@@ -404,12 +404,14 @@ Parser::token_t Parser::parseNumber(io::InStream& in, char c, int base)  {
 
 
 /**
- * Parse a string with support of escapes.
+ * Parse a string with support of escapes. Escaped UTF-16 characters, including
+ * surrogate pairs, are converted to UTF-8 and the resulting string must be
+ * valid UTF-8.
  * @param in	Input stream.
  * @param q		First quote.
  */
 void Parser::parseString(io::InStream& in, char q) {
-	static string escapes = "\"\'\\/bfnrt";
+	static string escapes = "\"\'\\/bfnrt", values = "\"\'\\/\b\f\n\r\t";
 	StringBuffer buf;
 	char c = nextChar(in);
 	while(c != q) {
@@ -417,25 +419,53 @@ void Parser::parseString(io::InStream& in, char q) {
 			buf << c;
 		else {
 			c = nextChar(in);
-			if(escapes.indexOf(c) >= 0)
-				text << c;
+			int i = escapes.indexOf(c);
+			if(i >= 0)
+				buf << values[i];
 			else if(c != 'u')
 				error("bad escape in string");
 			else {
-				int wc = 0;
-				for(int i = 0; i < 4; i++) {
-					c = nextChar(in);
-					int d = Char(c).asHex();
-					if(d < 0)
-						error("hex digit expected here");
-					wc = (wc << 4) | d;
-					utf16::Char(wc).toUTF8(buf);
+				t::uint16 wc[2];
+				int n = 0;
+				wc[n++] = parseHex(in);
+				if(0xD800 <= wc[0] && wc[0] < 0xDC00) {
+					if(nextChar(in) != '\\' || nextChar(in) != 'u')
+						error("unpaired surrogate in string");
+					wc[n++] = parseHex(in);
+				}
+				char cs[4];
+				try {
+					t::size l = utf8::fromUTF16(wc, n, cs);
+					for(t::size j = 0; j < l; j++)
+						buf << cs[j];
+				}
+				catch(utf8::Exception& e) {
+					error("unpaired surrogate in string");
 				}
 			}
 		}
 		c = nextChar(in);
 	}
 	text = buf.toString();
+	if(!utf8::isValid(text))
+		error("invalid UTF-8 in string");
+}
+
+
+/**
+ * Parse the 4 hexadecimal digits of an UTF-16 escape.
+ * @param in	Input stream.
+ * @return		Parsed UTF-16 unit.
+ */
+t::uint16 Parser::parseHex(io::InStream& in) {
+	t::uint16 wc = 0;
+	for(int i = 0; i < 4; i++) {
+		int d = Char(nextChar(in)).asHex();
+		if(d < 0)
+			error("hex digit expected here");
+		wc = (wc << 4) | d;
+	}
+	return wc;
 }
 
 
@@ -0,0 +1,798 @@
+/*
+ *	Logger class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <elm/concur/Waiter.h>
+#include <elm/sys/Futex.h>
+#include <elm/data/Vector.h>
+#include <elm/io/BufferedOutStream.h>
+#include <elm/log/Log.h>
+#include <elm/sys/Mutex.h>
+#include <elm/sys/Thread.h>
+
+namespace elm { namespace log {
+
+/**
+ * @class Logger
+ * Back-end of the logging facilities of ELM: it is used by the ELM_DBG*
+ * macros, by @ref io::Monitor and by the ELM_LOG macro.
+ *
+ * By default, messages are formatted and written synchronously, as
+ * soon as they are produced. After a call to start(), the logger works
+ * asynchronously: the arguments of a message are only captured, in binary form,
+ * in a ring buffer owned by the producing thread and a background thread
+ * collects the messages of all threads, in time order, formats them
+ * and writes them by batches. This makes logging cheap for the producing
+ * thread: no lock, no memory allocation and no formatting is needed for
+ * integers, floats, characters, pointers and strings. Other argument types
+ * are formatted eagerly into a string that is then captured.
+ *
+ * A message longer than @ref DATA_SIZE bytes is not lost: it is formatted
+ * eagerly and passed as a string to the background thread.
+ *
+ * When the ring of a thread is full, the thread either waits for the background
+ * thread to make room (@ref BLOCK policy, the default) or drops the message
+ * (@ref DROP policy, see dropped()).
+ *
+ * In asynchronous mode, the background thread only writes to the outputs
+ * owned by the logger, so that it never races with the writes performed
+ * directly on the outputs of the application nor uses a destroyed output:
+ * @li the messages to @ref elm::cout, @ref elm::cerr or any output on their
+ *     streams (like the default outputs of @ref io::Monitor) are written
+ *     to the standard output and error by outputs owned by the logger,
+ * @li the outputs returned by open() are owned by the logger until close().
+ * The messages to other outputs are written synchronously. The writes of
+ * the logger to an owned output are serialized by a lock of this output.
+ *
+ * Messages may be filtered by level:
+ * @li at run time with setLevel(),
+ * @li at compile time by defining the ELM_LOG_LEVEL macro to the lowest
+ *     level to keep: messages of lower level are removed by the compiler.
+ *
+ * stop() is automatically called at program exit.
+ *
+ * @ingroup log
+ */
+
+/**
+ * @enum Logger::level_t
+ * Level of a log message.
+ */
+
+/**
+ * @var Logger::level_t Logger::TRACE;
+ * Very detailed tracing messages.
+ */
+
+/**
+ * @var Logger::level_t Logger::DEBUG;
+ * Debugging message, used by ELM_DBG* macros.
+ */
+
+/**
+ * @var Logger::level_t Logger::INFO;
+ * Information message, used by @ref io::Monitor::info().
+ */
+
+/**
+ * @var Logger::level_t Logger::WARNING;
+ * Warning message, used by @ref io::Monitor::warn().
+ */
+
+/**
+ * @var Logger::level_t Logger::ERROR;
+ * Error message, used by @ref io::Monitor::error().
+ */
+
+/**
+ * @var Logger::level_t Logger::OFF;
+ * Used with setLevel() to disable all messages.
+ */
+
+/**
+ * @enum Logger::policy_t
+ * Behaviour of a producing thread when its ring is full.
+ */
+
+/**
+ * @var Logger::policy_t Logger::BLOCK;
+ * The thread waits until there is room in the ring.
+ */
+
+/**
+ * @var Logger::policy_t Logger::DROP;
+ * The message is dropped and counted (see dropped()).
+ */
+
+/**
+ * Default number of messages in the ring of a thread.
+ */
+const int Logger::RING_SIZE;
+
+/**
+ * Number of bytes available to capture the arguments of a message.
+ */
+const int Logger::DATA_SIZE;
+
+/**
+ * Maximum number of outputs opened with open() at the same time.
+ */
+const int Logger::SINKS;
+
+/**
+ * @fn level_t Logger::level(void);
+ * Get the current minimal level of displayed messages.
+ * @return	Current minimal level.
+ */
+
+/**
+ * @fn void Logger::setLevel(level_t level);
+ * Set the minimal level of displayed messages.
+ * @param level	New minimal level.
+ */
+
+/**
+ * @fn bool Logger::isEnabled(level_t level);
+ * Test if messages of the given level are displayed,
+ * according to the run-time level and to ELM_LOG_LEVEL.
+ * @param level	Tested level.
+ * @return		True if the messages are displayed, false else.
+ */
+
+/**
+ * @fn bool Logger::isAsync(void);
+ * Test if the logger works asynchronously.
+ * @return	True if asynchronous, false else.
+ */
+
+/**
+ * @fn policy_t Logger::policy(void);
+ * Get the policy applied when the ring of a thread is full.
+ * @return	Current policy.
+ */
+
+/**
+ * @fn void Logger::setPolicy(policy_t policy);
+ * Set the policy applied when the ring of a thread is full.
+ * @param policy	New policy.
+ */
+
+/**
+ * @fn int Logger::ringSize(void);
+ * Get the number of messages of the rings created for new threads.
+ * @return	Ring size.
+ */
+
+sys::Atomic<int> Logger::_level(Logger::TRACE);
+sys::Atomic<int> Logger::_policy(Logger::BLOCK);
+sys::Atomic<bool> Logger::_async(false);
+int Logger::_ring_size = Logger::RING_SIZE;
+
+
+// per-thread ring of messages
+class Logger::Ring {
+public:
+	typedef t::size index_t;
+
+	Ring(int size): dropped(0), closed(false), next(nullptr), _hd(0), _tl(0), _hd_cache(0) {
+		_cap = size;
+		_mask = size - 1;
+		_buf = new record_t[size];
+	}
+	~Ring(void) { delete [] _buf; }
+
+	// producer side
+	inline record_t *acquire(void) {
+		index_t tl = _tl.load(sys::RELAXED);
+		if(tl - _hd_cache == _cap) {
+			_hd_cache = _hd.load(sys::ACQUIRE);
+			if(tl - _hd_cache == _cap)
+				return nullptr;
+		}
+		return &_buf[tl & _mask];
+	}
+	inline void commit(void) { _tl.store(_tl.load(sys::RELAXED) + 1, sys::RELEASE); }
+
+	// consumer side
+	inline index_t head(void) const { return _hd.load(sys::RELAXED); }
+	inline index_t tail(void) const { return _tl.load(sys::ACQUIRE); }
+	inline record_t& at(index_t i) const { return _buf[i & _mask]; }
+	inline void release(index_t hd) { _hd.store(hd, sys::RELEASE); }
+	inline bool isEmpty(void) const { return _hd.load(sys::ACQUIRE) == _tl.load(sys::ACQUIRE); }
+
+	sys::Atomic<t::uint64> dropped;
+	sys::Atomic<bool> closed;
+	Ring *next;
+
+private:
+	record_t *_buf;
+	index_t _cap, _mask;
+	char _pad0[concur::CACHE_LINE];
+	sys::Atomic<index_t> _hd;
+	char _pad1[concur::CACHE_LINE];
+	sys::Atomic<index_t> _tl;
+	index_t _hd_cache;
+};
+
+
+// output owned by the logger
+class Logger::Sink {
+public:
+	Sink(io::OutStream& stream, bool buffered = false)
+		: buf(buffered ? new io::BufferedOutStream(stream) : nullptr), out(buf != nullptr ? *buf : stream) { }
+	~Sink(void) { out.flush(); delete buf; }
+	io::BufferedOutStream *buf;
+	io::Output out;
+	sys::Mutex lock;
+};
+
+Logger::Sink *Logger::_std[2] = { nullptr, nullptr };
+sys::Atomic<Logger::Sink *> Logger::_sinks[Logger::SINKS];
+
+
+// ring owner of the current thread
+class Logger::Holder {
+public:
+	inline Holder(void): ring(nullptr) { }
+	inline ~Holder(void) { if(ring != nullptr) ring->closed.store(true, sys::RELEASE); }
+	Ring *ring;
+};
+
+thread_local Logger::Holder Logger::_holder;
+
+
+// background thread
+class Logger::Consumer: public sys::Runnable {
+public:
+	Consumer(void): seq(0), sleeping(false), rings(nullptr), thread(nullptr), lost(0), quit(false) { }
+
+	~Consumer(void) {
+		while(rings != nullptr) {
+			Ring *r = rings;
+			rings = r->next;
+			delete r;
+		}
+	}
+
+	// The thread only sleeps when all rings are empty and producers only
+	// pay a system call for the first message following the sleep.
+	void run(void) override {
+		while(true) {
+			if(drain() != 0) {
+				std::this_thread::yield();
+				continue;
+			}
+			if(quit.load(sys::ACQUIRE))
+				break;
+			t::uint32 k = seq.load(sys::ACQUIRE);
+			sleeping.store(true);
+			sys::fence();
+			if(drain() != 0 || quit.load(sys::ACQUIRE)) {
+				sleeping.store(false);
+				continue;
+			}
+			while(sleeping.load(sys::ACQUIRE) && seq.load(sys::ACQUIRE) == k)
+				sys::Futex::wait(seq, k);
+		}
+	}
+
+	inline void wake(void) {
+		sys::fence();
+		if(sleeping.load(sys::RELAXED) && sleeping.exchange(false)) {
+			seq.fetchAdd(1, sys::RELEASE);
+			sys::Futex::wake(seq);
+		}
+	}
+
+	sys::Mutex lock;
+	sys::Futex::word_t seq;
+	sys::Atomic<bool> sleeping;
+	Ring *rings;
+	sys::Thread *thread;
+	t::uint64 lost;
+	sys::Atomic<bool> quit;
+
+private:
+	typedef struct run_t {
+		Ring *ring;
+		Ring::index_t hd, tl;
+	} run_t;
+
+	// write the pending messages of all threads, in time order
+	int drain(void) {
+		sys::Guard<sys::Mutex> guard(lock);
+
+		// take a snapshot of the rings
+		runs.setLength(0);
+		for(Ring **p = &rings; *p != nullptr;) {
+			Ring *r = *p;
+			bool closed = r->closed.load(sys::ACQUIRE);
+			run_t run = { r, r->head(), r->tail() };
+			if(run.hd == run.tl) {
+				if(closed) {
+					*p = r->next;
+					lost += r->dropped.load(sys::RELAXED);
+					delete r;
+					continue;
+				}
+			}
+			else
+				runs.add(run);
+			p = &r->next;
+		}
+
+		// merge the runs
+		int n = 0;
+		while(true) {
+			int b = -1;
+			for(int i = 0; i < runs.count(); i++)
+				if(runs[i].hd != runs[i].tl
+				&& (b < 0 || runs[i].ring->at(runs[i].hd).time < runs[b].ring->at(runs[b].hd).time))
+					b = i;
+			if(b < 0)
+				break;
+			record_t& r = runs[b].ring->at(runs[b].hd++);
+			{
+				sys::Guard<sys::Mutex> g(r.sink->lock);
+				Logger::write(r.sink->out, r, false);
+			}
+			delete r.spill;
+			if(!sinks.contains(r.sink))
+				sinks.add(r.sink);
+			n++;
+		}
+
+		// flush and release
+		for(auto s: sinks) {
+			sys::Guard<sys::Mutex> g(s->lock);
+			s->out.flush();
+		}
+		sinks.setLength(0);
+		for(const auto& run: runs)
+			run.ring->release(run.tl);
+		return n;
+	}
+
+	Vector<run_t> runs;
+	Vector<Sink *> sinks;
+};
+
+
+
+// get the consumer
+Logger::Consumer& Logger::consumer(void) {
+	static Consumer c;
+	return c;
+}
+
+
+// get the ring of the current thread
+Logger::Ring *Logger::ring(void) {
+	if(_holder.ring == nullptr) {
+		Ring *r = new Ring(_ring_size);
+		Consumer& c = consumer();
+		sys::Guard<sys::Mutex> guard(c.lock);
+		r->next = c.rings;
+		c.rings = r;
+		_holder.ring = r;
+	}
+	return _holder.ring;
+}
+
+
+// wake up the background thread
+void Logger::wake(void) {
+	consumer().wake();
+}
+
+
+/**
+ * Set the number of messages of the rings of the threads that have not
+ * produced any message yet (rounded up to a power of 2).
+ * @param size	Ring size (must be positive).
+ */
+void Logger::setRingSize(int size) {
+	ASSERTP(size > 0, "ring size must be positive");
+	int s = 1;
+	while(s < size)
+		s <<= 1;
+	_ring_size = s;
+}
+
+
+/**
+ * Start the asynchronous mode: a background thread is launched to format
+ * and write the messages. Does nothing if the logger is already started.
+ * start() and stop() must not be called concurrently.
+ */
+void Logger::start(void) {
+	static bool registered = false;
+	Consumer& c = consumer();
+	if(c.thread != nullptr)
+		return;
+	if(_std[0] == nullptr) {
+		_std[0] = new Sink(io::out, true);
+		_std[1] = new Sink(io::err, true);
+	}
+	c.quit.store(false);
+	c.thread = sys::Thread::make(c);
+	c.thread->start();
+	_async.store(true);
+	if(!registered) {
+		registered = true;
+		std::atexit(stop);
+	}
+}
+
+
+/**
+ * Stop the asynchronous mode: the pending messages are written and
+ * the background thread is stopped. Following messages are written
+ * synchronously. Does nothing if the logger is not started.
+ */
+void Logger::stop(void) {
+	Consumer& c = consumer();
+	if(c.thread == nullptr)
+		return;
+	_async.store(false);
+	flush();
+	c.quit.store(true, sys::RELEASE);
+	c.wake();
+	c.thread->join();
+	delete c.thread;
+	c.thread = nullptr;
+}
+
+
+/**
+ * Wait until all messages produced before the call are written
+ * and their outputs flushed. Does nothing in synchronous mode.
+ */
+void Logger::flush(void) {
+	Consumer& c = consumer();
+	if(c.thread == nullptr)
+		return;
+	while(true) {
+		{
+			sys::Guard<sys::Mutex> guard(c.lock);
+			bool empty = true;
+			for(Ring *r = c.rings; empty && r != nullptr; r = r->next)
+				empty = r->isEmpty();
+			if(empty)
+				return;
+		}
+		c.wake();
+		std::this_thread::yield();
+	}
+}
+
+
+/**
+ * Build an output owned by the logger: in asynchronous mode, the messages
+ * written to it are formatted and written by the background thread.
+ * The output is owned by the logger until close() is called.
+ * @param stream	Stream to write to (must remain alive until close()).
+ * @return			Opened output.
+ */
+io::Output& Logger::open(io::OutStream& stream) {
+	Sink *s = new Sink(stream);
+	for(int i = 0; i < SINKS; i++) {
+		Sink *e = nullptr;
+		if(_sinks[i].compareExchange(e, s, sys::RELEASE))
+			return s->out;
+	}
+	delete s;
+	ASSERTP(false, "too many outputs opened in the logger");
+	return cerr;
+}
+
+
+/**
+ * Close an output returned by open(): its pending messages are written and
+ * the output is released. No message must be produced on this output
+ * during or after the call.
+ * @param out	Output to close.
+ */
+void Logger::close(io::Output& out) {
+	for(int i = 0; i < SINKS; i++) {
+		Sink *s = _sinks[i].load(sys::ACQUIRE);
+		if(s != nullptr && &s->out == &out) {
+			flush();
+			_sinks[i].store(nullptr, sys::RELEASE);
+			{
+				sys::Guard<sys::Mutex> g(s->lock);
+				s->out.flush();
+			}
+			delete s;
+			return;
+		}
+	}
+	ASSERTP(false, "output not opened in the logger");
+}
+
+
+// find the owned output to write to in place of the given one, if any
+Logger::Sink *Logger::find(io::Output& out) {
+	for(int i = 0; i < SINKS; i++) {
+		Sink *s = _sinks[i].load(sys::ACQUIRE);
+		if(s != nullptr && &s->out == &out)
+			return s;
+	}
+	if(_std[0] != nullptr && isAsync()) {
+		io::OutStream *st = &out.stream();
+		if(st == &cout.stream() || st == &io::out)
+			return _std[0];
+		if(st == &cerr.stream() || st == &io::err)
+			return _std[1];
+	}
+	return nullptr;
+}
+
+
+/**
+ * Get the number of messages dropped because of a full ring
+ * (only with the @ref DROP policy).
+ * @return	Number of dropped messages.
+ */
+t::uint64 Logger::dropped(void) {
+	Consumer& c = consumer();
+	sys::Guard<sys::Mutex> guard(c.lock);
+	t::uint64 n = c.lost;
+	for(Ring *r = c.rings; r != nullptr; r = r->next)
+		n += r->dropped.load(sys::RELAXED);
+	return n;
+}
+
+
+/**
+ * Get the name of a level.
+ * @param level	Level to get name for.
+ * @return		Level name.
+ */
+cstring Logger::name(level_t level) {
+	static cstring names[] = { "TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "OFF" };
+	return names[level];
+}
+
+
+// print a captured argument
+void Logger::print(io::Output& out, int tag, const char *p) {
+	switch(tag) {
+	case INT32:		{ t::int32 v; memcpy(&v, p, sizeof(v)); out << v; } break;
+	case UINT32:	{ t::uint32 v; memcpy(&v, p, sizeof(v)); out << v; } break;
+	case INT64:		{ t::int64 v; memcpy(&v, p, sizeof(v)); out << v; } break;
+	case UINT64:	{ t::uint64 v; memcpy(&v, p, sizeof(v)); out << v; } break;
+	case DOUBLE:	{ double v; memcpy(&v, p, sizeof(v)); out << v; } break;
+	case CHAR:		out << *p; break;
+	case BOOL:		{ bool v; memcpy(&v, p, sizeof(v)); out << v; } break;
+	case POINTER:	{ void *v; memcpy(&v, p, sizeof(v)); out.print(v); } break;
+	default:		ASSERTP(false, "bad log tag"); break;
+	}
+}
+
+
+// print the captured arguments of a message
+void Logger::decode(io::Output& out, const record_t& r) {
+	static const int sizes[] = { 0, 4, 4, 8, 8, sizeof(double), 1, sizeof(bool), sizeof(void *), 0 };
+	const char *p = r.data, *e = r.data + r.size;
+	while(p < e) {
+		int tag = *p++;
+		if(tag == STRING) {
+			t::uint16 n;
+			memcpy(&n, p, sizeof(n));
+			p += sizeof(n);
+			out.stream().write(p, n);
+			p += n;
+		}
+		else {
+			print(out, tag, p);
+			p += sizes[tag];
+		}
+	}
+	if(r.spill != nullptr)
+		out << *r.spill;
+}
+
+
+// format and write a message
+void Logger::write(io::Output& out, const record_t& r, bool sync) {
+	if(r.style == Capture::TAG)
+		out << name(level_t(r.level)) << ": ";
+	else if(r.style >= Capture::DEBUG)
+		out << Debug::debugPrefix(r.file, r.line);
+	decode(out, r);
+	if(r.style >= Capture::DEBUG)
+		out << color::RCol();
+	if(r.style == Capture::LINE || r.style == Capture::TAG || r.style == Capture::DEBUG_LINE) {
+		if(sync)
+			out << io::endl;
+		else
+			out << '\n';
+	}
+}
+
+
+/**
+ * @class Capture
+ * A capture records the arguments of a log message passed with the
+ * << operator and sends the message to the @ref Logger at destruction time.
+ * It is commonly used through the ELM_LOG or ELM_DBG* macros.
+ * @ingroup log
+ */
+
+/**
+ * @enum Capture::style_t
+ * Formatting style of a message.
+ */
+
+/**
+ * @var Capture::style_t Capture::PLAIN;
+ * Message displayed as is.
+ */
+
+/**
+ * @var Capture::style_t Capture::LINE;
+ * Message followed by a new line.
+ */
+
+/**
+ * @var Capture::style_t Capture::TAG;
+ * Message prefixed by the level name and followed by a new line.
+ */
+
+/**
+ * @var Capture::style_t Capture::DEBUG;
+ * Message formatted as ELM_DBG does.
+ */
+
+/**
+ * @var Capture::style_t Capture::DEBUG_LINE;
+ * Message formatted as ELM_DBGLN does.
+ */
+
+/**
+ * Build a capture.
+ * @param level	Message level.
+ * @param out	Output to write the message to.
+ * @param style	Formatting style.
+ * @param file	Source file producing the message.
+ * @param line	Source line producing the message.
+ */
+Capture::Capture(Logger::level_t level, io::Output& out, style_t style, const char *file, int line)
+: _r(&_local), _ring(nullptr), _out(out), _sb(nullptr), _drop(false) {
+	Logger::Sink *sink = Logger::find(out);
+	if(sink != nullptr && Logger::isAsync()) {
+		Logger::Ring *ring = Logger::ring();
+		Logger::record_t *r = ring->acquire();
+		if(r == nullptr) {
+			if(Logger::policy() == Logger::DROP) {
+				ring->dropped.fetchAdd(1, sys::RELAXED);
+				_drop = true;
+			}
+			else
+				while((r = ring->acquire()) == nullptr) {
+					Logger::wake();
+					std::this_thread::yield();
+				}
+		}
+		if(r != nullptr) {
+			_r = r;
+			_ring = ring;
+			_r->time = std::chrono::steady_clock::now().time_since_epoch().count();
+		}
+	}
+	_r->sink = sink;
+	_r->file = file;
+	_r->line = line;
+	_r->spill = nullptr;
+	_r->size = 0;
+	_r->level = level;
+	_r->style = style;
+}
+
+
+/**
+ * Send the message to the logger.
+ */
+Capture::~Capture(void) {
+	if(_sb != nullptr) {
+		_r->spill = new String(_sb->toString());
+		delete _sb;
+	}
+	if(_ring != nullptr) {
+		_ring->commit();
+		Logger::wake();
+	}
+	else {
+		if(!_drop && _r->sink == nullptr)
+			Logger::write(_out, *_r, true);
+		else if(!_drop) {
+			sys::Guard<sys::Mutex> g(_r->sink->lock);
+			Logger::write(_r->sink->out, *_r, true);
+		}
+		delete _r->spill;
+	}
+}
+
+
+// capture a scalar argument
+Capture& Capture::put(Logger::tag_t tag, const void *p, int size) {
+	if(_sb == nullptr && _r->size + 1 + size > Logger::DATA_SIZE)
+		spill();
+	if(_sb != nullptr)
+		Logger::print(*_sb, tag, static_cast<const char *>(p));
+	else {
+		char *d = _r->data + _r->size;
+		*d = tag;
+		memcpy(d + 1, p, size);
+		_r->size += 1 + size;
+	}
+	return *this;
+}
+
+
+// capture a string argument
+Capture& Capture::put(const char *s, int n) {
+	if(_sb == nullptr && _r->size + 1 + int(sizeof(t::uint16)) + n > Logger::DATA_SIZE)
+		spill();
+	if(_sb != nullptr)
+		_sb->stream().write(s, n);
+	else {
+		char *d = _r->data + _r->size;
+		t::uint16 l = n;
+		*d = Logger::STRING;
+		memcpy(d + 1, &l, sizeof(l));
+		memcpy(d + 1 + sizeof(l), s, n);
+		_r->size += 1 + sizeof(l) + n;
+	}
+	return *this;
+}
+
+
+// switch to eager formatting when the record is full
+void Capture::spill(void) {
+	_sb = new StringBuffer();
+	Logger::decode(*_sb, *_r);
+	_r->size = 0;
+}
+
+/**
+ * @def ELM_LOG(level, str)
+ * Log the message str with the given level on the standard error output.
+ * The message is prefixed by the level name and followed by a new line.
+ * Messages whose level is lower than ELM_LOG_LEVEL are removed at compile time.
+ * @param level	Message level (one of @ref Logger::level_t).
+ * @param str	Message made of items separated by <<.
+ * @ingroup log
+ */
+
+/**
+ * @def ELM_LOG_LEVEL
+ * Lowest level of messages kept at compile time by ELM_LOG and ELM_DBG*
+ * macros (default to 0, @ref Logger::TRACE). To be defined before including
+ * elm/log/Logger.h or elm/log/Log.h.
+ * @ingroup log
+ */
+
+} }	// elm::log
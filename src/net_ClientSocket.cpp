@@ -81,11 +81,15 @@ namespace elm { namespace net {
 
 			// build the socket
 			_fd = socket(AF_INET, SOCK_STREAM, 0);
-			if(_fd < 0)
+			if(_fd < 0) {
+				freeaddrinfo(info);
 				throw Exception(_ << "cannot create the socket: " << strerror(errno));
+			}
 
 			// perform the connection
-			if(::connect(_fd, info->ai_addr, info->ai_addrlen) == -1) {
+			int res = ::connect(_fd, info->ai_addr, info->ai_addrlen);
+			freeaddrinfo(info);
+			if(res == -1) {
 				disconnect();
 				throw Exception(_ << "cannot connect: " << strerror(errno));
 			}
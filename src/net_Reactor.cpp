@@ -0,0 +1,636 @@
+/*
+ *	Reactor class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <elm/net/Reactor.h>
+#include <elm/string.h>
+
+namespace elm { namespace net {
+
+/**
+ * @class Channel
+ * A channel is a non-blocking connection managed by a @ref Reactor.
+ * Each channel has an input buffer, filled by the reactor each time bytes
+ * are available on the socket, and an output buffer, emptied by the reactor
+ * as soon as the socket accepts bytes.
+ *
+ * The behavior of the server is implemented by overriding the callbacks:
+ * @li onOpen() -- called once the connection is accepted,
+ * @li onRead() -- called each time new bytes are appended to the input buffer:
+ * 		the bytes can be examined with data() and available() and are
+ * 		removed from the buffer with consume(),
+ * @li onDrain() -- called when the output buffer has been fully sent,
+ * @li onClose() -- called just before the channel is deleted.
+ *
+ * onRead() never blocks the reactor as long as it does not perform blocking
+ * operations itself: if the input buffer does not contain a full request,
+ * onRead() just returns and will be called again when more bytes arrive.
+ * For CPU-heavy processing, the reactor may run onRead() in a pool of worker
+ * threads (see @ref Reactor::setWorkers()).
+ *
+ * send() and close() must only be called from inside the callbacks.
+ * If a callback throws an @ref elm::Exception, the channel is closed.
+ *
+ * @ingroup net_mod
+ */
+
+/**
+ * Build a channel.
+ */
+Channel::Channel(void):
+	_reactor(nullptr), _fd(-1), _index(-1), _events(0), _closing(false), _dead(false), _busy(false) {
+}
+
+/**
+ */
+Channel::~Channel(void) {
+}
+
+/**
+ * @fn Reactor& Channel::reactor(void) const;
+ * Get the reactor managing the channel.
+ * @return	Owner reactor.
+ */
+
+/**
+ * @fn int Channel::fd(void) const;
+ * Get the file descriptor of the channel socket.
+ * @return	Socket file descriptor.
+ */
+
+/**
+ * @fn const char *Channel::data(void) const;
+ * Get the bytes of the input buffer.
+ * @return	Input bytes (available() bytes are valid).
+ */
+
+/**
+ * @fn int Channel::available(void) const;
+ * Get the number of bytes in the input buffer.
+ * @return	Number of available bytes.
+ */
+
+/**
+ * Remove bytes from the head of the input buffer.
+ * @param size	Number of bytes to remove.
+ */
+void Channel::consume(int size) {
+	ASSERTP(size >= 0 && size <= _in.size(), "consuming more than available");
+	_in.start += size;
+	if(_in.start == _in.end)
+		_in.start = _in.end = 0;
+}
+
+/**
+ * Append bytes to the output buffer. The bytes are sent as soon as
+ * the current callback returns and the socket is ready.
+ * @param buf	Bytes to send.
+ * @param size	Number of bytes.
+ */
+void Channel::send(const void *buf, int size) {
+	if(_dead)
+		return;
+	memcpy(_out.reserve(size), buf, size);
+	_out.end += size;
+}
+
+/**
+ * @fn void Channel::send(cstring s);
+ * Send a C string.
+ * @param s		String to send.
+ */
+
+/**
+ * @fn void Channel::send(const string& s);
+ * Send a string.
+ * @param s		String to send.
+ */
+
+/**
+ * @fn int Channel::pending(void) const;
+ * Get the number of bytes waiting in the output buffer.
+ * @return	Number of pending bytes.
+ */
+
+/**
+ * Request the closure of the channel. The input is no more read and
+ * the channel is closed (and deleted) once the output buffer is sent.
+ */
+void Channel::close(void) {
+	_closing = true;
+}
+
+/**
+ * @fn bool Channel::isClosing(void) const;
+ * Test if the channel is closing, either because close() has been called
+ * or because the peer has closed its side.
+ * @return	True if the channel is closing.
+ */
+
+/**
+ * Called when the channel is accepted. Default implementation does nothing.
+ */
+void Channel::onOpen(void) {
+}
+
+/**
+ * @fn void Channel::onRead(void);
+ * Called when new bytes are available in the input buffer.
+ */
+
+/**
+ * Called when the output buffer has been fully sent.
+ * Default implementation does nothing.
+ */
+void Channel::onDrain(void) {
+}
+
+/**
+ * Called before the channel is deleted, the socket being already closed.
+ * Default implementation does nothing.
+ */
+void Channel::onClose(void) {
+}
+
+/**
+ * Ensure there is room for size bytes at the end of the buffer.
+ * @param size	Needed room.
+ * @return		Pointer to the free room.
+ */
+char *Channel::buffer_t::reserve(int size) {
+	if(cap - end >= size)
+		return buf + end;
+	int used = end - start;
+	if(cap - used >= size)
+		memmove(buf, buf + start, used);
+	else {
+		int ncap = cap == 0 ? 4096 : cap;
+		while(ncap - used < size)
+			ncap *= 2;
+		char *nbuf = new char[ncap];
+		if(used != 0)
+			memcpy(nbuf, buf + start, used);
+		delete [] buf;
+		buf = nbuf;
+		cap = ncap;
+	}
+	start = 0;
+	end = used;
+	return buf + end;
+}
+
+/**
+ * Send as many bytes of the output buffer as possible.
+ * @return	False if the socket is in error, true else.
+ */
+bool Channel::flush(void) {
+	if(_out.size() == 0)
+		return true;
+	while(_out.size() > 0) {
+		ssize_t r = ::send(_fd, _out.buf + _out.start, _out.size(), MSG_NOSIGNAL);
+		if(r >= 0)
+			_out.start += r;
+		else if(errno == EINTR)
+			continue;
+		else if(errno == EAGAIN || errno == EWOULDBLOCK)
+			return true;
+		else {
+			_dead = true;
+			return false;
+		}
+	}
+	_out.start = _out.end = 0;
+	try {
+		onDrain();
+	}
+	catch(elm::Exception& e) {
+		_closing = true;
+	}
+	return true;
+}
+
+
+/**
+ * @class Reactor
+ * Event-driven server handling many connections with a single thread.
+ * The reactor listens on a port, accepts the connections, builds
+ * a @ref Channel for each one with make() and dispatches the socket events
+ * (available input, room for output, closure) to the channels.
+ * As no socket operation blocks, a slow client does not delay the other
+ * clients (in contrast to @ref Server that processes one connection at a time).
+ *
+ * @code
+ * class Echo: public net::Channel {
+ * protected:
+ * 	void onRead(void) override { send(data(), available()); consume(available()); }
+ * };
+ *
+ * class EchoServer: public net::Reactor {
+ * public:
+ * 	EchoServer(void): Reactor(7) { }
+ * protected:
+ * 	net::Channel *make(void) override { return new Echo(); }
+ * };
+ *
+ * EchoServer server;
+ * server.open();
+ * server.run();
+ * @endcode
+ *
+ * By default, the channel callbacks are run by the thread calling run().
+ * When the processing of requests is CPU-heavy, setWorkers() makes the reactor
+ * dispatch onRead() to a pool of worker threads: a channel is processed by at
+ * most one worker at a time and its socket is not watched meanwhile
+ * (the input is buffered by the kernel), so that the callbacks of a channel
+ * never run concurrently.
+ *
+ * This implementation relies on Linux epoll.
+ *
+ * @ingroup net_mod
+ */
+
+/**
+ * Number of bytes read at once from a channel socket.
+ */
+const int Reactor::READ_SIZE;
+
+// worker of the pool
+class Reactor::Worker: public sys::Runnable {
+public:
+	Worker(Reactor& reactor): r(reactor) { }
+	void run(void) override {
+		Channel *ch;
+		while(r._work->get(ch)) {
+			r.call(ch);
+			while(!r._done.put(ch))
+				;
+			r.wake();
+		}
+	}
+private:
+	Reactor& r;
+};
+
+/**
+ * Build a reactor.
+ * @param port	Port to listen to (default a free port chosen by the system).
+ */
+Reactor::Reactor(int port):
+	_port(port), _wcnt(0), _efd(-1), _lfd(-1), _wfd(-1), _stop(false), _work(nullptr) {
+}
+
+/**
+ */
+Reactor::~Reactor(void) {
+	close();
+}
+
+/**
+ * @fn int Reactor::port(void) const;
+ * Get the listened port. If the reactor has been built without port,
+ * the actual port is only available once the reactor is opened.
+ * @return	Listened port.
+ */
+
+/**
+ * @fn int Reactor::workers(void) const;
+ * Get the number of worker threads.
+ * @return	Number of worker threads (0 if the callbacks are run by the reactor thread).
+ */
+
+/**
+ * Set the number of worker threads running onRead() callbacks.
+ * Must be called before run().
+ * @param count		Number of worker threads (0 to run the callbacks in the reactor thread).
+ */
+void Reactor::setWorkers(int count) {
+	ASSERTP(count >= 0, "negative worker count");
+	ASSERTP(_threads.isEmpty(), "cannot change worker count while running");
+	_wcnt = count;
+}
+
+/**
+ * @fn int Reactor::count(void) const;
+ * Get the number of open channels.
+ * @return	Number of channels.
+ */
+
+/**
+ * @fn bool Reactor::isOpen(void) const;
+ * Test if the reactor is open.
+ * @return	True if it is open, false else.
+ */
+
+/**
+ * Open the listening socket.
+ * @throw Exception		If the socket cannot be opened.
+ */
+void Reactor::open(void) {
+	if(isOpen())
+		return;
+
+	// listening socket
+	_lfd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if(_lfd == -1)
+		throw net::Exception(_ << "cannot create socket: " << strerror(errno));
+	int b = 1;
+	if(setsockopt(_lfd, SOL_SOCKET, SO_REUSEADDR, &b, sizeof(b)) == -1) {
+		close();
+		throw net::Exception(_ << "cannot set REUSEADDR option: " << strerror(errno));
+	}
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(_port < 0 ? 0 : _port);
+	addr.sin_addr.s_addr = INADDR_ANY;
+	if(bind(_lfd, (struct sockaddr *)&addr, sizeof(addr)) == -1) {
+		close();
+		throw net::Exception(_ << "cannot bind the socket: " << strerror(errno));
+	}
+	if(::listen(_lfd, SOMAXCONN) == -1) {
+		close();
+		throw net::Exception(_ << "cannot listen: " << strerror(errno));
+	}
+	socklen_t len = sizeof(addr);
+	getsockname(_lfd, (struct sockaddr *)&addr, &len);
+	_port = ntohs(addr.sin_port);
+
+	// wake-up event and epoll
+	_wfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	int efd = epoll_create1(EPOLL_CLOEXEC);
+	if(_wfd == -1 || efd == -1) {
+		if(efd != -1)
+			::close(efd);
+		close();
+		throw net::Exception(_ << "cannot create epoll: " << strerror(errno));
+	}
+	_efd = efd;
+	struct epoll_event ev;
+	ev.events = EPOLLIN;
+	ev.data.ptr = &_lfd;
+	epoll_ctl(_efd, EPOLL_CTL_ADD, _lfd, &ev);
+	ev.data.ptr = &_wfd;
+	epoll_ctl(_efd, EPOLL_CTL_ADD, _wfd, &ev);
+}
+
+/**
+ * Run the event loop until stop() is called. The reactor is opened
+ * if it is not already.
+ */
+void Reactor::run(void) {
+	open();
+	_stop = false;
+	startWorkers();
+	const int max = 64;
+	struct epoll_event evs[max];
+	while(!_stop) {
+		int n = epoll_wait(_efd, evs, max, -1);
+		if(n < 0) {
+			if(errno == EINTR)
+				continue;
+			stopWorkers();
+			throw net::Exception(_ << "epoll error: " << strerror(errno));
+		}
+		for(int i = 0; i < n; i++) {
+			if(evs[i].data.ptr == &_lfd)
+				accept();
+			else if(evs[i].data.ptr == &_wfd) {
+				t::uint64 x;
+				while(read(_wfd, &x, sizeof(x)) > 0)
+					;
+				Channel *ch;
+				while(_done.get(ch))
+					complete(ch);
+			}
+			else
+				process(static_cast<Channel *>(evs[i].data.ptr), evs[i].events);
+		}
+	}
+	stopWorkers();
+}
+
+/**
+ * Ask the event loop to stop. Can be called from any thread.
+ */
+void Reactor::stop(void) {
+	_stop = true;
+	if(_wfd >= 0)
+		wake();
+}
+
+/**
+ * Close all channels and the listening socket.
+ */
+void Reactor::close(void) {
+	while(!_chans.isEmpty())
+		destroy(_chans.top());
+	if(_efd >= 0)
+		::close(_efd);
+	if(_wfd >= 0)
+		::close(_wfd);
+	if(_lfd >= 0)
+		::close(_lfd);
+	_efd = _wfd = _lfd = -1;
+}
+
+/**
+ * @fn Channel *Reactor::make(void);
+ * Build the channel for a new connection.
+ * @return	Built channel.
+ */
+
+// accept pending connections
+void Reactor::accept(void) {
+	while(true) {
+		int fd = accept4(_lfd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if(fd < 0) {
+			if(errno == EINTR || errno == ECONNABORTED)
+				continue;
+			return;
+		}
+		int b = 1;
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &b, sizeof(b));
+		Channel *ch = make();
+		ch->_reactor = this;
+		ch->_fd = fd;
+		ch->_index = _chans.count();
+		_chans.add(ch);
+		struct epoll_event ev;
+		ev.events = ch->_events = EPOLLIN | (_wcnt > 0 ? EPOLLONESHOT : 0);
+		ev.data.ptr = ch;
+		epoll_ctl(_efd, EPOLL_CTL_ADD, fd, &ev);
+		try {
+			ch->onOpen();
+		}
+		catch(elm::Exception& e) {
+			ch->close();
+		}
+		complete(ch);
+	}
+}
+
+// process events of a channel
+void Reactor::process(Channel *ch, t::uint32 events) {
+	if((events & EPOLLOUT) && !ch->flush()) {
+		destroy(ch);
+		return;
+	}
+	bool got = false;
+	if(events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+		for(int i = 0; i < 4; i++) {
+			char *p = ch->_in.reserve(READ_SIZE);
+			ssize_t r = ::read(ch->_fd, p, READ_SIZE);
+			if(r > 0) {
+				ch->_in.end += r;
+				got = true;
+				if(r < READ_SIZE)
+					break;
+			}
+			else if(r == 0) {
+				ch->_closing = true;
+				break;
+			}
+			else if(errno == EINTR)
+				continue;
+			else if(errno == EAGAIN || errno == EWOULDBLOCK)
+				break;
+			else {
+				ch->_dead = true;
+				break;
+			}
+		}
+	if(got && !ch->_dead)
+		dispatch(ch);
+	else
+		complete(ch);
+}
+
+// run the read callback, in the reactor thread or in a worker
+void Reactor::dispatch(Channel *ch) {
+	if(_wcnt == 0) {
+		call(ch);
+		complete(ch);
+	}
+	else {
+		ch->_busy = true;
+		_work->put(ch);
+	}
+}
+
+// call the read callback
+void Reactor::call(Channel *ch) {
+	try {
+		ch->onRead();
+	}
+	catch(elm::Exception& e) {
+		ch->_closing = true;
+	}
+}
+
+// end of processing of a channel: flush, re-arm or close
+void Reactor::complete(Channel *ch) {
+	ch->_busy = false;
+	if(!ch->_dead)
+		ch->flush();
+	if(ch->_dead || (ch->_closing && ch->pending() == 0))
+		destroy(ch);
+	else
+		update(ch);
+}
+
+// update the watched events
+void Reactor::update(Channel *ch) {
+	t::uint32 events = (ch->_closing ? 0 : EPOLLIN)
+		| (ch->pending() != 0 ? EPOLLOUT : 0)
+		| (_wcnt > 0 ? EPOLLONESHOT : 0);
+	if(events == ch->_events && _wcnt == 0)
+		return;
+	struct epoll_event ev;
+	ev.events = ch->_events = events;
+	ev.data.ptr = ch;
+	epoll_ctl(_efd, EPOLL_CTL_MOD, ch->_fd, &ev);
+}
+
+// close and delete a channel
+void Reactor::destroy(Channel *ch) {
+	epoll_ctl(_efd, EPOLL_CTL_DEL, ch->_fd, nullptr);
+	::close(ch->_fd);
+	ch->_fd = -1;
+	ch->onClose();
+	Channel *last = _chans.pop();
+	if(last != ch) {
+		_chans[ch->_index] = last;
+		last->_index = ch->_index;
+	}
+	delete ch;
+}
+
+// wake up the reactor thread
+void Reactor::wake(void) {
+	t::uint64 x = 1;
+	while(write(_wfd, &x, sizeof(x)) < 0 && errno == EINTR)
+		;
+}
+
+// start the worker threads
+void Reactor::startWorkers(void) {
+	if(_wcnt == 0)
+		return;
+	_work = new concur::BlockingQueue<concur::MPMCQueue<Channel *> >(1024);
+	for(int i = 0; i < _wcnt; i++) {
+		Worker *w = new Worker(*this);
+		sys::Thread *t = sys::Thread::make(*w);
+		_workers.add(w);
+		_threads.add(t);
+		t->start();
+	}
+}
+
+// stop the worker threads and complete their channels
+void Reactor::stopWorkers(void) {
+	if(_work == nullptr)
+		return;
+	_work->close();
+	for(auto t: _threads) {
+		t->join();
+		delete t;
+	}
+	_threads.clear();
+	for(auto w: _workers)
+		delete w;
+	_workers.clear();
+	delete _work;
+	_work = nullptr;
+	Channel *ch;
+	while(_done.get(ch))
+		complete(ch);
+}
+
+} }	// elm::net
@@ -156,7 +156,7 @@ Connection::~Connection(void) {
 				struct sockaddr_in maddr;
 				socklen_t mlen = sizeof(maddr);
 				getsockname(_fd, (struct sockaddr *)&maddr, &mlen);
-				_port = maddr.sin_port;
+				_port = ntohs(maddr.sin_port);
 			}
 		}
 
@@ -237,7 +237,7 @@ Connection::~Connection(void) {
 				struct sockaddr_in maddr;
 				socklen_t mlen = sizeof(maddr);
 				getsockname(_fd, (struct sockaddr *)&maddr, &mlen);
-				_port = maddr.sin_port;
+				_port = ntohs(maddr.sin_port);
 			}
 		}
 
@@ -438,6 +438,7 @@ void Server::close(void) {
 	on = false;
 	if(sock)
 		delete sock;
+	sock = nullptr;
 }
 
 /**
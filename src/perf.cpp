@@ -0,0 +1,723 @@
+/*
+ *	perf module implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/assert.h>
+#include <elm/compare.h>
+#include <elm/data/Vector.h>
+#include <elm/json/Saver.h>
+#include <elm/perf.h>
+#include <elm/sys/Thread.h>
+
+namespace elm { namespace perf {
+
+/**
+ * @defgroup perf Performance Instrumentation
+ *
+ * This module provides light instrumentation to profile applications
+ * in production, without external tool:
+ * @li @ref Clock -- monotonic nanosecond clock and cycle counter,
+ * @li @ref Counter -- named event counter,
+ * @li @ref Histogram -- named distribution of values (log2 buckets),
+ * @li @ref Timer -- histogram of durations fed by scoped timers,
+ * @li @ref Trace -- per-thread event ring buffers exported in the Chrome
+ *		trace-event JSON format (readable by chrome://tracing or Perfetto).
+ *
+ * Counters, histograms and timers are usually declared as static objects
+ * and are updated without lock nor atomic read-modify-write: each thread
+ * owns its own copy of the values, which are summed only when read.
+ *
+ * The instrumentation is usually inserted with the following macros:
+ * @code
+ * #include <elm/perf.h>
+ *
+ * ELM_PERF_COUNTER(visited, "cfg.visited");
+ * ELM_PERF_TIMER(solve_time, "ilp.solve");
+ *
+ * void solve() {
+ *	ELM_PERF_TIME(solve_time);
+ *	ELM_PERF_TRACE("solve");
+ *	for(auto b: blocks) {
+ *		ELM_PERF_COUNT(visited);
+ *		...
+ *	}
+ * }
+ * @endcode
+ *
+ * Defining @c ELM_NO_PERF before including <elm/perf.h> reduces all these
+ * macros to nothing: neither code nor data remains in the application.
+ *
+ * Statistics can be displayed with Stat::printAll() or saved in JSON
+ * with Stat::saveAll(). Tracing must be activated with Trace::enable()
+ * and the trace is obtained with Trace::save().
+ */
+
+
+// registry lock
+static sys::Mutex& lock(void) {
+	static sys::Mutex mutex;
+	return mutex;
+}
+
+
+/**
+ * Per-thread storage of statistics values.
+ */
+class Stat::Slots {
+public:
+	inline Slots(void): slots(), next(nullptr) { }
+	slot_t slots[MAX_SLOTS];
+	Slots *next;
+};
+
+static Stat *stats = nullptr;
+static int used = 0;
+static Stat::Slots *threads = nullptr;
+static t::uint64 retired[Stat::MAX_SLOTS];
+thread_local Stat::slot_t *Stat::_local = nullptr;
+
+
+/**
+ * Fold the values of a terminated thread in the retired values.
+ * @param s		Slots of the thread.
+ */
+void Stat::detach(Slots *s) {
+	lock().lock();
+	for(Slots **p = &threads; *p != nullptr; p = &(*p)->next)
+		if(*p == s) {
+			*p = s->next;
+			break;
+		}
+	for(Stat *st = stats; st != nullptr; st = st->_next)
+		for(int i = st->_base; i < st->_base + st->_size; i++) {
+			t::uint64 v = s->slots[i].load(std::memory_order_relaxed);
+			if(st->_kind != COUNTER && i == st->_base + 2)
+				retired[i] = elm::max(retired[i], v);
+			else
+				retired[i] += v;
+		}
+	lock().unlock();
+	delete s;
+}
+
+// detach the slots when a thread terminates
+class Detacher {
+public:
+	inline Detacher(void): slots(nullptr) { }
+	inline ~Detacher(void) { if(slots != nullptr) Stat::detach(slots); }
+	Stat::Slots *slots;
+};
+static thread_local Detacher detacher;
+
+
+/**
+ * @class Stat
+ * Base class of statistics (@ref Counter, @ref Histogram, @ref Timer).
+ * A statistics is made of several 64-bit values (slots) replicated in each
+ * thread: updates only concern the slots of the current thread and are
+ * performed without lock and without atomic read-modify-write operation.
+ * Reading a value sums the slots of all threads.
+ *
+ * The total number of slots is limited to MAX_SLOTS: statistics should be
+ * static objects.
+ *
+ * @ingroup perf
+ */
+
+/**
+ * Build a statistics.
+ * @param name	Statistics name (must live as long as the statistics).
+ * @param kind	Statistics kind.
+ * @param size	Number of used slots.
+ */
+Stat::Stat(cstring name, kind_t kind, int size): _name(name), _kind(kind), _size(size) {
+	lock().lock();
+	ASSERTP(used + size <= MAX_SLOTS, "too many perf statistics");
+	_base = used;
+	used += size;
+	_next = stats;
+	stats = this;
+	lock().unlock();
+}
+
+
+/**
+ */
+Stat::~Stat(void) {
+	lock().lock();
+	for(Stat **p = &stats; *p != nullptr; p = &(*p)->_next)
+		if(*p == this) {
+			*p = _next;
+			break;
+		}
+	lock().unlock();
+}
+
+
+/**
+ * Allocate the slots of the current thread.
+ * @return	Current thread slots.
+ */
+Stat::slot_t *Stat::attach(void) {
+	Slots *s = new Slots();
+	lock().lock();
+	s->next = threads;
+	threads = s;
+	lock().unlock();
+	detacher.slots = s;
+	_local = s->slots;
+	return _local;
+}
+
+
+/**
+ * Get the sum of a slot over all threads.
+ * @param i		Slot index.
+ * @return		Sum of the slots.
+ */
+t::uint64 Stat::sum(int i) const {
+	lock().lock();
+	t::uint64 r = retired[_base + i];
+	for(Slots *s = threads; s != nullptr; s = s->next)
+		r += s->slots[_base + i].load(std::memory_order_relaxed);
+	lock().unlock();
+	return r;
+}
+
+
+/**
+ * Get the maximum of a slot over all threads.
+ * @param i		Slot index.
+ * @return		Maximum of the slots.
+ */
+t::uint64 Stat::maximum(int i) const {
+	lock().lock();
+	t::uint64 r = retired[_base + i];
+	for(Slots *s = threads; s != nullptr; s = s->next)
+		r = elm::max(r, t::uint64(s->slots[_base + i].load(std::memory_order_relaxed)));
+	lock().unlock();
+	return r;
+}
+
+
+/**
+ * Reset the values of the statistics. Should not be called while the
+ * statistics is updated by other threads.
+ */
+void Stat::reset(void) {
+	lock().lock();
+	for(int i = _base; i < _base + _size; i++) {
+		retired[i] = 0;
+		for(Slots *s = threads; s != nullptr; s = s->next)
+			s->slots[i].store(0, std::memory_order_relaxed);
+	}
+	lock().unlock();
+}
+
+
+/**
+ * Get a snapshot of the list of statistics.
+ * @param all	Filled with the statistics.
+ */
+void Stat::collect(Vector<const Stat *>& all) {
+	lock().lock();
+	for(Stat *s = stats; s != nullptr; s = s->_next)
+		all.add(s);
+	lock().unlock();
+}
+
+
+/**
+ * Print all statistics.
+ * @param out	Stream to output to.
+ */
+void Stat::printAll(io::Output& out) {
+	Vector<const Stat *> all;
+	collect(all);
+	for(int i = all.count() - 1; i >= 0; i--) {
+		all[i]->print(out);
+		out << io::endl;
+	}
+}
+
+
+/**
+ * Save all statistics as a JSON object whose fields are the statistics names.
+ * @param saver		JSON saver to use.
+ */
+void Stat::saveAll(json::Saver& saver) {
+	Vector<const Stat *> all;
+	collect(all);
+	saver.beginMap();
+	for(int i = all.count() - 1; i >= 0; i--)
+		all[i]->save(saver);
+	saver.endMap();
+}
+
+
+/**
+ * Reset all statistics.
+ */
+void Stat::resetAll(void) {
+	Vector<const Stat *> all;
+	collect(all);
+	for(auto s: all)
+		const_cast<Stat *>(s)->reset();
+}
+
+
+/**
+ * @fn void Stat::print(io::Output& out) const;
+ * Print the statistics in textual form.
+ * @param out	Stream to output to.
+ */
+
+/**
+ * @fn void Stat::save(json::Saver& saver) const;
+ * Save the statistics as a JSON field named after the statistics.
+ * @param saver		JSON saver to use.
+ */
+
+
+/**
+ * @class Counter
+ * Named counter of events. inc() and add() cost a few instructions
+ * as the counter value is per-thread.
+ * @ingroup perf
+ */
+
+/**
+ * @fn void Counter::inc(void) const;
+ * Increment the counter.
+ */
+
+/**
+ * @fn void Counter::add(t::uint64 n) const;
+ * Add a value to the counter.
+ * @param n		Added value.
+ */
+
+/**
+ * @fn t::uint64 Counter::value(void) const;
+ * Get the counter value summed over all threads.
+ * @return	Counter value.
+ */
+
+/**
+ */
+void Counter::print(io::Output& out) const {
+	out << name() << ": " << value();
+}
+
+/**
+ */
+void Counter::save(json::Saver& saver) const {
+	saver.key(name());
+	saver.put(value());
+}
+
+
+/**
+ * @class Histogram
+ * Named distribution of values. The values are counted in buckets
+ * of increasing powers of 2: bucket 0 contains the value 0, bucket i > 0
+ * contains the values in [2^(i-1), 2^i[. In addition, the count, the sum and
+ * the maximum of the values are recorded.
+ * @ingroup perf
+ */
+
+/**
+ * @fn void Histogram::add(t::uint64 x) const;
+ * Record a value.
+ * @param x		Recorded value.
+ */
+
+/**
+ * @fn t::uint64 Histogram::count(void) const;
+ * Get the number of recorded values.
+ * @return	Number of values.
+ */
+
+/**
+ * @fn t::uint64 Histogram::total(void) const;
+ * Get the sum of recorded values.
+ * @return	Sum of values.
+ */
+
+/**
+ * @fn t::uint64 Histogram::max(void) const;
+ * Get the maximum recorded value.
+ * @return	Maximum value.
+ */
+
+/**
+ * @fn t::uint64 Histogram::bucket(int i) const;
+ * Get the number of values in a bucket.
+ * @param i		Bucket index (in [0, BUCKETS[).
+ * @return		Number of values in the bucket.
+ */
+
+/**
+ * Get an approximation of the given percentile: the result is the upper
+ * bound of the bucket containing the percentile.
+ * @param p		Percentile (in [0, 1]).
+ * @return		Percentile approximation.
+ */
+t::uint64 Histogram::percentile(double p) const {
+	t::uint64 c = count();
+	if(c == 0)
+		return 0;
+	t::uint64 target = t::uint64(p * c), acc = 0;
+	for(int i = 0; i < BUCKETS; i++) {
+		acc += bucket(i);
+		if(acc > target || acc == c)
+			return i == 0 ? 0 : i == 64 ? max() : elm::min(max(), (t::uint64(1) << i) - 1);
+	}
+	return max();
+}
+
+/**
+ */
+void Histogram::print(io::Output& out) const {
+	cstring unit = kind() == TIMER ? "ns" : "";
+	out << name() << ": count=" << count()
+		<< ", mean=" << t::uint64(mean()) << unit
+		<< ", p50=" << percentile(.5) << unit
+		<< ", p99=" << percentile(.99) << unit
+		<< ", max=" << max() << unit;
+}
+
+/**
+ */
+void Histogram::save(json::Saver& saver) const {
+	saver.key(name());
+	saver.beginMap();
+	if(kind() == TIMER) {
+		saver.key(cstring("unit"));
+		saver.put("ns");
+	}
+	saver.key(cstring("count"));
+	saver.put(count());
+	saver.key(cstring("total"));
+	saver.put(total());
+	saver.key(cstring("max"));
+	saver.put(max());
+	saver.key(cstring("p50"));
+	saver.put(percentile(.5));
+	saver.key(cstring("p99"));
+	saver.put(percentile(.99));
+	saver.key(cstring("buckets"));
+	saver.beginList();
+	int last = BUCKETS - 1;
+	while(last >= 0 && bucket(last) == 0)
+		last--;
+	for(int i = 0; i <= last; i++)
+		saver.put(bucket(i));
+	saver.endList();
+	saver.endMap();
+}
+
+
+/**
+ * @class Timer
+ * Histogram of durations, in nanoseconds, usually fed by @ref Timer::Scope
+ * objects:
+ * @code
+ * static Timer timer("my-function");
+ * void f() {
+ *	Timer::Scope scope(timer);
+ *	...
+ * }
+ * @endcode
+ * @ingroup perf
+ */
+
+/**
+ * @class Timer::Scope
+ * Measure the duration between its construction and its destruction
+ * and record it in a timer.
+ * @ingroup perf
+ */
+
+
+/**
+ * @class Clock
+ * Fast time sources. now() uses CLOCK_MONOTONIC that is implemented without
+ * system call on Linux and cycles() uses the time stamp counter on x86.
+ * @ingroup perf
+ */
+
+/**
+ * @fn t::uint64 Clock::now(void);
+ * Get the current time from an arbitrary origin.
+ * @return	Current time in nanoseconds.
+ */
+
+/**
+ * @fn t::uint64 Clock::cycles(void);
+ * Get the time stamp counter (on x86) or now() on other architectures.
+ * @return	Current cycle count.
+ */
+
+
+/**
+ * Ring buffer of trace events of a thread. The events are only written by
+ * the owner thread: before overwriting a slot, it publishes in writing
+ * the index of the event it writes and, after, it publishes the event
+ * with head. This lets a reader detect the events overwritten while it
+ * copies them.
+ */
+class Trace::Buffer {
+public:
+	typedef struct slot_t {
+		std::atomic<const char *> name;
+		std::atomic<t::uint64> ts, dur;
+		std::atomic<char> ph;
+	} slot_t;
+	inline Buffer(int capacity, int tid)
+		: events(new slot_t[capacity]), mask(capacity - 1), head(0), writing(0), base(0), tid(tid), dead(false), next(nullptr) { }
+	inline ~Buffer(void) { delete [] events; }
+	slot_t *events;
+	t::uint64 mask;
+	std::atomic<t::uint64> head, writing;
+	t::uint64 base;
+	int tid;
+	bool dead;
+	Buffer *next;
+};
+
+static Trace::Buffer *buffers = nullptr;
+static int capacity = Trace::DEFAULT_CAPACITY;
+static int tids = 0;
+static thread_local Trace::Buffer *local = nullptr;
+std::atomic<bool> Trace::_enabled(false);
+
+
+/**
+ * Release the buffer of a terminated thread: it is freed if it is empty
+ * or, else, kept until the next Trace::clear().
+ * @param b		Buffer to release.
+ */
+static void release(Trace::Buffer *b) {
+	lock().lock();
+	if(b->head.load(std::memory_order_relaxed) != b->base)
+		b->dead = true;
+	else {
+		for(Trace::Buffer **p = &buffers; *p != nullptr; p = &(*p)->next)
+			if(*p == b) {
+				*p = b->next;
+				break;
+			}
+		delete b;
+	}
+	lock().unlock();
+}
+
+// release the trace buffer when a thread terminates
+class Releaser {
+public:
+	inline Releaser(void): buffer(nullptr) { }
+	inline ~Releaser(void) { if(buffer != nullptr) release(buffer); }
+	Trace::Buffer *buffer;
+};
+static thread_local Releaser releaser;
+
+
+/**
+ * @class Trace
+ * Recorder of trace events. Each thread records its events in its own
+ * ring buffer: recording an event is lock-free and, when the buffer is full,
+ * the oldest events are overwritten. The trace can be saved in the
+ * Chrome trace-event JSON format.
+ *
+ * Tracing is disabled by default: when disabled, a @ref Trace::Scope
+ * costs only a test.
+ *
+ * @ingroup perf
+ */
+
+/**
+ * @class Trace::Scope
+ * Record a complete event covering the life of the scope object.
+ * @ingroup perf
+ */
+
+/**
+ * @fn bool Trace::isEnabled(void);
+ * Test if the tracing is enabled.
+ * @return	True if tracing is enabled.
+ */
+
+/**
+ * @fn void Trace::complete(const char *name, t::uint64 start, t::uint64 stop);
+ * Record a complete event.
+ * @param name	Event name (must live as long as the trace).
+ * @param start	Start time (as given by Clock::now()).
+ * @param stop	Stop time (as given by Clock::now()).
+ */
+
+/**
+ * @fn void Trace::instant(const char *name);
+ * Record an instant event.
+ * @param name	Event name (must live as long as the trace).
+ */
+
+/**
+ * Enable or disable the tracing.
+ * @param enabled	True to enable, false to disable.
+ */
+void Trace::enable(bool enabled) {
+	_enabled.store(enabled);
+}
+
+/**
+ * Set the capacity, in events, of the ring buffers. Only applies
+ * to the threads that have not recorded events yet.
+ * @param cap	Capacity (rounded up to a power of 2).
+ */
+void Trace::setCapacity(int cap) {
+	int c = 1;
+	while(c < cap)
+		c <<= 1;
+	lock().lock();
+	capacity = c;
+	lock().unlock();
+}
+
+/**
+ * Remove all recorded events. The buffers of the terminated threads
+ * are freed. Can be called while events are recorded.
+ */
+void Trace::clear(void) {
+	lock().lock();
+	for(Buffer **p = &buffers; *p != nullptr;) {
+		Buffer *b = *p;
+		if(b->dead) {
+			*p = b->next;
+			delete b;
+		}
+		else {
+			b->base = b->head.load(std::memory_order_acquire);
+			p = &b->next;
+		}
+	}
+	lock().unlock();
+}
+
+/**
+ */
+void Trace::record(const char *name, t::uint64 ts, t::uint64 dur, char ph) {
+	Buffer *b = local;
+	if(b == nullptr) {
+		lock().lock();
+		b = new Buffer(capacity, ++tids);
+		b->next = buffers;
+		buffers = b;
+		lock().unlock();
+		local = b;
+		releaser.buffer = b;
+	}
+	t::uint64 h = b->head.load(std::memory_order_relaxed);
+	b->writing.store(h + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	Buffer::slot_t& e = b->events[h & b->mask];
+	e.name.store(name, std::memory_order_relaxed);
+	e.ts.store(ts, std::memory_order_relaxed);
+	e.dur.store(dur, std::memory_order_relaxed);
+	e.ph.store(ph, std::memory_order_relaxed);
+	b->head.store(h + 1, std::memory_order_release);
+}
+
+/**
+ * Save an event in Chrome trace-event JSON format.
+ * @param saver		JSON saver to use.
+ * @param e			Event to save.
+ * @param tid		Identifier of the recording thread.
+ */
+static void save(json::Saver& saver, const Trace::event_t& e, int tid) {
+	char ph[2] = { e.ph, '\0' };
+	saver.beginMap();
+	saver.key(cstring("name"));
+	saver.put(cstring(e.name));
+	saver.key(cstring("cat"));
+	saver.put("elm");
+	saver.key(cstring("ph"));
+	saver.put(cstring(ph));
+	saver.key(cstring("ts"));
+	saver.put(double(e.ts) / 1000);
+	if(e.ph == 'X') {
+		saver.key(cstring("dur"));
+		saver.put(double(e.dur) / 1000);
+	}
+	else if(e.ph == 'i') {
+		saver.key(cstring("s"));
+		saver.put("t");
+	}
+	saver.key(cstring("pid"));
+	saver.put(0);
+	saver.key(cstring("tid"));
+	saver.put(tid);
+	saver.endMap();
+}
+
+/**
+ * Save the recorded events in Chrome trace-event JSON format.
+ * Can be called while events are recorded: the events overwritten
+ * during the save are skipped.
+ * @param saver		JSON saver to use.
+ */
+void Trace::save(json::Saver& saver) {
+	saver.beginMap();
+	saver.key(cstring("traceEvents"));
+	saver.beginList();
+	lock().lock();
+	Vector<event_t> evts;
+	for(Buffer *b = buffers; b != nullptr; b = b->next) {
+
+		// copy the published events
+		t::uint64 size = b->mask + 1;
+		t::uint64 h = b->head.load(std::memory_order_acquire);
+		t::uint64 l = elm::max(b->base, h > size ? h - size : 0);
+		evts.clear();
+		for(t::uint64 i = l; i < h; i++) {
+			const Buffer::slot_t& s = b->events[i & b->mask];
+			event_t e;
+			e.name = s.name.load(std::memory_order_relaxed);
+			e.ts = s.ts.load(std::memory_order_relaxed);
+			e.dur = s.dur.load(std::memory_order_relaxed);
+			e.ph = s.ph.load(std::memory_order_relaxed);
+			evts.add(e);
+		}
+
+		// skip the events overwritten during the copy
+		std::atomic_thread_fence(std::memory_order_acquire);
+		t::uint64 w = b->writing.load(std::memory_order_relaxed);
+		t::uint64 f = elm::max(l, w > size ? w - size : 0);
+		for(t::uint64 i = elm::min(f, h); i < h; i++)
+			perf::save(saver, evts[i - l], b->tid);
+	}
+	lock().unlock();
+	saver.endList();
+	saver.key(cstring("displayTimeUnit"));
+	saver.put("ns");
+	saver.endMap();
+}
+
+} }	// elm::perf
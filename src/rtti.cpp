@@ -19,9 +19,13 @@
  *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <atomic>
 #include <elm/data/HashMap.h>
+#include <elm/data/PerfectHashMap.h>
 #include <elm/rtti.h>
 #include <elm/serial2/serial.h>
+#include <elm/sys/Mutex.h>
+#include <elm/sys/SpinLock.h>
 
 namespace elm {
 
@@ -167,6 +171,24 @@ namespace rtti {
  */
 static HashMap<string, const Type *> type_map;
 
+/**
+ * Frozen copy of type_map used for look-up, rebuilt when a type is added.
+ * A new copy is built and published atomically: as concurrent look-ups may
+ * still use the previous copies, these ones are only released at exit.
+ */
+typedef PerfectHashMap<string, const Type *> frozen_map_t;
+static std::atomic<frozen_map_t *> frozen_map(nullptr);
+class FrozenMaps {
+public:
+	~FrozenMaps(void) { for(auto m: maps) delete m; }
+	Vector<frozen_map_t *> maps;
+	sys::Mutex lock;
+};
+static FrozenMaps& frozen_maps(void) {
+	static FrozenMaps maps;
+	return maps;
+}
+
 
 /**
  * @class Object
@@ -304,18 +326,37 @@ Type::Type(string name): _name(name) {
  * For internal use only. Do not call it.
  */
 void Type::initialize(void) {
-	if(name())
+	if(name()) {
+		sys::Guard<sys::Mutex> guard(frozen_maps().lock);
 		type_map.put(name(), this);
+		frozen_map.store(nullptr, std::memory_order_release);
+	}
 }
 
 /**
- * Get a type by its name.
+ * Get a type by its name. The look-up is performed in a perfect hash table
+ * built the first time this function is called after the addition of types.
+ * The types may be added and looked up concurrently.
  * @param name	Name of looked type.
  * @return		Found type or null.
  */
 const Type *Type::get(string name) {
 	_init.startup();
-	return type_map.get(name, 0);
+	frozen_map_t *map = frozen_map.load(std::memory_order_acquire);
+	if(map == nullptr) {
+		FrozenMaps& maps = frozen_maps();
+		sys::Guard<sys::Mutex> guard(maps.lock);
+		map = frozen_map.load(std::memory_order_relaxed);
+		if(map == nullptr) {
+			map = new frozen_map_t();
+			for(auto t = type_map.pairs().begin(); t(); t++)
+				map->add((*t).fst, (*t).snd);
+			map->freeze();
+			maps.maps.add(map);
+			frozen_map.store(map, std::memory_order_release);
+		}
+	}
+	return map->get(name, nullptr);
 }
 
 /**
@@ -959,6 +1000,23 @@ const Tuple *AbstractClass::toTuple() const {
 	return nullptr;
 }
 
+/**
+ * Look for an operation by its name and its arity in the current class
+ * and in its base classes. This look-up is linear in the number of
+ * operations and should be performed once, typically to build
+ * a @ref CallSite.
+ * @param name	Operation name.
+ * @param arity	Number of parameters (including the object for methods).
+ * @return		Found operation or null.
+ */
+const Operation *AbstractClass::operation(cstring name, int arity) const {
+	for(const AbstractClass *c = this; c != nullptr && static_cast<const Type *>(c) != &void_type; c = &c->base())
+		for(auto op: c->operations())
+			if(op->name() == name && op->parameters().count() == arity)
+				return op;
+	return nullptr;
+}
+
 /**
  * Convert ptr, pointer to the current type, to
  * a pointer of type cls. Raise an assertion
@@ -1188,9 +1246,10 @@ const List<const Type *> InstanceClass::params(void) const {
 /**
  *
  */
-Enum::Enum(const make& make): Type(make._name), _values(make._values) {
+Enum::Enum(const make& make): Type(make._name), _values(make._values), _min(0) {
 	_map.addAll(make._values);
 	_map.addAll(make._aliases);
+	index();
 }
 
 /**
@@ -1198,11 +1257,50 @@ Enum::Enum(const make& make): Type(make._name), _values(make._values) {
  * @param name		Full-qualified enumerated name.
  * @param values	Values of the enumerated type.
  */
-Enum::Enum(cstring name, const Value values[]): Type(name) {
+Enum::Enum(cstring name, const Value values[]): Type(name), _min(0) {
 	for(int i = 0; values[i].name(); i++) {
 		_values.add(values[i]);
 		_map.add(values[i]);
 	}
+	index();
+}
+
+/**
+ * Build the look-up structures: a perfect hash map from names to values
+ * and, for nameFor(), a dense array if the values are compact enough
+ * or a sorted array of values else.
+ */
+void Enum::index(void) {
+	for(const auto& v: _map)
+		_names.add(v.name(), v.value());
+	_names.freeze();
+	if(_values.isEmpty())
+		return;
+	int min = _values[0].value(), max = min;
+	for(const auto& v: _values) {
+		if(v.value() < min)
+			min = v.value();
+		if(v.value() > max)
+			max = v.value();
+	}
+	if(t::int64(max) - min < 4 * t::int64(_values.count()) + 16) {
+		_min = min;
+		_dense.setLength(max - min + 1);
+		for(int i = 0; i < _dense.count(); i++)
+			_dense[i] = "";
+		for(int i = _values.count() - 1; i >= 0; i--)
+			_dense[_values[i].value() - min] = _values[i].name();
+	}
+	else {
+		for(const auto& v: _values) {
+			int i = _sorted.count();
+			while(i > 0 && _sorted[i - 1].value() >= v.value())
+				i--;
+			if(i < _sorted.count() && _sorted[i].value() == v.value())
+				continue;
+			_sorted.insert(i, v);
+		}
+	}
 }
 
 /**
@@ -1214,24 +1312,33 @@ const Type& Enum::type(void) const {
 /**
  * Get the value for a text.
  * @param text	Text to lookup.
+ * @return		Matching value or -1.
  */
 int Enum::valueFor(string text) const {
-	for(Vector<Value>::Iter i = _map; i(); i++)
-		if((*i).name() == text)
-			return (*i).value();
-	return -1;
+	return _names.get(text, -1);
 }
 
 /**
  */
 cstring Enum::nameFor(int value) const {
-	for(Iter i = values(); i(); i++)
-		if((*i).value() == value)
-			return (*i).name();
+	if(!_dense.isEmpty()) {
+		if(value < _min || value - _min >= _dense.count())
+			return "";
+		return _dense[value - _min];
+	}
+	int l = 0, h = _sorted.count();
+	while(l < h) {
+		int m = (l + h) / 2;
+		if(_sorted[m].value() < value)
+			l = m + 1;
+		else
+			h = m;
+	}
+	if(l < _sorted.count() && _sorted[l].value() == value)
+		return _sorted[l].name();
 	return "";
 }
 
-
 /**
  * @fn Enum::Iter AbstractEnum::values(void) const;
  * Get the list of values.
@@ -1393,11 +1500,68 @@ Operation::~Operation(void) {
  * @fn const List<Parameter>& Operation::parameters(void) const;
  */
 
+// operation whose default invoke() is forwarding to call() in the current thread
+static thread_local const Operation *forwarding = nullptr;
+
 /**
- * TODO
+ * Call the operation with the given arguments. As the arguments vector is
+ * usually built for each call, a @ref CallSite is faster for repeated calls.
+ * @param args	Arguments (including the object for methods).
+ * @return		Operation result.
+ * @throw MessageException	If the number of arguments does not match the number of parameters.
  */
 Variant Operation::call(const Vector<Variant>& args) const {
-	throw MessageException("not implemented");
+	if(args.count() != _pars.count())
+		throw MessageException(_ << "operation " << name() << " expects " << _pars.count()
+			<< " arguments but " << args.count() << " are given");
+	if(forwarding == this)
+		throw MessageException(_ << "operation " << name() << " is not implemented");
+	return invoke(args.asArray().buffer());
+}
+
+/**
+ * Call the operation on an argument frame. This is the method to override
+ * to implement an operation: the arguments are not checked and there must
+ * be as many arguments as parameters. The default implementation builds
+ * a vector of arguments and calls call(): this supports the operations
+ * only overriding call() but is slower.
+ * @param args	Arguments (including the object for methods).
+ * @return		Operation result.
+ */
+Variant Operation::invoke(const Variant *args) const {
+	Vector<Variant> v(_pars.count());
+	for(int i = 0; i < _pars.count(); i++)
+		v.add(args[i]);
+	const Operation *save = forwarding;
+	forwarding = this;
+	try {
+		Variant r = call(v);
+		forwarding = save;
+		return r;
+	}
+	catch(...) {
+		forwarding = save;
+		throw;
+	}
+}
+
+/**
+ * Test if the parameter at index i accepts values of the given type.
+ * @param i		Parameter index.
+ * @param type	Argument type.
+ * @return		True if the type matches the parameter type, false else.
+ */
+bool Operation::accepts(int i, const Type& type) const {
+	for(const auto& p: _pars)
+		if(i-- == 0) {
+			const Type& pt = p.type();
+			if(&pt == &type)
+				return true;
+
+			// pointer types may be duplicated when built during class construction
+			return pt.isPtr() && type.isPtr() && &pt.asPtr().to() == &type.asPtr().to();
+		}
+	return false;
 }
 
 /**
@@ -1406,6 +1570,87 @@ void Operation::add(const Parameter& param) {
 	_pars.addLast(param);
 }
 
+/**
+ * @class Frame
+ * Fixed-size frame of arguments, allocated on the stack, to call
+ * an @ref Operation with Operation::invoke().
+ * @param N		Number of arguments.
+ * @ingroup rtti
+ */
+
+/**
+ * @fn Frame::Frame(const A&... args);
+ * Build the frame from the given arguments.
+ * @param args	Arguments.
+ */
+
+/**
+ * @fn const Variant *Frame::args(void) const;
+ * Get the arguments to pass to Operation::invoke().
+ * @return	Argument array.
+ */
+
+
+/**
+ * @class CallSite
+ * Cached access to an @ref Operation for repeated reflective calls.
+ * The operation is looked up and its parameters are checked against
+ * the argument types A once, at construction. Then each call stores
+ * the arguments in a @ref Frame on the stack and calls Operation::invoke():
+ * no memory is allocated whatever the number of arguments.
+ *
+ * @code
+ *	static rtti::CallSite<const Point *, int, int> dot(Point::__type, "dot");
+ *	int r = dot(p, 1, 2).as<int>();
+ * @endcode
+ *
+ * @param A		Types of the arguments (including the object for methods).
+ * @ingroup rtti
+ */
+
+/**
+ * @fn CallSite::CallSite(const Operation& op);
+ * Build a call site for the given operation.
+ * @param op	Called operation.
+ * @throw MessageException	If the parameters do not match A.
+ */
+
+/**
+ * @fn CallSite::CallSite(const AbstractClass& cls, cstring name);
+ * Build a call site for the operation of the given class with the given name
+ * and the arity of A.
+ * @param cls	Class containing the operation.
+ * @param name	Name of the operation.
+ * @throw MessageException	If the operation cannot be found or its parameters
+ * 							do not match A.
+ */
+
+/**
+ * @fn const Operation& CallSite::operation(void) const;
+ * Get the called operation.
+ * @return	Called operation.
+ */
+
+/**
+ * @fn Variant CallSite::call(const A&... args) const;
+ * Call the operation.
+ * @param args	Arguments.
+ * @return		Operation result.
+ */
+
+/**
+ * @fn Variant CallSite::call(const Frame<ARITY>& frame) const;
+ * Call the operation with an already built frame.
+ * @param frame	Argument frame.
+ * @return		Operation result.
+ */
+
+/**
+ * @fn Variant CallSite::operator()(const A&... args) const;
+ * Same as call().
+ */
+
+
 /**
  * Print the given type.
  * @param out	Output stream.
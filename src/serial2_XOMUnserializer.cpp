@@ -192,7 +192,7 @@ void XOMUnserializer::flush(void) {
 		todo.push(doc->getRootElement());
 		while(todo) {
 			xom::Element *elem = todo.pop();
-			Option<xom::String> id = elem->getAttributeValue(id_tag);
+			Option<xom::String> id = elem->getAttributeView(id_tag);
 			if(id)
 				elems.put(*id, elem);
 			for(int i = 0; i < elem->getChildCount(); i++) {
@@ -242,7 +242,7 @@ void XOMUnserializer::embed(const rtti::Type& clazz, void **ptr) {
 
 	// Find the class
 	string clazz_name = clazz.name();
-	Option<xom::String> name = ctx.elem->getAttributeValue(class_tag);
+	Option<xom::String> name = ctx.elem->getAttributeView(class_tag);
 	if(name) {
 		clazz_name = name;
 		uclass = rtti::Type::get(clazz_name);
@@ -277,7 +277,7 @@ string XOMUnserializer::xline(xom::Element *element) {
 void XOMUnserializer::onPointer(const rtti::Type& clazz, void **ptr) {
 
 	// is there a reference ?
-	Option<xom::String> id = ctx.elem->getAttributeValue(ref_tag);
+	Option<xom::String> id = ctx.elem->getAttributeView(ref_tag);
 
 	if(id) {
 		if (id == null_tag)
@@ -302,7 +302,7 @@ void XOMUnserializer::onPointer(const rtti::Type& clazz, void **ptr) {
 /**
  */
 void XOMUnserializer::lookupID(const rtti::Type& type, void *ptr) {
-	Option<xom::String> id = ctx.elem->getAttributeValue(id_tag);
+	Option<xom::String> id = ctx.elem->getAttributeView(id_tag);
 	if(id) {
 		ref_t *ref = refs.get(id, 0);
 		if(ref) {
@@ -404,15 +404,12 @@ int XOMUnserializer::countItems(void) {
 /**
  */
 int XOMUnserializer::onEnum(const rtti::Type& type) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	int result = type.asEnum().valueFor(text);
 	if(result < 0) {
-		String name = text;
-		text.free();
-		throw io::IOException(_ << "bad enumerated value \"" << name << "\"");
+		throw io::IOException(_ << "bad enumerated value \"" << text << "\"");
 	}
 	else {
-		text.free();
 		return result;
 	}
 }
@@ -420,7 +417,7 @@ int XOMUnserializer::onEnum(const rtti::Type& type) {
 /**
  */
 void XOMUnserializer::onValue(bool& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -429,51 +426,47 @@ void XOMUnserializer::onValue(bool& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed integer");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(char& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	char chr;
 	in >> chr;
 	val = chr;
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(signed char& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	char chr;
 	in >> chr;
 	val = chr;
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(unsigned char& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	in >> val;
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(signed short& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -482,14 +475,13 @@ void XOMUnserializer::onValue(signed short& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed integer");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(unsigned short& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -498,14 +490,13 @@ void XOMUnserializer::onValue(unsigned short& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed integer");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(signed long& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -514,14 +505,13 @@ void XOMUnserializer::onValue(signed long& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed integer");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(unsigned long& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -530,14 +520,13 @@ void XOMUnserializer::onValue(unsigned long& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed integer");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(signed int& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -546,14 +535,13 @@ void XOMUnserializer::onValue(signed int& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed integer");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(unsigned int& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -562,14 +550,13 @@ void XOMUnserializer::onValue(unsigned int& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed integer");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(signed long long& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -578,14 +565,13 @@ void XOMUnserializer::onValue(signed long long& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed integer");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(unsigned long long& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -594,14 +580,13 @@ void XOMUnserializer::onValue(unsigned long long& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed integer");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(float& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -610,14 +595,13 @@ void XOMUnserializer::onValue(float& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed float value");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(double& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	try {
@@ -626,14 +610,13 @@ void XOMUnserializer::onValue(double& val) {
 	catch(io::IOException& e) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed float value");
 	}
-	text.free();
 }
 
 
 /**
  */
 void XOMUnserializer::onValue(long double& v) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	io::BlockInStream block(text);
 	in.setStream(block);
 	double aux;
@@ -644,7 +627,6 @@ void XOMUnserializer::onValue(long double& v) {
 		throw io::IOException(_ << xline(ctx.elem) << ": malformed float value");
 	}
 	v = aux;
-	text.free();
 }
 
 
@@ -658,9 +640,8 @@ void XOMUnserializer::onValue(CString& val) {
 /**
  */
 void XOMUnserializer::onValue(String& val) {
-	xom::String text = ctx.elem->getValue();
+	xom::String text = ctx.elem->getValueView();
 	val = String(text);
-	text.free();
 }
 
 } } // elm::serial
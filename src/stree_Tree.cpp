@@ -21,6 +21,7 @@
 
 #include <elm/stree/MarkerBuilder.h>
 #include <elm/stree/SegmentBuilder.h>
+#include <elm/stree/IntervalTree.h>
 
 namespace elm { namespace stree  {
 
@@ -35,6 +36,15 @@ namespace elm { namespace stree  {
  * @li @ref elm::stree::Builder -- very rough builder,
  * @li @ref elm::stree::MarkerBuilder -- defines segments by bounds,
  * @li @ref elm::stree::SegmentBuilder -- from the list of segments.
+ *
+ * The builders may also produce a @ref elm::stree::FlatTree, a read-only
+ * variant storing the segment bounds in implicit Eytzinger layout
+ * (breadth-first order of a complete binary tree) for branch-free and
+ * cache-friendly look-ups.
+ *
+ * When the segments are not known at once or may overlap, @ref elm::stree::IntervalTree
+ * provides a dynamic structure supporting insertion, removal, stabbing and
+ * overlap queries in O(log n).
  */
 
 /**
@@ -187,4 +197,179 @@ namespace elm { namespace stree  {
  * @param tree	Tree to initialize.
  */
 
+
+/**
+ * @class FlatTree
+ * Read-only segment tree whose segment lower bounds are stored in an implicit
+ * Eytzinger layout: the node k has its children at 2k and 2k+1. The look-up
+ * does not follow any pointer and the loop body is reduced to a comparison
+ * and an index computation that compilers translate without branch. This makes
+ * FlatTree faster than @ref elm::stree::Tree for big segment sets.
+ *
+ * Segments are half-open ranges [low, high[. The tree is built in three
+ * steps: prepare() with the number of segments, put() for each segment in
+ * increasing order and complete(). @ref elm::stree::MarkerBuilder and
+ * @ref elm::stree::SegmentBuilder perform these steps with their make() function.
+ * A FlatTree owns its arrays and cannot be copied: pass it by reference.
+ *
+ * @param K		Key type.
+ * @param T		Retrieved item type.
+ * @param C		Comparator to compare keys (default to Comparator<K>).
+ * @ingroup stree
+ */
+
+/**
+ * @fn void FlatTree::prepare(int cnt);
+ * Prepare the tree to receive the given number of segments.
+ * Any previous content is lost.
+ * @param cnt	Number of segments.
+ */
+
+/**
+ * @fn void FlatTree::put(int i, const K& lb, const K& ub, const T& val);
+ * Set the segment at the given rank. Segments must be sorted in increasing
+ * order and must not overlap.
+ * @param i		Rank of the segment.
+ * @param lb	Lower bound (inclusive).
+ * @param ub	Upper bound (exclusive).
+ * @param val	Value associated with the segment.
+ */
+
+/**
+ * @fn void FlatTree::complete(void);
+ * Build the Eytzinger layout once all segments have been put.
+ */
+
+/**
+ * @fn const T *FlatTree::find(const K& key) const;
+ * Look for the segment containing the given key.
+ * @param key	Looked key.
+ * @return		Pointer to the segment value or null if not found.
+ */
+
+/**
+ * @fn const T& FlatTree::get(const K& key, const T& def) const;
+ * Find the value associated with the given key. If not found, return the default value.
+ * @param key	Key to look for.
+ * @param def	Default value.
+ * @return		Found value or default value.
+ */
+
+/**
+ * @fn const T& FlatTree::get(const K& key) const;
+ * Find a value by its key or raise an assertion failure.
+ * @param key	Key to look for.
+ * @return		Found value.
+ */
+
+/**
+ * @fn bool FlatTree::contains(const K& key) const;
+ * Test if the key is contained in one segment of the tree.
+ * @param key	Key to test.
+ * @return		True if the key is contained, false else.
+ */
+
+/**
+ * @fn void MarkerBuilder::make(stree::FlatTree<K, T, C>& tree);
+ * Build a flat tree from the markers and values.
+ * @param tree	Tree to initialize.
+ */
+
+/**
+ * @fn void SegmentBuilder::make(stree::FlatTree<K, T, C>& tree);
+ * Build a flat tree from the segments and values.
+ * @param tree	Tree to initialize.
+ */
+
+
+/**
+ * @class IntervalTree
+ * Dynamic interval tree: an AVL tree of segments sorted by lower bound where
+ * each node records the maximum upper bound of its sub-tree. Segments are
+ * half-open ranges [low, high[ and may overlap.
+ *
+ * Insertion and removal are performed in O(log n). Stabbing (segments
+ * containing a key) and overlap (segments intersecting a range) queries
+ * cost O(log n + k) where k is the number of returned segments.
+ *
+ * @param K		Key type.
+ * @param T		Retrieved item type.
+ * @param C		Comparator to compare keys (default to Comparator<K>).
+ * @param A		Allocator of nodes (default to DefaultAlloc).
+ * @ingroup stree
+ */
+
+/**
+ * @class IntervalTree::Segment
+ * Segment stored in an @ref IntervalTree.
+ */
+
+/**
+ * @class IntervalTree::Iter
+ * Iterator on the segments of an interval tree, in increasing order
+ * of lower bounds. According to the constructor, it traverses all segments,
+ * the segments containing a key or the segments overlapping a range.
+ */
+
+/**
+ * @fn void IntervalTree::add(const K& low, const K& high, const T& val);
+ * Add a segment to the tree.
+ * @param low	Lower bound (inclusive).
+ * @param high	Upper bound (exclusive).
+ * @param val	Associated value.
+ */
+
+/**
+ * @fn bool IntervalTree::remove(const K& low, const K& high);
+ * Remove one segment with the given bounds.
+ * @param low	Lower bound (inclusive).
+ * @param high	Upper bound (exclusive).
+ * @return		True if a segment has been removed, false else.
+ */
+
+/**
+ * @fn Iter IntervalTree::stab(const K& key) const;
+ * Get an iterator on the segments containing the given key.
+ * @param key	Looked key.
+ * @return		Iterator on the matching segments.
+ */
+
+/**
+ * @fn Iter IntervalTree::overlap(const K& low, const K& high) const;
+ * Get an iterator on the segments overlapping the given range.
+ * @param low	Lower bound of the range (inclusive).
+ * @param high	Upper bound of the range (exclusive).
+ * @return		Iterator on the matching segments.
+ */
+
+/**
+ * @fn bool IntervalTree::contains(const K& key) const;
+ * Test if at least one segment contains the given key.
+ * @param key	Key to test.
+ * @return		True if the key is contained, false else.
+ */
+
+/**
+ * @fn bool IntervalTree::overlaps(const K& low, const K& high) const;
+ * Test if at least one segment overlaps the given range.
+ * @param low	Lower bound of the range (inclusive).
+ * @param high	Upper bound of the range (exclusive).
+ * @return		True if there is an overlap, false else.
+ */
+
+/**
+ * @fn Option<T> IntervalTree::get(const K& key) const;
+ * Get the value of the segment with the lowest lower bound containing the key.
+ * @param key	Looked key.
+ * @return		Found value or none.
+ */
+
+/**
+ * @fn const T& IntervalTree::get(const K& key, const T& def) const;
+ * Get the value of the segment with the lowest lower bound containing the key.
+ * @param key	Looked key.
+ * @param def	Default value.
+ * @return		Found value or default value.
+ */
+
 } }	// elm::stree
@@ -19,7 +19,11 @@
  *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <string.h>
 #include <elm/string/utf8.h>
+#ifdef __SSE2__
+#	include <emmintrin.h>
+#endif
 
 namespace elm { namespace utf8 {
 
@@ -78,4 +82,370 @@ void Iter::parse(void) {
 	}
 }
 
+typedef t::uint8 byte_t;
+
+// skip the ASCII characters of [p, q[
+static inline const byte_t *skipASCII(const byte_t *p, const byte_t *q) {
+#	ifdef __SSE2__
+		while(q - p >= 16) {
+			int m = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)p));
+			if(m != 0)
+				return p + __builtin_ctz(m);
+			p += 16;
+		}
+#	else
+		while(q - p >= 8) {
+			t::uint64 w;
+			memcpy(&w, p, sizeof(w));
+			if(w & 0x8080808080808080ULL)
+				break;
+			p += 8;
+		}
+#	endif
+	while(p < q && *p < 0x80)
+		p++;
+	return p;
+}
+
+// decode a non-ASCII sequence, return its length or 0 if it is invalid
+static inline int decode(const byte_t *p, const byte_t *q, char_t& c) {
+	byte_t b = p[0];
+	if(b < 0xC2)
+		return 0;
+	else if(b < 0xE0) {
+		if(q - p < 2 || (p[1] & 0xC0) != 0x80)
+			return 0;
+		c = (char_t(b & 0x1F) << 6) | (p[1] & 0x3F);
+		return 2;
+	}
+	else if(b < 0xF0) {
+		if(q - p < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80)
+			return 0;
+		c = (char_t(b & 0x0F) << 12) | (char_t(p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+		if(c < 0x800 || (0xD800 <= c && c <= 0xDFFF))
+			return 0;
+		return 3;
+	}
+	else if(b < 0xF5) {
+		if(q - p < 4 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80 || (p[3] & 0xC0) != 0x80)
+			return 0;
+		c = (char_t(b & 0x07) << 18) | (char_t(p[1] & 0x3F) << 12) | (char_t(p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+		if(c < 0x10000 || c > 0x10FFFF)
+			return 0;
+		return 4;
+	}
+	else
+		return 0;
+}
+
+// encode a code point, return the number of written bytes
+static inline int encode(char_t c, byte_t *o) {
+	if(c < 0x80) {
+		o[0] = c;
+		return 1;
+	}
+	else if(c < 0x800) {
+		o[0] = 0xC0 | (c >> 6);
+		o[1] = 0x80 | (c & 0x3F);
+		return 2;
+	}
+	else if(c < 0x10000) {
+		if(0xD800 <= c && c <= 0xDFFF)
+			throw Exception(_ << "utf8: surrogate code point " << io::hex(c));
+		o[0] = 0xE0 | (c >> 12);
+		o[1] = 0x80 | ((c >> 6) & 0x3F);
+		o[2] = 0x80 | (c & 0x3F);
+		return 3;
+	}
+	else if(c <= 0x10FFFF) {
+		o[0] = 0xF0 | (c >> 18);
+		o[1] = 0x80 | ((c >> 12) & 0x3F);
+		o[2] = 0x80 | ((c >> 6) & 0x3F);
+		o[3] = 0x80 | (c & 0x3F);
+		return 4;
+	}
+	else
+		throw Exception(_ << "utf8: code point out of range " << io::hex(c));
+}
+
+static void bad_sequence(const char *s, const byte_t *p) {
+	throw Exception(_ << "utf8: bad encoding at offset " << int((const char *)p - s));
+}
+
+
+/**
+ * Test if the given buffer is a valid UTF-8 string: well-formed sequences,
+ * no overlong encoding, no surrogate and no code point over U+10FFFF.
+ * Runs of ASCII characters are checked 16 bytes at a time with SSE2
+ * (8 bytes at a time on other architectures).
+ * @param s		Buffer to test.
+ * @param n		Size of the buffer in bytes.
+ * @return		True if the buffer is valid UTF-8, false else.
+ * @ingroup string
+ */
+bool isValid(const char *s, t::size n) {
+	const byte_t *p = (const byte_t *)s, *q = p + n;
+	while(true) {
+		p = skipASCII(p, q);
+		if(p == q)
+			return true;
+		char_t c;
+		int l = decode(p, q, c);
+		if(l == 0)
+			return false;
+		p += l;
+	}
+}
+
+
+/**
+ * Test if the given buffer only contains ASCII characters.
+ * @param s		Buffer to test.
+ * @param n		Size of the buffer in bytes.
+ * @return		True if the buffer is only made of ASCII characters.
+ * @ingroup string
+ */
+bool isASCII(const char *s, t::size n) {
+	const byte_t *p = (const byte_t *)s, *q = p + n;
+	return skipASCII(p, q) == q;
+}
+
+
+/**
+ * Count the code points of an UTF-8 string, that is, the bytes that are not
+ * continuation bytes. The string is not validated.
+ * @param s		Buffer to count in.
+ * @param n		Size of the buffer in bytes.
+ * @return		Number of code points.
+ * @ingroup string
+ */
+t::size count(const char *s, t::size n) {
+	const byte_t *p = (const byte_t *)s, *q = p + n;
+	t::size r = n;
+#	ifdef __SSE2__
+		const __m128i lim = _mm_set1_epi8(-64);
+		while(q - p >= 16) {
+			__m128i v = _mm_loadu_si128((const __m128i *)p);
+			r -= __builtin_popcount(_mm_movemask_epi8(_mm_cmplt_epi8(v, lim)));
+			p += 16;
+		}
+#	endif
+	for(; p < q; p++)
+		if((*p & 0xC0) == 0x80)
+			r--;
+	return r;
+}
+
+
+/**
+ * Convert an UTF-8 string to UTF-16. Code points over U+FFFF are encoded
+ * as surrogate pairs. As an UTF-8 string never has more UTF-16 units
+ * than bytes, a buffer of n units is always big enough.
+ * @param s		UTF-8 string to convert.
+ * @param n		Size of the string in bytes.
+ * @param buf	Buffer to store UTF-16 units in.
+ * @return		Number of stored UTF-16 units.
+ * @throw Exception	If the string is not valid UTF-8.
+ * @ingroup string
+ */
+t::size toUTF16(const char *s, t::size n, t::uint16 *buf) {
+	const byte_t *p = (const byte_t *)s, *q = p + n;
+	t::uint16 *o = buf;
+	while(p < q) {
+#		ifdef __SSE2__
+			const __m128i z = _mm_setzero_si128();
+			while(q - p >= 16) {
+				__m128i v = _mm_loadu_si128((const __m128i *)p);
+				if(_mm_movemask_epi8(v) != 0)
+					break;
+				_mm_storeu_si128((__m128i *)o, _mm_unpacklo_epi8(v, z));
+				_mm_storeu_si128((__m128i *)(o + 8), _mm_unpackhi_epi8(v, z));
+				p += 16;
+				o += 16;
+			}
+			if(p == q)
+				break;
+#		endif
+		if(*p < 0x80) {
+			*o++ = *p++;
+			continue;
+		}
+		char_t c;
+		int l = decode(p, q, c);
+		if(l == 0)
+			bad_sequence(s, p);
+		p += l;
+		if(c < 0x10000)
+			*o++ = c;
+		else {
+			c -= 0x10000;
+			*o++ = 0xD800 | (c >> 10);
+			*o++ = 0xDC00 | (c & 0x3FF);
+		}
+	}
+	return o - buf;
+}
+
+
+/**
+ * Convert an UTF-8 string to UTF-32. A buffer of n code points is always
+ * big enough.
+ * @param s		UTF-8 string to convert.
+ * @param n		Size of the string in bytes.
+ * @param buf	Buffer to store code points in.
+ * @return		Number of stored code points.
+ * @throw Exception	If the string is not valid UTF-8.
+ * @ingroup string
+ */
+t::size toUTF32(const char *s, t::size n, char_t *buf) {
+	const byte_t *p = (const byte_t *)s, *q = p + n;
+	char_t *o = buf;
+	while(p < q) {
+#		ifdef __SSE2__
+			const __m128i z = _mm_setzero_si128();
+			while(q - p >= 16) {
+				__m128i v = _mm_loadu_si128((const __m128i *)p);
+				if(_mm_movemask_epi8(v) != 0)
+					break;
+				__m128i l = _mm_unpacklo_epi8(v, z), h = _mm_unpackhi_epi8(v, z);
+				_mm_storeu_si128((__m128i *)o, _mm_unpacklo_epi16(l, z));
+				_mm_storeu_si128((__m128i *)(o + 4), _mm_unpackhi_epi16(l, z));
+				_mm_storeu_si128((__m128i *)(o + 8), _mm_unpacklo_epi16(h, z));
+				_mm_storeu_si128((__m128i *)(o + 12), _mm_unpackhi_epi16(h, z));
+				p += 16;
+				o += 16;
+			}
+			if(p == q)
+				break;
+#		endif
+		if(*p < 0x80) {
+			*o++ = *p++;
+			continue;
+		}
+		int l = decode(p, q, *o);
+		if(l == 0)
+			bad_sequence(s, p);
+		p += l;
+		o++;
+	}
+	return o - buf;
+}
+
+
+/**
+ * Convert an UTF-16 string to UTF-8. A buffer of 3 n bytes is always big enough.
+ * @param s		UTF-16 string to convert.
+ * @param n		Number of UTF-16 units.
+ * @param buf	Buffer to store UTF-8 bytes in.
+ * @return		Number of stored bytes.
+ * @throw Exception	If the string contains an unpaired surrogate.
+ * @ingroup string
+ */
+t::size fromUTF16(const t::uint16 *s, t::size n, char *buf) {
+	const t::uint16 *p = s, *q = s + n;
+	byte_t *o = (byte_t *)buf;
+	while(p < q) {
+#		ifdef __SSE2__
+			const __m128i m = _mm_set1_epi16(short(0xFF80)), z = _mm_setzero_si128();
+			while(q - p >= 8) {
+				__m128i v = _mm_loadu_si128((const __m128i *)p);
+				if(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, m), z)) != 0xFFFF)
+					break;
+				_mm_storel_epi64((__m128i *)o, _mm_packus_epi16(v, v));
+				p += 8;
+				o += 8;
+			}
+			if(p == q)
+				break;
+#		endif
+		char_t c = *p++;
+		if(0xD800 <= c && c <= 0xDFFF) {
+			if(c >= 0xDC00 || p == q || *p < 0xDC00 || *p > 0xDFFF)
+				throw Exception(_ << "utf16: unpaired surrogate at offset " << int(p - 1 - s));
+			c = 0x10000 + ((c - 0xD800) << 10) + (*p++ - 0xDC00);
+		}
+		o += encode(c, o);
+	}
+	return o - (byte_t *)buf;
+}
+
+
+/**
+ * Convert an UTF-32 string to UTF-8. A buffer of 4 n bytes is always big enough.
+ * @param s		UTF-32 string to convert.
+ * @param n		Number of code points.
+ * @param buf	Buffer to store UTF-8 bytes in.
+ * @return		Number of stored bytes.
+ * @throw Exception	If the string contains a surrogate or a code point over U+10FFFF.
+ * @ingroup string
+ */
+t::size fromUTF32(const char_t *s, t::size n, char *buf) {
+	const char_t *p = s, *q = s + n;
+	byte_t *o = (byte_t *)buf;
+	while(p < q) {
+#		ifdef __SSE2__
+			const __m128i m = _mm_set1_epi32(~0x7F), z = _mm_setzero_si128();
+			while(q - p >= 8) {
+				__m128i a = _mm_loadu_si128((const __m128i *)p), b = _mm_loadu_si128((const __m128i *)(p + 4));
+				if(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(a, b), m), z)) != 0xFFFF)
+					break;
+				__m128i w = _mm_packs_epi32(a, b);
+				_mm_storel_epi64((__m128i *)o, _mm_packus_epi16(w, w));
+				p += 8;
+				o += 8;
+			}
+			if(p == q)
+				break;
+#		endif
+		o += encode(*p++, o);
+	}
+	return o - (byte_t *)buf;
+}
+
+
+/**
+ * Convert an UTF-16 string to an UTF-8 string.
+ * @param s		UTF-16 string to convert.
+ * @param n		Number of UTF-16 units.
+ * @return		Converted string.
+ * @throw Exception	If the string contains an unpaired surrogate.
+ * @ingroup string
+ */
+string fromUTF16(const t::uint16 *s, t::size n) {
+	char *buf = new char[3 * n];
+	try {
+		t::size l = fromUTF16(s, n, buf);
+		string r(buf, l);
+		delete [] buf;
+		return r;
+	}
+	catch(Exception& e) {
+		delete [] buf;
+		throw;
+	}
+}
+
+
+/**
+ * Convert an UTF-32 string to an UTF-8 string.
+ * @param s		UTF-32 string to convert.
+ * @param n		Number of code points.
+ * @return		Converted string.
+ * @throw Exception	If the string contains a surrogate or a code point over U+10FFFF.
+ * @ingroup string
+ */
+string fromUTF32(const char_t *s, t::size n) {
+	char *buf = new char[4 * n];
+	try {
+		t::size l = fromUTF32(s, n, buf);
+		string r(buf, l);
+		delete [] buf;
+		return r;
+	}
+	catch(Exception& e) {
+		delete [] buf;
+		throw;
+	}
+}
+
 } }		// elm::utf8
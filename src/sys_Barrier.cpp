@@ -0,0 +1,124 @@
+/*
+ *	sys::Barrier and sys::Latch classes implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/perf/Clock.h>
+#include <elm/sys/Barrier.h>
+
+namespace elm { namespace sys {
+
+/**
+ * @class Barrier
+ * Reusable barrier: a fixed number of threads wait at the barrier until
+ * all of them have arrived. Then the barrier is reset for the next phase.
+ *
+ * @ingroup system
+ */
+
+/**
+ * @fn Barrier::Barrier(int count);
+ * Build a barrier.
+ * @param count		Number of threads synchronizing on the barrier.
+ */
+
+/**
+ * @fn int Barrier::count(void) const;
+ * Get the number of threads synchronizing on the barrier.
+ * @return	Thread count.
+ */
+
+/**
+ * Wait until all threads arrive at the barrier.
+ * @return	True for the last arrived thread, false for the other ones.
+ */
+bool Barrier::wait(void) {
+	t::uint32 gen = _gen.load(ACQUIRE);
+	if(_left.fetchSub(1, ACQ_REL) == 1) {
+		_left.store(_count, RELAXED);
+		_gen.fetchAdd(1, RELEASE);
+		Futex::wakeAll(_gen);
+		return true;
+	}
+	t::uint64 start = LockStats::isEnabled() ? perf::Clock::now() : 0;
+	while(_gen.load(ACQUIRE) == gen)
+		Futex::wait(_gen, gen);
+	if(start != 0)
+		LockStats::record(LockStats::BARRIER, perf::Clock::now() - start);
+	return false;
+}
+
+
+/**
+ * @class Latch
+ * Single-use count-down: threads calling wait() are blocked until
+ * the counter reaches 0.
+ *
+ * @ingroup system
+ */
+
+/**
+ * @fn Latch::Latch(int count);
+ * Build a latch.
+ * @param count		Initial count.
+ */
+
+/**
+ * @fn int Latch::count(void) const;
+ * Get the current count.
+ * @return	Current count.
+ */
+
+/**
+ * @fn bool Latch::tryWait(void) const;
+ * Test if the count has reached 0.
+ * @return	True if the count is 0, false else.
+ */
+
+/**
+ * @fn void Latch::arriveAndWait(void);
+ * Decrement the count and wait for it to reach 0.
+ */
+
+/**
+ * Decrement the count, waking up the waiting threads when it reaches 0.
+ * @param n		Value to decrement by.
+ */
+void Latch::countDown(int n) {
+	if(_count.fetchSub(n, ACQ_REL) == t::uint32(n))
+		Futex::wakeAll(_count);
+}
+
+/**
+ * Wait until the count reaches 0.
+ */
+void Latch::wait(void) {
+	t::uint32 c = _count.load(ACQUIRE);
+	if(c == 0)
+		return;
+	t::uint64 start = LockStats::isEnabled() ? perf::Clock::now() : 0;
+	do {
+		Futex::wait(_count, c);
+		c = _count.load(ACQUIRE);
+	} while(c != 0);
+	if(start != 0)
+		LockStats::record(LockStats::LATCH, perf::Clock::now() - start);
+}
+
+} }	// elm::sys
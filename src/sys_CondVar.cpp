@@ -0,0 +1,98 @@
+/*
+ *	sys::CondVar class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/perf/Clock.h>
+#include <elm/sys/CondVar.h>
+
+namespace elm { namespace sys {
+
+/**
+ * @class CondVar
+ * Condition variable: let threads sleep until a condition, protected by
+ * a @ref Mutex, becomes true. The usual pattern is:
+ * @code
+ * 	// waiting thread
+ * 	mutex.lock();
+ * 	while(!condition)
+ * 		cond.wait(mutex);
+ * 	...
+ * 	mutex.unlock();
+ *
+ * 	// notifying thread
+ * 	mutex.lock();
+ * 	condition = true;
+ * 	mutex.unlock();
+ * 	cond.notify();
+ * @endcode
+ *
+ * The condition variable is not virtual and can be statically initialized.
+ * notify() and notifyAll() cost nothing if there is no waiting thread.
+ *
+ * @ingroup system
+ */
+
+/**
+ * Release the mutex, wait for a notification and acquire again the mutex.
+ * Spurious wake-ups are possible: the caller must test again its condition.
+ * @param mutex		Mutex held by the current thread.
+ */
+void CondVar::wait(Mutex& mutex) {
+	t::uint32 seq = _seq.load(RELAXED);
+	_waiters.fetchAdd(1, RELAXED);
+	mutex.unlock();
+	t::uint64 start = LockStats::isEnabled() ? perf::Clock::now() : 0;
+	Futex::wait(_seq, seq);
+	if(start != 0)
+		LockStats::record(LockStats::CONDVAR, perf::Clock::now() - start);
+	_waiters.fetchSub(1, RELAXED);
+	mutex.lockContended();
+}
+
+/**
+ * @fn void CondVar::wait(Mutex& mutex, P pred);
+ * Wait until the given predicate becomes true.
+ * @param mutex		Mutex held by the current thread.
+ * @param pred		Predicate (callable returning a boolean) to wait for.
+ */
+
+/**
+ * @fn void CondVar::notify(void);
+ * Wake up one waiting thread.
+ */
+
+/**
+ * @fn void CondVar::notifyAll(void);
+ * Wake up all waiting threads.
+ */
+
+/**
+ * Perform the wake-up.
+ * @param count		Number of threads to wake up (-1 for all).
+ */
+void CondVar::wake(int count) {
+	_seq.fetchAdd(1, RELEASE);
+	if(count < 0)
+		Futex::wakeAll(_seq);
+	else
+		Futex::wake(_seq, count);
+}
+
+} }	// elm::sys
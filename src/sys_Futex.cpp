@@ -0,0 +1,301 @@
+/*
+ *	sys::Futex class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/sys/Futex.h>
+#if defined(__linux__)
+#	include <climits>
+#	include <linux/futex.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#else
+#	include <condition_variable>
+#	include <mutex>
+#endif
+
+namespace elm { namespace sys {
+
+/**
+ * @class Atomic
+ * Thin wrapper around std::atomic using the ELM naming and taking an
+ * optional memory order for each operation (one of @ref RELAXED,
+ * @ref ACQUIRE, @ref RELEASE, @ref ACQ_REL or @ref SEQ_CST, default
+ * to @ref SEQ_CST).
+ *
+ * @param T		Type of the atomic value.
+ * @ingroup system
+ */
+
+/**
+ * @fn T Atomic::load(memory_order_t order) const;
+ * Read the atomic value.
+ * @param order		Memory order.
+ * @return			Current value.
+ */
+
+/**
+ * @fn void Atomic::store(T x, memory_order_t order);
+ * Write the atomic value.
+ * @param x			Value to write.
+ * @param order		Memory order.
+ */
+
+/**
+ * @fn T Atomic::exchange(T x, memory_order_t order);
+ * Write a value and return the previous one.
+ * @param x			Value to write.
+ * @param order		Memory order.
+ * @return			Previous value.
+ */
+
+/**
+ * @fn bool Atomic::compareExchange(T& expected, T desired, memory_order_t order);
+ * If the current value is equal to expected, replace it by desired.
+ * Else expected is set to the current value.
+ * @param expected	Expected value.
+ * @param desired	Value to write.
+ * @param order		Memory order.
+ * @return			True if the value has been replaced, false else.
+ */
+
+/**
+ * @fn bool Atomic::compareExchangeWeak(T& expected, T desired, memory_order_t order);
+ * Same as compareExchange() but may fail spuriously (faster in loops
+ * on some architectures).
+ * @param expected	Expected value.
+ * @param desired	Value to write.
+ * @param order		Memory order.
+ * @return			True if the value has been replaced, false else.
+ */
+
+/**
+ * @fn T Atomic::fetchAdd(T x, memory_order_t order);
+ * Add x to the value and return the previous value.
+ * @param x			Value to add.
+ * @param order		Memory order.
+ * @return			Previous value.
+ */
+
+/**
+ * @fn std::atomic<T>& Atomic::base(void);
+ * Get the underlying std::atomic.
+ * @return	Underlying atomic.
+ */
+
+/**
+ * @fn void fence(memory_order_t order);
+ * Insert a memory fence.
+ * @param order		Memory order of the fence.
+ * @ingroup system
+ */
+
+/**
+ * @fn void pause(void);
+ * Hint to the processor that the current thread is spinning.
+ * @ingroup system
+ */
+
+
+/**
+ * @class Futex
+ * Low-level waiting on a 32-bit word, used to implement the synchronization
+ * primitives of ELM. On Linux, this maps directly to the futex system call;
+ * on other OSes, it is emulated with a hashed table of condition variables.
+ *
+ * @ingroup system
+ */
+
+#if defined(__linux__)
+
+	/**
+	 * Block the current thread if the word is equal to value, until a wake() on
+	 * the same word. The function may return spuriously: the caller has to
+	 * test again its condition.
+	 * @param word	Word to wait on.
+	 * @param value	Expected value of the word.
+	 */
+	void Futex::wait(word_t& word, t::uint32 value) {
+		syscall(SYS_futex, reinterpret_cast<t::uint32 *>(&word.base()), FUTEX_WAIT_PRIVATE, value, nullptr, nullptr, 0);
+	}
+
+	/**
+	 * Wake up threads waiting on the given word.
+	 * @param word	Word to wake up threads of.
+	 * @param count	Maximum number of threads to wake up.
+	 */
+	void Futex::wake(word_t& word, int count) {
+		syscall(SYS_futex, reinterpret_cast<t::uint32 *>(&word.base()), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+	}
+
+	/**
+	 * Wake up all threads waiting on the given word.
+	 * @param word	Word to wake up threads of.
+	 */
+	void Futex::wakeAll(word_t& word) {
+		wake(word, INT_MAX);
+	}
+
+#else
+
+	static const int BUCKETS = 64;
+
+	typedef struct bucket_t {
+		std::mutex mutex;
+		std::condition_variable cond;
+	} bucket_t;
+
+	static bucket_t& bucket(Futex::word_t& word) {
+		static bucket_t buckets[BUCKETS];
+		return buckets[(reinterpret_cast<t::intptr>(&word) >> 4) % BUCKETS];
+	}
+
+	void Futex::wait(word_t& word, t::uint32 value) {
+		bucket_t& b = bucket(word);
+		std::unique_lock<std::mutex> lock(b.mutex);
+		if(word.load(ACQUIRE) == value)
+			b.cond.wait(lock);
+	}
+
+	void Futex::wake(word_t& word, int count) {
+		wakeAll(word);
+	}
+
+	void Futex::wakeAll(word_t& word) {
+		bucket_t& b = bucket(word);
+		{
+			std::lock_guard<std::mutex> lock(b.mutex);
+		}
+		b.cond.notify_all();
+	}
+
+#endif
+
+
+/**
+ * @class LockStats
+ * Contention statistics of the synchronization primitives. When enabled,
+ * each time a thread has to wait for a primitive, the waiting time is
+ * recorded by kind of primitive: count(), total() and max() give the
+ * number of waits, the total and the maximal waiting time in ns.
+ *
+ * As only the slow paths are instrumented, the statistics cost nothing
+ * when there is no contention. They do not rely on @ref perf counters as
+ * these use themselves the synchronization primitives.
+ *
+ * @ingroup system
+ */
+
+Atomic<bool> LockStats::_enabled(false);
+
+typedef struct stat_t {
+	Atomic<t::uint64> count, total, max;
+} stat_t;
+static stat_t stats[LockStats::KIND_COUNT];
+
+static cstring kind_names[LockStats::KIND_COUNT] = {
+	"spinlock",
+	"mutex",
+	"rwlock",
+	"condvar",
+	"barrier",
+	"latch",
+	"once"
+};
+
+/**
+ * Enable or disable the contention statistics.
+ * @param enabled	True to enable, false to disable.
+ */
+void LockStats::enable(bool enabled) {
+	_enabled.store(enabled, RELAXED);
+}
+
+/**
+ * @fn bool LockStats::isEnabled(void);
+ * Test if the contention statistics are enabled.
+ * @return	True if enabled, false else.
+ */
+
+/**
+ * Record a waiting on a primitive.
+ * @param kind	Kind of primitive.
+ * @param wait	Waiting time (ns).
+ */
+void LockStats::record(kind_t kind, t::uint64 wait) {
+	stat_t& s = stats[kind];
+	s.count.fetchAdd(1, RELAXED);
+	s.total.fetchAdd(wait, RELAXED);
+	t::uint64 m = s.max.load(RELAXED);
+	while(wait > m && !s.max.compareExchangeWeak(m, wait, RELAXED))
+		;
+}
+
+/**
+ * Get the number of waits for a kind of primitive.
+ * @param kind	Kind of primitive.
+ * @return		Number of waits.
+ */
+t::uint64 LockStats::count(kind_t kind) {
+	return stats[kind].count.load(RELAXED);
+}
+
+/**
+ * Get the total waiting time for a kind of primitive.
+ * @param kind	Kind of primitive.
+ * @return		Total waiting time (ns).
+ */
+t::uint64 LockStats::total(kind_t kind) {
+	return stats[kind].total.load(RELAXED);
+}
+
+/**
+ * Get the maximal waiting time for a kind of primitive.
+ * @param kind	Kind of primitive.
+ * @return		Maximal waiting time (ns).
+ */
+t::uint64 LockStats::max(kind_t kind) {
+	return stats[kind].max.load(RELAXED);
+}
+
+/**
+ * Reset the statistics.
+ */
+void LockStats::reset(void) {
+	for(int i = 0; i < KIND_COUNT; i++) {
+		stats[i].count.store(0, RELAXED);
+		stats[i].total.store(0, RELAXED);
+		stats[i].max.store(0, RELAXED);
+	}
+}
+
+/**
+ * Print the statistics of the primitives that have been waited for.
+ * @param out	Output stream.
+ */
+void LockStats::print(io::Output& out) {
+	for(int i = 0; i < KIND_COUNT; i++) {
+		kind_t k = kind_t(i);
+		if(count(k) != 0)
+			out << "sys." << kind_names[i] << ": " << count(k) << " waits, "
+				<< total(k) << " ns total, " << max(k) << " ns max\n";
+	}
+}
+
+} }	// elm::sys
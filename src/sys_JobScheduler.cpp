@@ -35,8 +35,9 @@ namespace elm { namespace sys {
  * @class JobProducer
  * Interface used by the sys::JobSheduler class to obtain the list of jobs to execute.
  * When a new job is needed, the method next() is called and the processing stops when
- * a null pointer is returned. Each time a job is ended, harvest() method is called
- * in an exclusive way to exploit results of the job.
+ * a null pointer is returned while no job is in progress. Each time a job is ended,
+ * harvest() method is called in an exclusive way to exploit results of the job: it may
+ * make new jobs available to next() (for example, the jobs depending on the ended one).
  */
 
 
@@ -79,9 +80,6 @@ namespace elm { namespace sys {
  */
 void JobScheduler::init(void) {
 
-	// build the mutex
-	mutex = Mutex::make();
-
 	// determine the number of cores
 	// TODO
 	cnt = 4;
@@ -92,7 +90,7 @@ void JobScheduler::init(void) {
  * Constructor without producer.
  * @throw SystemException	Lack of OS resources.
  */
-JobScheduler::JobScheduler(void): prod(0), mutex(0), cnt(0), thds(0), state(WAIT) {
+JobScheduler::JobScheduler(void): prod(0), cnt(0), active(0), thds(0), state(WAIT) {
 	init();
 }
 
@@ -102,7 +100,7 @@ JobScheduler::JobScheduler(void): prod(0), mutex(0), cnt(0), thds(0), state(WAIT
  * @param producer	Producer to use.
  * @throw SystemException	Lack of OS resources.
  */
-JobScheduler::JobScheduler(JobProducer& producer): prod(&producer), mutex(0), cnt(0), thds(0), state(WAIT) {
+JobScheduler::JobScheduler(JobProducer& producer): prod(&producer), cnt(0), active(0), thds(0), state(WAIT) {
 	init();
 }
 
@@ -110,8 +108,6 @@ JobScheduler::JobScheduler(JobProducer& producer): prod(&producer), mutex(0), cn
 /**
  */
 JobScheduler::~JobScheduler(void) {
-	if(mutex)
-		delete mutex;
 	if(thds)
 		for(int i = 0; i < cnt - 1; i++)
 			if(thds[i])
@@ -166,6 +162,7 @@ void JobScheduler::start(void) {
 
 	// process the jobs
 	state = RUN;
+	active = 0;
 	for(int i = 0; i < cnt - 1; i++)
 		thds[i]->start();
 	run();
@@ -177,6 +174,7 @@ void JobScheduler::start(void) {
 	// clean threads
 	for(int i = 0; i < cnt - 1; i++)
 		delete thds[i];
+	delete [] thds;
 	thds = 0;
 
 	// process output state
@@ -192,28 +190,40 @@ void JobScheduler::start(void) {
  * Stop the job processing.
  */
 void JobScheduler::stop(void) {
+	mutex.lock();
 	state = STOP;
+	mutex.unlock();
+	cond.notifyAll();
 }
 
 
 /**
- * Thread work.
+ * Thread work. When the producer has no job to provide, the thread waits
+ * for the jobs in progress to be harvested as they may make new jobs
+ * available. The thread stops when no job is available and no job is
+ * in progress.
  */
 void JobScheduler::run(void) {
-	mutex->lock();
+	mutex.lock();
 	while(state == RUN) {
 
 		// get a new job
 		Job *job = prod->next();
-		if(!job)
-			break;
-		mutex->unlock();
+		if(!job) {
+			if(active == 0)
+				break;
+			cond.wait(mutex);
+			continue;
+		}
+		active++;
+		mutex.unlock();
 
 		// perform it
 		job->run();
 
 		// harvest the result
-		mutex->lock();
+		mutex.lock();
+		active--;
 		try {
 			prod->harvest(job);
 		}
@@ -222,8 +232,10 @@ void JobScheduler::run(void) {
 			state = EXN;
 			break;
 		}
+		cond.notifyAll();
 	}
-	mutex->unlock();
+	mutex.unlock();
+	cond.notifyAll();
 }
 
 } }	// elm::sys
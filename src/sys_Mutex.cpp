@@ -0,0 +1,175 @@
+/*
+ *	sys::SpinLock and sys::Mutex classes implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <thread>
+#include <elm/perf/Clock.h>
+#include <elm/sys/Mutex.h>
+
+namespace elm { namespace sys {
+
+/**
+ * @class SpinLock
+ * Lock that makes the waiting threads actively spin. It must only be used
+ * to protect very short critical sections. A spin lock is not virtual,
+ * takes one byte and can be statically initialized.
+ *
+ * After some spinning, the waiting thread yields the processor to let
+ * the lock owner progress if it has been preempted.
+ *
+ * @ingroup system
+ */
+
+/**
+ * @fn void SpinLock::lock(void);
+ * Acquire the lock, spinning while it is not available.
+ */
+
+/**
+ * @fn bool SpinLock::tryLock(void);
+ * Acquire the lock if it is free.
+ * @return	True if the lock has been acquired, false else.
+ */
+
+/**
+ * @fn void SpinLock::unlock(void);
+ * Release the lock.
+ */
+
+/**
+ * @fn bool SpinLock::isLocked(void) const;
+ * Test if the lock is currently held.
+ * @return	True if locked, false else.
+ */
+
+static const int SPIN_YIELD = 1000;
+
+/**
+ * Slow path of lock().
+ */
+void SpinLock::lockSlow(void) {
+	t::uint64 start = LockStats::isEnabled() ? perf::Clock::now() : 0;
+	int spins = 0;
+	do {
+		while(_locked.load(RELAXED))
+			if(++spins < SPIN_YIELD)
+				pause();
+			else
+				std::this_thread::yield();
+	} while(_locked.exchange(true, ACQUIRE));
+	if(start != 0)
+		LockStats::record(LockStats::SPINLOCK, perf::Clock::now() - start);
+}
+
+
+/**
+ * @class Guard
+ * Hold a lock (@ref SpinLock, @ref Mutex or any class providing lock()
+ * and unlock()) for the lifetime of the guard object.
+ * @code
+ * 	{
+ * 		Guard<Mutex> guard(mutex);
+ * 		...
+ * 	}
+ * @endcode
+ *
+ * @param L		Type of lock.
+ * @ingroup system
+ */
+
+
+/**
+ * @class Mutex
+ * Mutual exclusion lock. The mutex is not virtual, takes only one word
+ * and can be statically initialized (it is usable in static object
+ * constructors). The lock and unlock operations are inlined and only
+ * perform one atomic operation when there is no contention.
+ *
+ * The mutex is adaptive: a thread that cannot acquire it spins for a few
+ * iterations (@ref SPIN_COUNT), as the owner may release it soon, before
+ * sleeping in the kernel.
+ *
+ * @ingroup system
+ */
+
+/**
+ * @fn void Mutex::lock(void);
+ * Acquire the mutex. If mutex is not available, block until it becomes available.
+ */
+
+/**
+ * @fn void Mutex::unlock(void);
+ * Release the mutex.
+ */
+
+/**
+ * @fn bool Mutex::tryLock(void);
+ * If the mutex is free, acquire it. Else return immediately without blocking.
+ * @return	True if the mutex has been acquired, false else.
+ */
+
+/**
+ * @fn bool Mutex::isLocked(void) const;
+ * Test if the mutex is currently held.
+ * @return	True if locked, false else.
+ */
+
+/**
+ * Slow path of lock().
+ */
+void Mutex::lockSlow(void) {
+	for(int i = 0; i < SPIN_COUNT; i++) {
+		t::uint32 s = _state.load(RELAXED);
+		if(s == FREE) {
+			if(_state.compareExchange(s, LOCKED, ACQUIRE))
+				return;
+		}
+		else if(s == CONTENDED)
+			break;
+		pause();
+	}
+	lockContended();
+}
+
+/**
+ * Acquire the mutex marking it as contended: the owner will wake up
+ * a waiting thread when it unlocks it.
+ */
+void Mutex::lockContended(void) {
+	if(_state.exchange(CONTENDED, ACQUIRE) == FREE)
+		return;
+	t::uint64 start = LockStats::isEnabled() ? perf::Clock::now() : 0;
+	do
+		Futex::wait(_state, CONTENDED);
+	while(_state.exchange(CONTENDED, ACQUIRE) != FREE);
+	if(start != 0)
+		LockStats::record(LockStats::MUTEX, perf::Clock::now() - start);
+}
+
+/**
+ * Build a new mutex.
+ * @return	Created mutex.
+ * @deprecated	Mutex can now be directly declared as variable or attribute.
+ */
+Mutex *Mutex::make(void) {
+	return new Mutex();
+}
+
+} }	// elm::sys
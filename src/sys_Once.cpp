@@ -0,0 +1,95 @@
+/*
+ *	sys::Once class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/perf/Clock.h>
+#include <elm/sys/Once.h>
+
+namespace elm { namespace sys {
+
+/**
+ * @class Once
+ * Ensure that an initialization is performed exactly once, even if
+ * several threads try to perform it concurrently:
+ * @code
+ * 	static Once once;
+ * 	once.call([]() { init(); });
+ * @endcode
+ * The threads calling call() while the initialization is in progress wait
+ * for its end. If the initialization raises an exception, it is propagated
+ * and the next call() will try again. Once the initialization is done,
+ * call() only costs an atomic load.
+ *
+ * @ingroup system
+ */
+
+/**
+ * @fn void Once::call(F f);
+ * Call the given function if it has not already been called.
+ * @param f		Function to call.
+ */
+
+/**
+ * @fn bool Once::isDone(void) const;
+ * Test if the initialization has been performed.
+ * @return	True if done, false else.
+ */
+
+/**
+ * Try to enter the initialization.
+ * @return	True if the caller has to perform the initialization,
+ * 			false if it has been done by another thread.
+ */
+bool Once::enter(void) {
+	t::uint32 s = NONE;
+	if(_state.compareExchange(s, RUNNING, ACQUIRE))
+		return true;
+	t::uint64 start = LockStats::isEnabled() ? perf::Clock::now() : 0;
+	while(s != DONE) {
+		if(s == NONE) {
+			if(_state.compareExchange(s, RUNNING, ACQUIRE))
+				return true;
+			continue;
+		}
+		Futex::wait(_state, RUNNING);
+		s = _state.load(ACQUIRE);
+	}
+	if(start != 0)
+		LockStats::record(LockStats::ONCE, perf::Clock::now() - start);
+	return false;
+}
+
+/**
+ * Mark the initialization as done.
+ */
+void Once::leave(void) {
+	_state.store(DONE, RELEASE);
+	Futex::wakeAll(_state);
+}
+
+/**
+ * Mark the initialization as failed.
+ */
+void Once::abort(void) {
+	_state.store(NONE, RELEASE);
+	Futex::wakeAll(_state);
+}
+
+} }	// elm::sys
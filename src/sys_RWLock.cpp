@@ -0,0 +1,154 @@
+/*
+ *	sys::RWLock class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/perf/Clock.h>
+#include <elm/sys/RWLock.h>
+
+namespace elm { namespace sys {
+
+/**
+ * @class RWLock
+ * Read-write lock: several threads can hold it in read mode at the same
+ * time but only one in write mode. It is efficient for read-mostly
+ * data: acquiring or releasing it in read mode only requires one atomic
+ * operation when there is no writer.
+ *
+ * The lock gives preference to writers: as soon as a writer waits, new
+ * readers are blocked. As a consequence, a thread must not acquire
+ * the lock recursively in read mode.
+ *
+ * @ref ReadGuard and @ref WriteGuard hold the lock for a block lifetime.
+ *
+ * @ingroup system
+ */
+
+/**
+ * @fn void RWLock::lockRead(void);
+ * Acquire the lock in read mode.
+ */
+
+/**
+ * @fn void RWLock::unlockRead(void);
+ * Release the lock acquired in read mode.
+ */
+
+/**
+ * @fn void RWLock::lockWrite(void);
+ * Acquire the lock in write mode.
+ */
+
+/**
+ * @fn void RWLock::unlockWrite(void);
+ * Release the lock acquired in write mode.
+ */
+
+/**
+ * @fn bool RWLock::tryLockRead(void);
+ * Acquire the lock in read mode if no writer holds it.
+ * @return	True if the lock has been acquired, false else.
+ */
+
+/**
+ * @fn bool RWLock::tryLockWrite(void);
+ * Acquire the lock in write mode if it is free.
+ * @return	True if the lock has been acquired, false else.
+ */
+
+/**
+ * @fn int RWLock::readers(void) const;
+ * Get the number of readers holding the lock.
+ * @return	Number of readers.
+ */
+
+/**
+ * @fn bool RWLock::isWriteLocked(void) const;
+ * Test if the lock is held by a writer.
+ * @return	True if write-locked, false else.
+ */
+
+/**
+ * Slow path of lockRead().
+ */
+void RWLock::lockReadSlow(void) {
+	t::uint64 start = LockStats::isEnabled() ? perf::Clock::now() : 0;
+	while(true) {
+		t::uint32 s = _state.load(RELAXED);
+		if((s & WRITER) == 0 && _writers.load(RELAXED) == 0) {
+			if(_state.compareExchangeWeak(s, s + 1, ACQUIRE))
+				break;
+			continue;
+		}
+		_waiters.fetchAdd(1);
+		t::uint32 key = _seq.load();
+		if((_state.load() & WRITER) == 0 && _writers.load() == 0) {
+			_waiters.fetchSub(1, RELAXED);
+			continue;
+		}
+		Futex::wait(_seq, key);
+		_waiters.fetchSub(1, RELAXED);
+	}
+	if(start != 0)
+		LockStats::record(LockStats::RWLOCK, perf::Clock::now() - start);
+}
+
+/**
+ * Slow path of lockWrite().
+ */
+void RWLock::lockWriteSlow(void) {
+	t::uint64 start = LockStats::isEnabled() ? perf::Clock::now() : 0;
+	_writers.fetchAdd(1);
+	while(true) {
+		t::uint32 s = 0;
+		if(_state.compareExchange(s, WRITER, ACQUIRE))
+			break;
+		_waiters.fetchAdd(1);
+		t::uint32 key = _seq.load();
+		if(_state.load() == 0) {
+			_waiters.fetchSub(1, RELAXED);
+			continue;
+		}
+		Futex::wait(_seq, key);
+		_waiters.fetchSub(1, RELAXED);
+	}
+	_writers.fetchSub(1, RELAXED);
+	if(start != 0)
+		LockStats::record(LockStats::RWLOCK, perf::Clock::now() - start);
+}
+
+/**
+ * Wake up the waiting threads.
+ */
+void RWLock::wakeSlow(void) {
+	_seq.fetchAdd(1, RELEASE);
+	Futex::wakeAll(_seq);
+}
+
+/**
+ * @class RWLock::ReadGuard
+ * Hold a @ref RWLock in read mode for the lifetime of the guard.
+ */
+
+/**
+ * @class RWLock::WriteGuard
+ * Hold a @ref RWLock in write mode for the lifetime of the guard.
+ */
+
+} }	// elm::sys
@@ -36,8 +36,14 @@
 #else
 #	include <dlfcn.h>
 #endif
+#include <errno.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <elm/data/HashMap.h>
+#include <elm/sys/JobScheduler.h>
 #include <elm/sys/Plugger.h>
 #include <elm/sys/System.h>
+#include <elm/sys/SystemException.h>
 #include <elm/io.h>
 #include <elm/ini.h>
 #include <elm/util/UniquePtr.h>
@@ -66,6 +72,367 @@ static cstring PLUG_EXT =
 #	endif
 static cstring fun_suffix = "_fun";
 
+static cstring
+	INDEX_SECTION = "elm-plugin-index",
+	INDEX_DIR = "dir:",
+	INDEX_ENTRY = "plugin:";
+static const int INDEX_FORMAT = 1;
+static const int LOAD_THREADS = 4;
+
+
+/**
+ * Get the modification time of a file.
+ * @param path	Path of the file.
+ * @return		Modification time or -1 if the file does not exist.
+ */
+static t::int64 modTime(const sys::Path& path) {
+	struct stat buf;
+	if(stat(path.asSysString(), &buf) != 0)
+		return -1;
+#	if defined(__linux)
+		return t::int64(buf.st_mtim.tv_sec) * 1000000000 + buf.st_mtim.tv_nsec;
+#	else
+		return buf.st_mtime;
+#	endif
+}
+
+
+/**
+ * Convert a string to a time as stored in the index.
+ * @param s		String to convert.
+ * @return		Converted time or -1 if the string is empty.
+ */
+static t::int64 toTime(const string& s) {
+	if(!s)
+		return -1;
+	io::StringInput in(s);
+	return in.scanLLong();
+}
+
+
+/**
+ * Output a list of strings in the INI format.
+ * @param out	Stream to output to.
+ * @param key	Key of the list.
+ * @param list	List to output.
+ */
+static void putList(io::Output& out, cstring key, const Vector<string>& list) {
+	if(!list)
+		return;
+	out << key << '=';
+	for(int i = 0; i < list.count(); i++) {
+		if(i != 0)
+			out << ';';
+		out << list[i];
+	}
+	out << io::endl;
+}
+
+
+/**
+ * Content of an ELD file.
+ */
+class Plugger::ELD {
+public:
+	inline ELD(void): found(false) { }
+
+	/**
+	 * Read an ELD file.
+	 * @param ppath	Path of the ELD file.
+	 */
+	void read(const sys::Path& ppath) {
+		try {
+			UniquePtr<ini::File> file(ini::File::load(ppath));
+			ini::Section *sect = file->get(SECTION_NAME);
+			if(sect) {
+				found = true;
+				path = sect->get(PATH_ATT);
+				sect->getList(DEPS_ATT, deps);
+				sect->getList(LIBS_ATT, libs);
+				sect->getList(RPATH_ATT, rpath);
+			}
+		}
+		catch(ini::Exception& e) {
+		}
+	}
+
+	bool found;
+	string path;
+	Vector<string> deps, libs, rpath;
+};
+
+
+/**
+ * Catalogue of the plug-ins found in the plugger directories. It records,
+ * for each directory, the plug-in files and, for each file, its modification
+ * time, the content of its ELD file and, once it has been plugged, its name,
+ * aliases and version.
+ *
+ * A directory is validated at most once per session by comparing its
+ * modification time with the recorded one (files are added or removed) and
+ * is re-scanned if needed. A file is validated, by its modification time,
+ * only when it is looked up.
+ */
+class Plugger::Index {
+public:
+
+	class Entry {
+	public:
+		inline Entry(const string& n): name(n), mtime(-1), eld_mtime(-1), checked(false), eld_cached(false) { }
+
+		void reset(void) {
+			checked = false;
+			aliases.clear();
+			version = "";
+			eld_cached = false;
+			eld = ELD();
+		}
+
+		string name;
+		t::int64 mtime, eld_mtime;
+		bool checked;
+		Vector<string> aliases;
+		string version;
+		bool eld_cached;
+		ELD eld;
+	};
+
+	class Dir {
+	public:
+		inline Dir(void): mtime(-1), valid(false) { }
+		inline ~Dir(void) { for(auto e: entries) delete e; }
+
+		Entry *get(const string& name) {
+			for(auto e: entries)
+				if(e->name == name)
+					return e;
+			return nullptr;
+		}
+
+		t::int64 mtime;
+		bool valid;
+		Vector<Entry *> entries;
+	};
+
+	inline Index(const sys::Path& path, cstring hook): _path(path), _hook(hook), dirty(false) { }
+	inline ~Index(void) { for(auto d: dirs) delete d; }
+	inline const sys::Path& path(void) const { return _path; }
+
+	/**
+	 * Get a directory, scanning it again if it has changed.
+	 * @param path	Directory path.
+	 * @return		Matching directory.
+	 */
+	Dir *dir(const sys::Path& path) {
+		Dir *d = dirs.get(path.toString(), nullptr);
+		if(d == nullptr) {
+			d = new Dir();
+			dirs.put(path.toString(), d);
+		}
+		if(!d->valid) {
+			t::int64 m = modTime(path.isEmpty() ? sys::Path(".") : path);
+			if(m != d->mtime) {
+				scan(d, path);
+				d->mtime = m;
+				dirty = true;
+			}
+			d->valid = true;
+		}
+		return d;
+	}
+
+	/**
+	 * Look for a plug-in by its file name or by one of its aliases.
+	 * @param dpath		Directory to look in.
+	 * @param name		Looked name.
+	 * @return			Found entry or null.
+	 */
+	Entry *find(const sys::Path& dpath, const string& name) {
+		Dir *d = dir(dpath);
+		Entry *e = d->get(name);
+		if(e != nullptr)
+			return e;
+		for(auto e: d->entries)
+			if(e->checked && e->aliases.contains(name))
+				return e;
+		return nullptr;
+	}
+
+	/**
+	 * Get the entry matching a plug-in file (whatever its extension) and
+	 * reset it if the plug-in or its ELD file has changed.
+	 * @param path	Path of the file.
+	 * @return		Matching entry or null if the file does not exist.
+	 */
+	Entry *lookup(const sys::Path& path) {
+		sys::Path base = path.withoutExt();
+		Entry *e = dir(base.dirPart())->get(base.namePart());
+		if(e == nullptr)
+			return nullptr;
+		t::int64
+			m = modTime(base.setExtension(PLUG_EXT)),
+			em = modTime(base.setExtension(ELD_EXT));
+		if(m != e->mtime || em != e->eld_mtime) {
+			e->reset();
+			e->mtime = m;
+			e->eld_mtime = em;
+			dirty = true;
+		}
+		return e;
+	}
+
+	/**
+	 * Record the description of a plugged plug-in.
+	 * @param path		Path of the plug-in.
+	 * @param plugin	Plugged plug-in.
+	 */
+	void record(const sys::Path& path, Plugin *plugin) {
+		Entry *e = lookup(path);
+		if(e == nullptr || e->checked)
+			return;
+		e->checked = true;
+		e->aliases.add(plugin->name());
+		for(auto a: plugin->aliases())
+			e->aliases.add(a);
+		e->version = _ << plugin->pluginVersion();
+		dirty = true;
+	}
+
+	/**
+	 * Load the index from its file. If the file does not exist or does not
+	 * match the current hook and format, the index is left empty.
+	 */
+	void load(void) {
+		if(!_path.exists())
+			return;
+		try {
+			UniquePtr<ini::File> file(ini::File::load(_path));
+			ini::Section *head = file->get(INDEX_SECTION);
+			if(head == nullptr || head->get("hook") != string(_hook) || head->getInt("format", 0) != INDEX_FORMAT)
+				return;
+			for(auto sect: *file) {
+				if(sect->name().startsWith(INDEX_DIR))
+					get(sect->name().substring(INDEX_DIR.length()))->mtime = toTime(sect->get("mtime"));
+				else if(sect->name().startsWith(INDEX_ENTRY)) {
+					sys::Path p = sect->name().substring(INDEX_ENTRY.length());
+					Entry *e = new Entry(p.namePart());
+					get(p.dirPart())->entries.add(e);
+					e->mtime = toTime(sect->get("mtime"));
+					e->eld_mtime = toTime(sect->get("eld-mtime"));
+					e->checked = sect->get("checked") == "yes";
+					sect->getList("aliases", e->aliases);
+					e->version = sect->get("version");
+					e->eld_cached = sect->get("eld") == "yes";
+					e->eld.found = sect->get("eld-found") == "yes";
+					e->eld.path = sect->get(PATH_ATT);
+					sect->getList(DEPS_ATT, e->eld.deps);
+					sect->getList(LIBS_ATT, e->eld.libs);
+					sect->getList(RPATH_ATT, e->eld.rpath);
+				}
+			}
+		}
+		catch(ini::Exception& e) {
+			for(auto d: dirs)
+				delete d;
+			dirs.clear();
+		}
+	}
+
+	/**
+	 * Save the index to its file. The file is first written aside and then
+	 * renamed so that concurrent tools never see a partial index.
+	 * @throw SystemException	If the file cannot be written.
+	 */
+	void save(void) {
+		_path.dirPart().makeDirs();
+		sys::Path tmp(_ << _path << ".tmp");
+		io::OutStream *stream = tmp.write();
+		{
+			io::Output out(*stream);
+			out << "; generated by ELM, do not edit\n";
+			out << '[' << INDEX_SECTION << "]\n";
+			out << "hook=" << _hook << io::endl;
+			out << "format=" << INDEX_FORMAT << io::endl;
+			for(auto d: dirs.pairs()) {
+				out << "\n[" << INDEX_DIR << d.fst << "]\n";
+				out << "mtime=" << d.snd->mtime << io::endl;
+				for(auto e: d.snd->entries) {
+					out << "\n[" << INDEX_ENTRY << (sys::Path(d.fst) / e->name) << "]\n";
+					out << "mtime=" << e->mtime << io::endl;
+					out << "eld-mtime=" << e->eld_mtime << io::endl;
+					if(e->checked) {
+						out << "checked=yes\n";
+						putList(out, "aliases", e->aliases);
+						out << "version=" << e->version << io::endl;
+					}
+					if(e->eld_cached) {
+						out << "eld=yes\n";
+						if(e->eld.found)
+							out << "eld-found=yes\n";
+						if(e->eld.path)
+							out << PATH_ATT << '=' << e->eld.path << io::endl;
+						putList(out, DEPS_ATT, e->eld.deps);
+						putList(out, LIBS_ATT, e->eld.libs);
+						putList(out, RPATH_ATT, e->eld.rpath);
+					}
+				}
+			}
+		}
+		delete stream;
+		if(rename(tmp.asSysString(), _path.asSysString()) != 0)
+			throw SystemException(errno, _ << "cannot write " << _path);
+		dirty = false;
+	}
+
+private:
+
+	Dir *get(const string& path) {
+		Dir *d = dirs.get(path, nullptr);
+		if(d == nullptr) {
+			d = new Dir();
+			dirs.put(path, d);
+		}
+		return d;
+	}
+
+	void scan(Dir *d, const sys::Path& path) {
+		Vector<Entry *> old = d->entries;
+		d->entries.clear();
+		if(path.isEmpty() || path.isDir())
+			try {
+				for(auto f: (path.isEmpty() ? sys::Path(".") : path).readDir()) {
+					sys::Path fp = f;
+					string ext = fp.extension();
+					if(ext != PLUG_EXT && ext != ELD_EXT)
+						continue;
+					string name = fp.withoutExt().toString();
+					if(d->get(name) != nullptr)
+						continue;
+					Entry *e = nullptr;
+					for(int i = 0; i < old.count(); i++)
+						if(old[i]->name == name) {
+							e = old[i];
+							old.removeAt(i);
+							break;
+						}
+					if(e == nullptr)
+						e = new Entry(name);
+					d->entries.add(e);
+				}
+			}
+			catch(SystemException& e) {
+			}
+		for(auto e: old)
+			delete e;
+	}
+
+	sys::Path _path;
+	cstring _hook;
+	HashMap<string, Dir *> dirs;
+public:
+	bool dirty;
+};
+
 
 /**
  * Test if the given file is a library.
@@ -91,6 +458,17 @@ static inline bool isLibrary(LockPtr<FileItem> file) {
  * unit. The Plugin object is retrieved as a global data matching the hook name
  * passed to the plugger creation. The dynamic loaded code units are retrieved
  * from the paths given to the plugger object. See @ref Plugin.
+ *
+ * When a lot of plug-ins are spread over many paths, looking for a plug-in
+ * may be costly (failed opening, ELD parsing). In this case, an index of the
+ * plug-ins can be activated with useIndex(): it records, in a file, the content
+ * of the plug-in directories, the ELD files and the names, aliases and versions
+ * of the plug-ins already plugged. Then, only the plug-in actually requested
+ * (and its dependencies) is opened and a plug-in can be retrieved by
+ * one of its aliases without being loaded before. The index is validated
+ * against the modification times of the directories and files
+ * and updated incrementally.
+ *
  * @ingroup plugins
  */
 
@@ -110,7 +488,7 @@ Vector<Plugger *> Plugger::pluggers;
  * 							default system paths.
  */
 Plugger::Plugger(CString hook, const Version& plugger_version, String paths)
-: _hook(hook), per_vers(plugger_version), err(OK), _quiet(false) {
+: _hook(hook), per_vers(plugger_version), err(OK), _quiet(false), _index(nullptr) {
 
 	// Initialize DL library
 	#if !defined(__WIN32) && !defined(__WIN64) && defined(WITH_LIBTOOL)
@@ -148,6 +526,8 @@ Plugger::Plugger(CString hook, const Version& plugger_version, String paths)
 /**
  */
 Plugger::~Plugger(void) {
+	saveIndex();
+	delete _index;
 	pluggers.remove(this);
 	#if !defined(__WIN32) && !defined(__WIN64) && defined(WITH_LIBTOOL)
 		lt_dlexit();
@@ -164,6 +544,52 @@ void Plugger::leave(Plugin *plugin) {
 }
 
 
+/**
+ * Activate the plug-in index. If the index file exists, it is loaded
+ * and used to speed up the retrieval of plug-ins. Otherwise, it is built
+ * while plug-ins are looked up and saved when the plugger is deleted
+ * or when saveIndex() is called.
+ * @param path	Path of the index file (default to
+ * 				$XDG_CACHE_HOME/elm/HOOK.index or ~/.cache/elm/HOOK.index).
+ */
+void Plugger::useIndex(sys::Path path) {
+	if(!path) {
+		const char *cache = getenv("XDG_CACHE_HOME");
+		sys::Path dir = cache != nullptr && *cache != '\0' ? sys::Path(cache) : sys::Path::home() / ".cache";
+		path = dir / "elm" / sys::Path(_ << _hook << ".index");
+	}
+	if(_index != nullptr) {
+		saveIndex();
+		delete _index;
+	}
+	_index = new Index(path, _hook);
+	_index->load();
+}
+
+
+/**
+ * Save the plug-in index if it has been modified. Does nothing if the
+ * index is not activated. Failing to write the index only causes a warning.
+ */
+void Plugger::saveIndex(void) {
+	if(_index == nullptr || !_index->dirty)
+		return;
+	try {
+		_index->save();
+	}
+	catch(SystemException& e) {
+		onError(level_warning, _ << "cannot save plug-in index " << _index->path() << ": " << e.message());
+	}
+}
+
+
+/**
+ * @fn bool Plugger::isIndexed(void) const;
+ * Test if the plug-in index is activated.
+ * @return	True if the index is used, false else.
+ */
+
+
 /**
  * Add new path for retrieving plugins.
  * @param path	Added path.
@@ -218,7 +644,15 @@ Plugin *Plugger::plug(const string& name) {
 	// Load the plugin
 	for(int i = 0; i < _paths.count(); i++) {
 		StringBuffer buf;
-		buf << _paths[i] << "/" << name << "." << PLUG_EXT;
+		if(_index == nullptr)
+			buf << _paths[i] << "/" << name << "." << PLUG_EXT;
+		else {
+			sys::Path path(_ << _paths[i] << "/" << name);
+			Index::Entry *e = _index->find(path.dirPart(), path.namePart());
+			if(e == nullptr)
+				continue;
+			buf << path.dirPart() << "/" << e->name << "." << PLUG_EXT;
+		}
 		error_t old_err = err;
 		Plugin *plugin = plugFile(buf.toString());
 		if(plugin)
@@ -252,8 +686,8 @@ bool Plugger::isPlugged(string name) const {
 
 /**
  */
-Plugin *Plugger::plug(Plugin *plugin, void *handle) {
-	plugin->plug(handle);
+Plugin *Plugger::plug(Plugin *plugin, void *handle, bool started) {
+	plugin->plug(handle, started);
 	if(!plugins.contains(plugin))
 		plugins.add(plugin);
 	return plugin;
@@ -285,6 +719,9 @@ void *Plugger::link(sys::Path lib) {
 #	if defined(__WIN32) || defined(__WIN64)
 		return LoadLibrary(lib.asSysString());
 #	elif defined(WITH_LIBTOOL)
+		// libltdl is not thread-safe (plugAll() links concurrently)
+		static sys::Mutex lock;
+		sys::Guard<sys::Mutex> guard(lock);
 		return lt_dlopen(lib.asSysString());
 #	else
 		return dlopen(lib.asSysString(), RTLD_LAZY);
@@ -330,6 +767,28 @@ void *Plugger::lookSymbol(void *handle, cstring name) {
 }
 
 
+/**
+ * Get the content of an ELD file, from the index if possible.
+ * @param ppath		Path of the ELD file.
+ * @param eld		Filled with the ELD content (found is false if there is no ELD).
+ */
+void Plugger::getELD(const sys::Path& ppath, ELD& eld) {
+	if(_index == nullptr)
+		eld.read(ppath);
+	else {
+		Index::Entry *entry = _index->lookup(ppath);
+		if(entry != nullptr && entry->eld_mtime >= 0) {
+			if(!entry->eld_cached) {
+				entry->eld.read(ppath);
+				entry->eld_cached = true;
+				_index->dirty = true;
+			}
+			eld = entry->eld;
+		}
+	}
+}
+
+
 /**
  * Look for an ELD file and process it.
  * @param path	Path to plugin.
@@ -346,60 +805,112 @@ Plugin *Plugger::lookELD(const Path& path, error_t& err, Vector<Plugin *>& _deps
 	else if(ppath.extension() != ELD_EXT)
 		ppath = _ << ppath << "." << ELD_EXT;
 
-	try {
+	// get the ELD content
+	ELD eld;
+	getELD(ppath, eld);
+	if(!eld.found)
+		return 0;
 
-		// open the ELD file
-		UniquePtr<ini::File> file(ini::File::load(ppath));
-		ini::Section *sect = file->get(SECTION_NAME);
-
-		// if section is provided
-		if(sect) {
-
-			// just renaming
-			sys::Path npath = sect->get(PATH_ATT);
-			if(npath)
-				return plugFile(evaluate(ppath, npath).setExtension(PLUG_EXT));
-
-			// pre-link other plugins
-			Vector<string> deps;
-			sect->getList(DEPS_ATT, deps);
-			for(int i = 0; i < deps.count(); i++) {
-				Plugin *plugin = plug(evaluate(ppath, deps[i]));
-				if(plugin)
-					_deps.add(plugin);
-				else {
-					onError(level_error, _ << "cannot plug " << deps[i]);
-					err = MISSING_DEP;
-					return 0;
-				}
+	// just renaming
+	if(eld.path)
+		return plugFile(evaluate(ppath, eld.path).setExtension(PLUG_EXT));
+
+	// pre-link other plugins
+	for(int i = 0; i < eld.deps.count(); i++) {
+		Plugin *plugin = plug(evaluate(ppath, eld.deps[i]));
+		if(plugin)
+			_deps.add(plugin);
+		else {
+			onError(level_error, _ << "cannot plug " << eld.deps[i]);
+			err = MISSING_DEP;
+			return 0;
+		}
+	}
+
+	// pre-link libraries
+	if(eld.libs) {
+
+		// add the RPATH if any
+		Vector<string> rpaths;
+		for(int i = 0; i < eld.rpath.count(); i++)
+			rpaths.add(evaluate(ppath, eld.rpath[i]));
+		if(!rpaths)
+			rpaths.add(ppath.parent());
+
+		// link the libraries
+		for(int i = 0; i < eld.libs.count(); i++)
+			if(!lookLibrary(evaluate(ppath, eld.libs[i]), rpaths)) {
+				onError(level_error, _ << "cannot link " << eld.libs[i]);
+				err = MISSING_DEP;
+				return 0;
 			}
+	}
+	return 0;
+}
 
-			// pre-link libraries
-			Vector<string> libs;
-			sect->getList(LIBS_ATT, libs);
-			if(libs) {
 
-				// add the RPATH if any
-				Vector<string> rpaths;
-				sect->getList(RPATH_ATT, rpaths);
-				for(int i = 0; i < rpaths.count(); i++)
-					rpaths[i] = evaluate(ppath, rpaths[i]);
-				if(!rpaths)
-					rpaths.add(ppath.parent());
+/**
+ * Open a plug-in file and check it is compatible with the plugger.
+ * This function does not change the plugger state and can be called
+ * concurrently.
+ * @param path		Path of the plug-in file.
+ * @param handle	Set to the library handle.
+ * @param err		Set to the error code in case of error.
+ * @param msg		Set to the error message in case of error.
+ * @return			Found plug-in or null.
+ */
+Plugin *Plugger::open(const sys::Path& path, void *& handle, error_t& err, string& msg) const {
 
-				// link the libraries
-				for(int i = 0; i < libs.count(); i++)
-					if(!lookLibrary(evaluate(ppath, libs[i]), rpaths)) {
-						onError(level_error, _ << "cannot link " << libs[i]);
-						err = MISSING_DEP;
-						return 0;
-					}
-			}
-		}
+	// Open shared library
+	handle = link(path);
+	if(!handle) {
+		err = BAD_PLUGIN;
+		msg = _ << "invalid plugin found at \"" << path << "\" (no handle): " << error();
+		return 0;
+	}
+
+	// new version: look for builder function
+	Plugin *plugin = 0;
+	string fun_name = _ << _hook << fun_suffix;
+	void *sym = lookSymbol(handle, fun_name.toCString());
+	if(sym) {
+		typedef Plugin *(*fun_t)(void);
+		fun_t fun = (fun_t)sym;
+		plugin = fun();
 	}
-	catch(ini::Exception& e) {
+
+	// old version: look for the static object
+	else {
+		void *sym = lookSymbol(handle, _hook.chars());
+		if(sym)
+			plugin = static_cast<Plugin *>(sym);
 	}
-	return 0;
+
+	// plugin found?
+	if(!plugin) {
+		err = NO_HOOK;
+		unlink(handle);
+		msg = _ << "invalid plugin found at \"" << path << "\" (no hook)";
+		return 0;
+	}
+
+	// Check the magic
+	if(plugin->magic != Plugin::MAGIC) {
+		err = NO_MAGIC;
+		unlink(handle);
+		msg = _ << "invalid plugin found at \"" << path << "\" (bad magic)";
+		return 0;
+	}
+
+	// Check plugger version
+	if(!per_vers.accepts(plugin->pluggerVersion())) {
+		err = BAD_VERSION;
+		unlink(handle);
+		msg = _ << "bad version plugin found at \"" << path << "\" (required: " << per_vers << ", provided: " << plugin->pluggerVersion() << ")";
+		return 0;
+	}
+
+	return plugin;
 }
 
 
@@ -468,59 +979,336 @@ Plugin *Plugger::plugFile(sys::Path path) {
 #	endif
 
 	// Open shared library
-	void *handle = link(path);
-	if(!handle) {
-		err = BAD_PLUGIN;
-		onError(level_warning, _ << "invalid plugin found at \"" << path << "\" (no handle): " << error());
+	void *handle;
+	string msg;
+	Plugin *plugin = open(path, handle, err, msg);
+	if(!plugin) {
+		onError(level_warning, msg);
 		return 0;
 	}
 
-	// new version: look for builder function
-	Plugin *plugin = 0;
-	string fun_name = _ << _hook << fun_suffix;
-	void *sym = lookSymbol(handle, fun_name.toCString());
-	if(sym) {
-		typedef Plugin *(*fun_t)(void);
-		fun_t fun = (fun_t)sym;
-		plugin = fun();
+	// Plug it
+	plugin->setPath(path);
+	for(Vector<Plugin *>::Iter dep(deps); dep(); dep++)
+		plugin->deps.add(*dep);
+	if(_index != nullptr)
+		_index->record(path, plugin);
+	return plug(plugin, handle);
+}
+
+
+/**
+ * Loader of a set of plug-ins. The dependency graph is first built
+ * from the ELD files; then the plug-ins are opened and started up by
+ * a job scheduler as soon as all their dependencies are loaded.
+ */
+class Plugger::Loader: public JobProducer {
+public:
+
+	class Node: public Job {
+	public:
+		typedef enum {
+			FRESH,
+			VISITING,
+			RESOLVED
+		} state_t;
+
+		inline Node(Loader& loader, const sys::Path& path)
+			: _loader(loader), _path(path), state(FRESH), uses(0), waiting(0),
+			  plugin(nullptr), handle(nullptr), started(false), err(OK) { }
+		inline bool isJob(void) const { return plugin == nullptr && err == OK; }
+
+		/**
+		 * Link the libraries, open the plug-in and start it up.
+		 * Called concurrently: only the node itself is modified.
+		 */
+		void run(void) override {
+			for(auto d: deps)
+				if(d->err != OK) {
+					err = MISSING_DEP;
+					msg = _ << "cannot plug " << _path << " as dependency " << d->_path << " failed";
+					return;
+				}
+
+			// pre-link libraries
+			if(eld.libs) {
+				Vector<string> rpaths;
+				for(auto r: eld.rpath)
+					rpaths.add(evaluate(ppath(), r));
+				if(!rpaths)
+					rpaths.add(ppath().parent());
+				for(auto l: eld.libs)
+					if(!lookLibrary(evaluate(ppath(), l), rpaths)) {
+						err = MISSING_DEP;
+						msg = _ << "cannot link " << l;
+						return;
+					}
+			}
+
+			// open the plugin
+			plugin = _loader._plugger.open(_path, handle, err, msg);
+			if(plugin != nullptr && plugin->state == 0) {
+				plugin->startup();
+				started = true;
+			}
+		}
+
+		inline sys::Path ppath(void) const { return _path.setExtension(ELD_EXT); }
+
+		Loader& _loader;
+		sys::Path _path;
+		state_t state;
+		int uses, waiting;
+		ELD eld;
+		Vector<Node *> deps, users;
+		Plugin *plugin;
+		void *handle;
+		bool started;
+		error_t err;
+		string msg;
+	};
+
+	inline Loader(Plugger& plugger): _plugger(plugger), _cycle(false) { }
+	inline ~Loader(void) { for(auto n: _all) delete n; }
+
+	/**
+	 * Resolve a plug-in by its name, as Plugger::plug() does.
+	 * @param name	Plug-in name or path.
+	 * @return		Matching node.
+	 */
+	Node *resolve(const string& name) {
+		if(name.startsWith("/"))
+			return resolveFile(name);
+
+		// already available plug-ins
+		Plugin *plugin = nullptr;
+		for(auto p: _plugger.plugins)
+			if(p->matches(name)) {
+				plugin = p;
+				plugin->plug(nullptr);
+				break;
+			}
+		if(plugin == nullptr) {
+			plugin = Plugin::get(_plugger._hook, name);
+			if(plugin != nullptr)
+				_plugger.plug(plugin, nullptr);
+		}
+		if(plugin != nullptr) {
+			Node *node = make(name);
+			node->plugin = plugin;
+			node->state = Node::RESOLVED;
+			return node;
+		}
+
+		// look in the paths
+		for(auto dir: _plugger._paths) {
+			sys::Path path(_ << dir << "/" << name);
+			if(_plugger._index != nullptr) {
+				Index::Entry *e = _plugger._index->find(path.dirPart(), path.namePart());
+				if(e == nullptr)
+					continue;
+				path = path.dirPart() / e->name;
+			}
+			else if(!sys::Path(_ << path << "." << PLUG_EXT).exists()
+				 && !sys::Path(_ << path << "." << ELD_EXT).exists())
+				continue;
+			return resolveFile(sys::Path(_ << path << "." << PLUG_EXT));
+		}
+
+		// not found
+		Node *node = make(name);
+		node->err = NO_PLUGIN;
+		node->msg = _ << "cannot find plug-in " << name;
+		node->state = Node::RESOLVED;
+		return node;
 	}
 
-	// old version: look for the static object
-	else {
-		void *sym = lookSymbol(handle, _hook.chars());
-		if(sym)
-			plugin = static_cast<Plugin *>(sym);
+	/**
+	 * Resolve a plug-in by its path, as Plugger::plugFile() does.
+	 * @param path	Plug-in path.
+	 * @return		Matching node.
+	 */
+	Node *resolveFile(sys::Path path) {
+		if(path.extension() != PLUG_EXT)
+			path = path.setExtension(PLUG_EXT);
+
+		// already known?
+		Node *node = _nodes.get(path.toString(), nullptr);
+		if(node != nullptr) {
+			if(node->state == Node::VISITING) {
+				_plugger.onError(level_error, _ << "dependency cycle on plug-in " << path);
+				_cycle = true;
+			}
+			node->uses++;
+			return node;
+		}
+		node = make(path);
+		node->uses = 1;
+		_nodes.put(path.toString(), node);
+
+		// process the ELD
+		node->state = Node::VISITING;
+		_plugger.getELD(node->ppath(), node->eld);
+		if(node->eld.found && node->eld.path) {
+			Node *target = resolveFile(evaluate(node->ppath(), node->eld.path));
+			_nodes.put(path.toString(), target);
+			node->state = Node::RESOLVED;
+			node->err = NO_PLUGIN;
+			return target;
+		}
+		if(!path.exists()) {
+			node->err = NO_PLUGIN;
+			node->msg = _ << "cannot find plug-in " << path;
+		}
+		else
+			for(auto d: node->eld.deps)
+				node->deps.add(resolve(evaluate(node->ppath(), d)));
+		node->state = Node::RESOLVED;
+		return node;
 	}
 
-	// plugin found?
-	if(!plugin) {
-		err = NO_HOOK;
-		unlink(handle);
-		onError(level_warning, _ << "invalid plugin found at \"" << path << "\" (no hook)");
-		return 0;
+	/**
+	 * Load the resolved plug-ins.
+	 * @param thread_count	Number of threads to use (0 for automatic).
+	 */
+	void load(int thread_count) {
+
+		// build the reverse dependencies
+		int jobs = 0;
+		for(auto n: _all)
+			if(n->isJob() && n->state == Node::RESOLVED) {
+				jobs++;
+				for(auto d: n->deps)
+					if(d->isJob()) {
+						n->waiting++;
+						d->users.add(n);
+					}
+				if(n->waiting == 0)
+					_ready.add(n);
+			}
+		if(jobs == 0)
+			return;
+
+		// launch the jobs
+		if(thread_count <= 0)
+			thread_count = min(System::coreCount(), LOAD_THREADS);
+		JobScheduler sched(*this);
+		sched.setThreadCount(max(1, min(thread_count, jobs)));
+		sched.start();
 	}
 
-	// Check the magic
-	if(plugin->magic != Plugin::MAGIC) {
-		err = NO_MAGIC;
-		unlink(handle);
-		onError(level_warning, _ << "invalid plugin found at \"" << path << "\" (bad magic)");
-		return 0;
+	Job *next(void) override {
+		if(!_ready)
+			return nullptr;
+		else
+			return _ready.pop();
 	}
 
-	// Check plugger version
-	if(!per_vers.accepts(plugin->pluggerVersion())) {
-		err = BAD_VERSION;
-		unlink(handle);
-		onError(level_warning, _ << "bad version plugin found at \"" << path << "\" (required: " << per_vers << ", provided: " << plugin->pluggerVersion() << ")");
-		return 0;
+	/**
+	 * Record the plug-in of a finished job and release its users.
+	 * Called with the scheduler lock held.
+	 */
+	void harvest(Job *job) override {
+		Node *n = static_cast<Node *>(job);
+		if(n->err != OK) {
+			_plugger.err = n->err;
+			_plugger.onError(n->err == MISSING_DEP ? level_error : level_warning, n->msg);
+		}
+		else {
+			n->plugin->setPath(n->_path);
+			for(auto d: n->deps)
+				n->plugin->deps.add(d->plugin);
+			if(_plugger._index != nullptr)
+				_plugger._index->record(n->_path, n->plugin);
+			_plugger.plug(n->plugin, n->handle, n->started);
+			for(int i = 1; i < n->uses; i++)
+				n->plugin->plug(nullptr);
+		}
+		for(auto u: n->users)
+			if(--u->waiting == 0)
+				_ready.add(u);
 	}
 
-	// Plug it
-	plugin->setPath(path);
-	for(Vector<Plugin *>::Iter dep(deps); dep(); dep++)
-		plugin->deps.add(*dep);
-	return plug(plugin, handle);
+	inline bool hasCycle(void) const { return _cycle; }
+
+	/**
+	 * Release the plug-ins already obtained by resolution, used when
+	 * the loading is aborted.
+	 */
+	void release(void) {
+		for(auto n: _all)
+			if(n->plugin != nullptr)
+				n->plugin->unplug();
+	}
+
+	Plugger& _plugger;
+
+private:
+
+	Node *make(const sys::Path& path) {
+		Node *node = new Node(*this, path);
+		_all.add(node);
+		return node;
+	}
+
+	HashMap<string, Node *> _nodes;
+	Vector<Node *> _all, _ready;
+	bool _cycle;
+};
+
+
+/**
+ * Plug a set of plug-ins concurrently. The dependency graph of the plug-ins
+ * is first built from the ELD files. Then, the plug-ins are opened and
+ * started up on a small pool of threads: a plug-in is only loaded once
+ * all its dependencies are loaded and started up, so independent
+ * sub-trees of the graph are processed concurrently.
+ *
+ * As a consequence, the startup() of plug-ins may run concurrently.
+ * It must not use the plugger: the plug-ins it requires must be declared
+ * as dependencies in the ELD file.
+ *
+ * Errors are reported as for plug(), through the error handler.
+ * If a dependency cycle is found, nothing is loaded.
+ *
+ * @param names			Names (or paths) of the plug-ins to load.
+ * @param plugins		Filled with the plug-ins matching the names
+ * 						(null for a plug-in that cannot be plugged).
+ * @param thread_count	Number of threads to use (0 for automatic).
+ * @return				True if all plug-ins have been plugged, false else.
+ */
+bool Plugger::plugAll(const Vector<string>& names, Vector<Plugin *>& plugins, int thread_count) {
+	Plugin::static_done = true;
+	err = OK;
+
+	// build the dependency graph
+	Loader loader(*this);
+	Vector<Loader::Node *> roots;
+	for(auto name: names)
+		roots.add(loader.resolve(name));
+	if(loader.hasCycle()) {
+		loader.release();
+		err = MISSING_DEP;
+		for(int i = 0; i < names.count(); i++)
+			plugins.add(nullptr);
+		return false;
+	}
+
+	// load the plug-ins
+	for(auto r: roots)
+		if(r->err == NO_PLUGIN && r->msg) {
+			err = NO_PLUGIN;
+			onError(level_error, r->msg);
+		}
+	loader.load(thread_count);
+
+	// collect the result
+	bool ok = true;
+	for(auto r: roots) {
+		plugins.add(r->plugin);
+		ok = ok && r->plugin != nullptr;
+	}
+	return ok;
 }
 
 
@@ -683,8 +1471,13 @@ void Plugger::Iter::go(void) {
 			}
 		}
 
-		// Look current file
+		// Look current file (without loading it if the index knows it)
 		if(isLibrary(**file)) {
+			if(plugger._index != nullptr) {
+				Index::Entry *e = plugger._index->lookup((*file)->path());
+				if(e != nullptr && e->checked)
+					break;
+			}
 			Plugin *plugin = plugger.plugFile(file->item()->path());
 			if(plugin) {
 				plugin->unplug();
@@ -37,6 +37,7 @@
 #else
 #	include <dlfcn.h>
 #endif
+#include <elm/sys/Mutex.h>
 #include <elm/sys/Plugin.h>
 #include <elm/sys/Plugger.h>
 
@@ -239,6 +240,11 @@ namespace elm { namespace sys {
 Vector<Plugin *> Plugin::static_plugins;
 
 
+// protect the static plug-in list as plug-in constructors may be run
+// concurrently by Plugger::plugAll() (statically initialized)
+static sys::Mutex statics_lock;
+
+
 /**
  * True when all static has been initialized.
  */
@@ -272,8 +278,10 @@ Plugin::Plugin(
 	_handle(0),
 	state(0)
 {
-	if(hook && !static_done)
+	if(hook && !static_done) {
+		sys::Guard<sys::Mutex> guard(statics_lock);
 		static_plugins.add(this);
+	}
 	_aliases.copy(aliases);
 }
 
@@ -293,8 +301,10 @@ Plugin::Plugin(const Plugin::make& maker)
  	_handle(0),
  	state(0)
 {
-	if(_hook && !static_done)
+	if(_hook && !static_done) {
+		sys::Guard<sys::Mutex> guard(statics_lock);
 		static_plugins.add(this);
+	}
 	if(maker.aliases) {
 		Vector<string> as;
 		as.addAll(maker.aliases);
@@ -310,12 +320,16 @@ Plugin::~Plugin(void) {
 
 /**
  * For internal use only.
+ * @param handle	Handle of the library containing the plugin (null for static plug-ins).
+ * @param started	If true, startup() has already been called.
  */
-void Plugin::plug(void *handle) {
+void Plugin::plug(void *handle, bool started) {
 
 	// no static if there is an handle
-	if(handle)
+	if(handle) {
+		sys::Guard<sys::Mutex> guard(statics_lock);
 		static_plugins.remove(this);
+	}
 
 	// usage incrementation
 	if(state > 0)
@@ -323,7 +337,8 @@ void Plugin::plug(void *handle) {
 
 	// Initialization
 	else if(state == 0) {
-		startup();
+		if(!started)
+			startup();
 		state = 1;
 		if(handle) {
 #if defined(__unix)
@@ -331,8 +346,6 @@ void Plugin::plug(void *handle) {
 #elif defined(__WIN32) || defined(__WIN64)
 			_handle = reinterpret_cast<HMODULE&>(handle);
 #endif
-
-			static_plugins.remove(this);
 		}
 	}
 
@@ -446,6 +459,7 @@ void Plugin::step(void) {
 Plugin *Plugin::get(cstring hook, const string& name) {
 
 	// Find the plugin
+	sys::Guard<sys::Mutex> guard(statics_lock);
 	for(int i = 0; i < static_plugins.count(); i++)
 		if(static_plugins[i]->hook() == hook
 		&& static_plugins[i]->matches(name))
@@ -83,6 +83,16 @@ Process::~Process(void) {
  */
 
 
+/**
+ * Get the system identifier of the process.
+ * @return	Process identifier or -1 if it is not available
+ * 			(not supported or process already waited).
+ */
+int Process::id(void) {
+	return -1;
+}
+
+
 /*** Unix Process Implementation ***/
 #if defined(__unix) || defined(__APPLE__)
 
@@ -128,7 +138,11 @@ Process::~Process(void) {
 				return;
 			}
 			else
-				throw new SystemException(errno, "process wait");
+				throw SystemException(errno, "process wait");
+		}
+
+		virtual int id(void) {
+			return pid;
 		}
 
 	private:
@@ -202,7 +216,7 @@ Process::~Process(void) {
 			}
 			else {
 				win::setError(GetLastError());
-				throw new SystemException(win::getError(), win::getErrorMessage());
+				throw SystemException(win::getError(), win::getErrorMessage());
 			}
 		}
 
@@ -24,6 +24,10 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <errno.h>
+#if defined(__unix) || defined(__APPLE__)
+#	include <spawn.h>
+	extern char **environ;
+#endif
 #include <elm/sys/ProcessBuilder.h>
 #include <elm/sys/SystemException.h>
 #include <elm/io.h>
@@ -45,6 +49,19 @@ namespace elm { namespace sys {
 /**
  * @class ProcessBuilder
  * This class is used to build a new process by launching a command line.
+ *
+ * On Unix systems, the process is created with posix_spawn(), that avoids
+ * to duplicate the address space of the parent (vfork-like creation).
+ * The standard streams are redirected only in the child so that several
+ * threads may launch processes concurrently.
+ *
+ * A command that cannot be launched (missing or not executable) makes run()
+ * throw a @ref SystemException: with the former fork()/exec() implementation,
+ * run() returned a process exiting with code 1. As everywhere in ELM,
+ * the exceptions are thrown by value.
+ *
+ * To run many processes concurrently, see @ref ProcessPool and
+ * @ref ProcessMonitor.
  * @ingroup system
  */
 
@@ -127,87 +144,57 @@ void ProcessBuilder::setError(SystemOutStream *_err) {
 /**
  * Run the built process.
  * @return	The built process.
- * @throws SystemException	Thrown if there is an error during the build.
+ * @throws SystemException	Thrown if there is an error during the build,
+ * 							including when the command cannot be launched.
  */
 Process *ProcessBuilder::run(void) {
 #if defined(__unix) || defined(__APPLE__)
-	int error = 0;
-	int old_in = -1, old_out = -1, old_err = -1;
-
 	Process *process = 0;
 
-	// Prepare the streams
-	if(in->fd() != io::in.fd()) {
-		old_in = dup(0);
-		if(old_in < 0)
-			error = errno;
-		else
-			dup2(in->fd(), 0);
+	// redirect the streams in the child only
+	posix_spawn_file_actions_t actions;
+	posix_spawn_file_actions_init(&actions);
+	if(in->fd() != 0)
+		posix_spawn_file_actions_adddup2(&actions, in->fd(), 0);
+	if(out->fd() != 1)
+		posix_spawn_file_actions_adddup2(&actions, out->fd(), 1);
+	if(err->fd() != 2)
+		posix_spawn_file_actions_adddup2(&actions, err->fd(), 2);
+
+	// prepare the attributes
+	posix_spawnattr_t attrs;
+	posix_spawnattr_init(&attrs);
+	short flags = 0;
+#	ifdef POSIX_SPAWN_USEVFORK
+		flags |= POSIX_SPAWN_USEVFORK;
+#	endif
+	if(new_session) {
+#		ifdef POSIX_SPAWN_SETSID
+			flags |= POSIX_SPAWN_SETSID;
+#		else
+			flags |= POSIX_SPAWN_SETPGROUP;
+			posix_spawnattr_setpgroup(&attrs, 0);
+#		endif
 	}
-	if(!errno && out->fd() != io::out.fd()) {
-		old_out = dup(1);
-		if(old_out < 0)
-			error = errno;
-		else
-			dup2(out->fd(), 1);
-	}
-	if(!errno && err->fd() != io::err.fd()) {
-		old_err = dup(2);
-		if(old_err < 0)
-			error = errno;
-		else
-			dup2(err->fd(), 2);
-	}
-
-	// Create the process
-	if(!error) {
-		int pid = fork();
-		// error
-		if(pid < 0)
-			error = errno;
-		// father
-		else if(pid != 0)
-			process = makeProcess(pid);
-		// son
-		else {
-
-			// if needed, create new session
-			if(new_session) {
-				int r = setsid();
-				if(r < 0) {
-					cerr << "ERROR: cannot create new session!\n";
-					exit(1);
-				}
-			}
-
-			// build arguments
-			char *tab[args.count() + 1];
-			for(int i = 0; i < args.count(); i++)
-				tab[i] = (char *)args[i].toCString().chars();
-			tab[args.count()] = 0;
-
-			// Launch the command
-			execvp(tab[0], tab);
-			exit(1);
-		}
+	posix_spawnattr_setflags(&attrs, flags);
+
+	// build arguments
+	Vector<CString> cargs;
+	char *tab[args.count() + 1];
+	for(int i = 0; i < args.count(); i++) {
+		cargs.add(args[i].toCString());
+		tab[i] = const_cast<char *>(cargs[i].chars());
 	}
+	tab[args.count()] = 0;
 
-	// Reset the streams
-	if(old_in >= 0) {
-		close(0);
-		dup2(old_in, 0);
-		close(old_in);
-	}
-	if(old_out >= 0) {
-		close(1);
-		dup2(old_out, 1);
-		close(old_out);
-	}
-	if(old_err >= 0) {
-		close(2);
-		dup2(old_err, 2);
-		close(old_err);
-	}
+	// launch the command
+	pid_t pid;
+	int error = posix_spawnp(&pid, tab[0], &actions, &attrs, tab, environ);
+	posix_spawnattr_destroy(&attrs);
+	posix_spawn_file_actions_destroy(&actions);
+	if(error != 0)
+		throw SystemException(error, _ << "cannot launch " << args[0]);
+	process = makeProcess(pid);
 
 #elif defined(__WIN32) || defined(__WIN64)
 	// no  need to redirect output, if bInheritHandles is set to false when creating process
@@ -258,7 +245,7 @@ Process *ProcessBuilder::run(void) {
 	// Return the result
 	if(error){
 		cout << "error detected " << GetLastError() << io::endl;
-		throw new SystemException(error, "process building");
+		throw SystemException(error, "process building");
 	}
 	else
 		return process;
@@ -271,7 +258,7 @@ Process *ProcessBuilder::run(void) {
 
 	// Return the result
 	if(error)
-		throw new SystemException(error, "process building");
+		throw SystemException(error, "process building");
 	else
 		return process;
 }
@@ -0,0 +1,213 @@
+/*
+ *	ProcessMonitor class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/sys/ProcessMonitor.h>
+#include <elm/sys/SystemException.h>
+#if defined(__unix) || defined(__APPLE__)
+#	include <errno.h>
+#	include <fcntl.h>
+#	include <poll.h>
+#	include <unistd.h>
+#	if defined(__linux__)
+#		include <sys/syscall.h>
+#	endif
+#elif defined(__WIN32) || defined(__WIN64)
+#	include <windows.h>
+#endif
+
+namespace elm { namespace sys {
+
+/**
+ * @class ProcessMonitor
+ * Wait for the end of many processes from a single thread.
+ * Each watched process is associated with a handler called when the process
+ * ends. The handlers are called by poll() that waits for the end of at least
+ * one process:
+ * @code
+ * 	ProcessMonitor monitor;
+ * 	for(auto b: builders)
+ * 		monitor.watch(*b.run(), [](Process& p) {
+ * 			cout << "ended with " << p.returnCode() << io::endl;
+ * 			delete &p;
+ * 		});
+ * 	monitor.waitAll();
+ * @endcode
+ *
+ * On Linux, the end of processes is detected with process file descriptors
+ * (pidfd_open()) so that poll() sleeps until a process ends. When not available,
+ * the processes are periodically checked.
+ *
+ * watch() and poll() must be called by the same thread but wake() can be
+ * called from any thread to make poll() return.
+ * @ingroup system
+ */
+
+// period (ms) of checking for processes without descriptor
+static const int CHECK_PERIOD = 5;
+
+/**
+ */
+ProcessMonitor::ProcessMonitor(void) {
+	_wake[0] = _wake[1] = -1;
+#	if defined(__unix) || defined(__APPLE__)
+		if(::pipe(_wake) < 0)
+			throw SystemException(errno, "process monitor");
+		for(int i = 0; i < 2; i++) {
+			fcntl(_wake[i], F_SETFD, FD_CLOEXEC);
+			fcntl(_wake[i], F_SETFL, O_NONBLOCK);
+		}
+#	endif
+}
+
+/**
+ * The processes still watched are no more watched (but they are not killed).
+ */
+ProcessMonitor::~ProcessMonitor(void) {
+	for(auto e: _entries) {
+#		if defined(__unix) || defined(__APPLE__)
+			if(e->fd >= 0)
+				::close(e->fd);
+#		endif
+		delete e;
+	}
+#	if defined(__unix) || defined(__APPLE__)
+		::close(_wake[0]);
+		::close(_wake[1]);
+#	endif
+}
+
+/**
+ * @fn int ProcessMonitor::count(void) const;
+ * Get the number of watched processes.
+ * @return	Number of watched processes.
+ */
+
+/**
+ * @fn bool ProcessMonitor::isEmpty(void) const;
+ * Test if there is no more watched process.
+ * @return	True if no process is watched, false else.
+ */
+
+/**
+ * Start watching a process.
+ * @param process	Watched process (must live until its handler is called).
+ * @param handler	Called when the process ends (the process being already waited).
+ */
+void ProcessMonitor::watch(Process& process, handler_t handler) {
+	entry_t *e = new entry_t;
+	e->process = &process;
+	e->handler = handler;
+	e->fd = -1;
+#	if defined(__linux__) && defined(SYS_pidfd_open)
+		if(process.id() >= 0)
+			e->fd = syscall(SYS_pidfd_open, process.id(), 0);
+#	endif
+	_entries.add(e);
+}
+
+/**
+ * Wait until at least one process ends, the time-out expires or wake()
+ * is called. The handlers of ended processes are called.
+ * @param timeout	Time-out in ms (-1 for no time-out).
+ * @return			Number of ended processes.
+ */
+int ProcessMonitor::poll(int timeout) {
+	Vector<entry_t *> ended;
+#	if defined(__unix) || defined(__APPLE__)
+
+		// prepare the descriptors
+		int n = _entries.count();
+		struct pollfd fds[n + 1];
+		fds[0].fd = _wake[0];
+		fds[0].events = POLLIN;
+		bool check = false;
+		for(int i = 0; i < n; i++) {
+			fds[i + 1].fd = _entries[i]->fd;
+			fds[i + 1].events = POLLIN;
+			fds[i + 1].revents = 0;
+			if(_entries[i]->fd < 0)
+				check = true;
+		}
+		if(check && (timeout < 0 || timeout > CHECK_PERIOD))
+			timeout = CHECK_PERIOD;
+
+		// wait for events
+		int r = ::poll(fds, n + 1, timeout);
+		if(r < 0 && errno != EINTR)
+			throw SystemException(errno, "process monitor");
+		if(r > 0 && (fds[0].revents & POLLIN)) {
+			char buf[64];
+			while(::read(_wake[0], buf, sizeof(buf)) > 0)
+				;
+		}
+
+		// collect ended processes
+		for(int i = n - 1; i >= 0; i--) {
+			entry_t *e = _entries[i];
+			if(e->fd >= 0 ? (fds[i + 1].revents != 0) : !e->process->isAlive()) {
+				if(e->fd >= 0)
+					::close(e->fd);
+				ended.add(e);
+				_entries.removeAt(i);
+			}
+		}
+
+#	else
+		for(int i = _entries.count() - 1; i >= 0; i--)
+			if(!_entries[i]->process->isAlive()) {
+				ended.add(_entries[i]);
+				_entries.removeAt(i);
+			}
+		if(ended.isEmpty())
+			Sleep(timeout < 0 || timeout > CHECK_PERIOD ? CHECK_PERIOD : timeout);
+#	endif
+
+	// call the handlers
+	for(int i = ended.count() - 1; i >= 0; i--) {
+		entry_t *e = ended[i];
+		e->process->wait();
+		e->handler(*e->process);
+		delete e;
+	}
+	return ended.count();
+}
+
+/**
+ * Wait for the end of all watched processes.
+ */
+void ProcessMonitor::waitAll(void) {
+	while(!_entries.isEmpty())
+		poll();
+}
+
+/**
+ * Make the current or the next call to poll() return.
+ * Can be called from any thread.
+ */
+void ProcessMonitor::wake(void) {
+#	if defined(__unix) || defined(__APPLE__)
+		char c = 0;
+		while(::write(_wake[1], &c, 1) < 0 && errno == EINTR)
+			;
+#	endif
+}
+
+} }	// elm::sys
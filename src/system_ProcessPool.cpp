@@ -0,0 +1,257 @@
+/*
+ *	ProcessPool class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/sys/ProcessPool.h>
+#include <elm/sys/SystemException.h>
+
+namespace elm { namespace sys {
+
+/**
+ * @class ProcessPool
+ * Run a set of commands with a bounded number of concurrent processes.
+ * Each command is given as a @ref ProcessBuilder to submit() that returns
+ * a @ref Job. The process of a job is started as soon as the number of running
+ * processes allows it. Its standard output is captured in a pipe and can be
+ * read, while the process runs, from the stream returned by Job::output().
+ * @code
+ * 	ProcessPool pool(8);
+ * 	Vector<ProcessPool::Job *> jobs;
+ * 	for(auto f: files) {
+ * 		ProcessBuilder b("objdump");
+ * 		b += "-d";
+ * 		b += f;
+ * 		jobs.add(pool.submit(b));
+ * 	}
+ * 	for(auto j: jobs) {
+ * 		io::Input in(j->output());
+ * 		...
+ * 		if(j->wait() != 0)
+ * 			cerr << "ERROR: " << j->error() << io::endl;
+ * 		delete j;
+ * 	}
+ * @endcode
+ *
+ * The processes are launched and waited by a single driver thread using
+ * a @ref ProcessMonitor: there is no thread per process.
+ *
+ * As the output of a job is a pipe of limited capacity, the output of
+ * a capturing job must be read, else the process will block and keep its
+ * slot in the pool.
+ * @ingroup system
+ */
+
+/**
+ * @class ProcessPool::Job
+ * A command submitted to a @ref ProcessPool. A job is deleted by the user:
+ * if it is not started yet, it is cancelled; if its process is running,
+ * its output is closed and the end of the process is waited.
+ * @ingroup system
+ */
+
+// driver thread of the pool
+class ProcessPool::Driver: public Runnable {
+public:
+	Driver(ProcessPool& pool): p(pool) { }
+	void run(void) override {
+		p._lock.lock();
+		while(true) {
+			while(p._running < p._count && p._head < p._queue.count()) {
+				Job *j = p._queue[p._head++];
+				if(j != nullptr)
+					p.start(j);
+			}
+			if(p._head == p._queue.count()) {
+				p._queue.clear();
+				p._head = 0;
+			}
+			if(p._stop && p._running == 0 && p._queue.isEmpty())
+				break;
+			p._lock.unlock();
+			p._monitor.poll();
+			p._lock.lock();
+		}
+		p._lock.unlock();
+	}
+private:
+	ProcessPool& p;
+};
+
+/**
+ * Build a process pool.
+ * @param count		Maximum number of running processes (0 for the number of cores).
+ */
+ProcessPool::ProcessPool(int count):
+	_count(count > 0 ? count : System::coreCount()), _running(0), _head(0), _stop(false)
+{
+	if(_count <= 0)
+		_count = 1;
+	_driver = new Driver(*this);
+	_thread = Thread::make(*_driver);
+	_thread->start();
+}
+
+/**
+ * Wait for the end of all submitted jobs.
+ */
+ProcessPool::~ProcessPool(void) {
+	_lock.lock();
+	_stop = true;
+	_lock.unlock();
+	_monitor.wake();
+	_thread->join();
+	delete _thread;
+	delete _driver;
+}
+
+/**
+ * @fn int ProcessPool::count(void) const;
+ * Get the maximum number of running processes.
+ * @return	Maximum number of processes.
+ */
+
+/**
+ * Submit a command to the pool.
+ * @param builder	Builder of the process (copied).
+ * @param capture	If true, the output of the process is captured and available
+ * 					with Job::output(). Else the output of the builder is used.
+ * @return			Job representing the command (to delete by the caller).
+ */
+ProcessPool::Job *ProcessPool::submit(const ProcessBuilder& builder, bool capture) {
+	Job *j = new Job(*this, builder, capture);
+	_lock.lock();
+	ASSERTP(!_stop, "submitting to a stopped pool");
+	_queue.add(j);
+	_lock.unlock();
+	_monitor.wake();
+	return j;
+}
+
+/**
+ * Wait for the end of all submitted jobs.
+ */
+void ProcessPool::waitAll(void) {
+	_lock.lock();
+	_cond.wait(_lock, [this]() { return _running == 0 && _head == _queue.count(); });
+	_lock.unlock();
+}
+
+// start a job (called with lock taken by the driver)
+void ProcessPool::start(Job *j) {
+	SystemOutStream *out = nullptr;
+	try {
+		if(j->_capture) {
+			Pair<SystemInStream *, SystemOutStream *> p = System::pipe();
+			j->_out = p.fst;
+			out = p.snd;
+			j->_builder.setOutput(out);
+		}
+		j->_process = j->_builder.run();
+	}
+	catch(SystemException& e) {
+		j->_error = e.message();
+	}
+	delete out;
+	j->_started = true;
+	if(j->_process == nullptr) {
+		j->_done = true;
+		_cond.notifyAll();
+		return;
+	}
+	_running++;
+	_cond.notifyAll();
+	_monitor.watch(*j->_process, [this, j](Process& p) {
+		Guard<Mutex> g(_lock);
+		j->_code = p.returnCode();
+		j->_done = true;
+		_running--;
+		_cond.notifyAll();
+	});
+}
+
+/**
+ */
+ProcessPool::Job::Job(ProcessPool& pool, const ProcessBuilder& builder, bool capture):
+	_pool(pool), _builder(builder), _process(nullptr), _out(nullptr),
+	_code(-1), _capture(capture), _started(false), _done(false)
+{ }
+
+/**
+ */
+ProcessPool::Job::~Job(void) {
+	_pool._lock.lock();
+	if(!_started) {
+		for(int i = _pool._head; i < _pool._queue.count(); i++)
+			if(_pool._queue[i] == this)
+				_pool._queue[i] = nullptr;
+		_pool._cond.notifyAll();
+		_pool._lock.unlock();
+		return;
+	}
+	_pool._lock.unlock();
+	delete _out;
+	wait();
+	delete _process;
+}
+
+/**
+ * Get the captured output of the job. Wait for the job to be started.
+ * The stream ends when the process ends.
+ * @return	Output stream.
+ */
+SystemInStream& ProcessPool::Job::output(void) {
+	ASSERTP(_capture, "output of the job is not captured");
+	Guard<Mutex> g(_pool._lock);
+	_pool._cond.wait(_pool._lock, [this]() { return _started; });
+	if(_out == nullptr) {
+		Pair<SystemInStream *, SystemOutStream *> p = System::pipe();
+		delete p.snd;
+		_out = p.fst;
+	}
+	return *_out;
+}
+
+/**
+ * Wait for the end of the job.
+ * @return	Return code of the process or -1 if the process cannot be launched
+ * 			(see error()).
+ */
+int ProcessPool::Job::wait(void) {
+	Guard<Mutex> g(_pool._lock);
+	_pool._cond.wait(_pool._lock, [this]() { return _done; });
+	return _code;
+}
+
+/**
+ * Test if the job is done.
+ * @return	True if the process is ended or cannot be launched.
+ */
+bool ProcessPool::Job::isDone(void) {
+	Guard<Mutex> g(_pool._lock);
+	return _done;
+}
+
+/**
+ * @fn const string& ProcessPool::Job::error(void) const;
+ * Get the error message if the process cannot be launched.
+ * @return	Error message (empty if there is no error).
+ */
+
+} }	// elm::sys
@@ -99,7 +99,8 @@ void Runnable::stop(void) {
  * The threads execution supports:
  * @li @ref join() at end,
  * @li @ref kill() killing,
- * @li @ref Mutex synchronization.
+ * @li synchronization with @ref Mutex, @ref SpinLock, @ref RWLock,
+ * @ref CondVar, @ref Barrier, @ref Latch and @ref Once.
  */
 
 /**
@@ -167,35 +168,6 @@ Thread::~Thread(void) {
  */
 
 
-/**
- * @class Mutex
- * System-independent implementation of a mutex.
- */
-
-/**
- */
-Mutex::~Mutex(void) { }
-
-/**
- * @fn void Mutex::lock(void);
- * Acquire the mutex. If mutex is not available, block until it becomes available.
- * @throw SystemException	No more place in waiting queue.
- */
-
-/**
- * @fn void Mutex::unlock(void);
- * Release a mutex acquired by the current thread.
- * @throw SystemException	Mutex not owned by the current thread.
- */
-
-/**
- * bool Mutex::tryLock(void);
- * If the mutex is free, acquire it. Else return immediately without blocking.
- * @return	True if the mutex has been acquired, false else.
- * @throw SystemException	No more place in waiting queue.
- */
-
-
 #if defined(__unix) || defined(__APPLE__)
 
 	/**
@@ -272,58 +244,6 @@ Mutex::~Mutex(void) { }
 	};
 	pthread_key_t PThread::_key;
 
-	class PMutex: public Mutex {
-	public:
-
-		PMutex(void) {
-			int r = pthread_mutex_init(&h, 0);
-			if(r != 0)
-				throw SystemException(errno, "elm::Mutex");
-		}
-
-		~PMutex(void) {
-			pthread_mutex_destroy(&h);
-		}
-
-		virtual void lock(void) {
-			int r = pthread_mutex_lock(&h);
-			if(r)
-				switch(errno) {
-				case EAGAIN:	throw SystemException(SystemException::NO_MORE_RESOURCE, "no more place in queue");
-				case EDEADLK:
-				case EINVAL:
-				default:		ASSERT(false); break;
-				}
-		}
-
-		virtual void unlock(void) {
-			int r = pthread_mutex_unlock(&h);
-			if(r != 0)
-				switch(errno) {
-				case EPERM:		throw SystemException(SystemException::NO_ACCESS, "elm::Mutex: illegal unlock");
-				case EINVAL:
-				default:		ASSERT(false); break;
-				}
-
-		}
-
-		virtual bool tryLock(void) {
-			int r = pthread_mutex_trylock(&h);
-			if(r == 0)
-				return true;
-			else
-				switch(errno) {
-				case EBUSY:		return false;
-				case EAGAIN:	throw SystemException(SystemException::NO_MORE_RESOURCE, "no more place in queue");
-				case EINVAL:
-				default:		ASSERT(false); return false;
-				}
-		}
-
-	private:
-		pthread_mutex_t h;
-	};
-
 	static PThread root;
 
 	void Thread::setRootRunnable(Runnable& runnable) {
@@ -388,36 +308,6 @@ Mutex::~Mutex(void) { }
 		HANDLE handle;
 	};
 
-	// TODO test it!
-	class WinMutex: public Mutex {
-	public:
-
-		WinMutex(void) {
-			h = CreateMutex(NULL, FALSE, NULL);
-			ASSERT(h != NULL);
-		}
-
-		~WinMutex(void) {
-			CloseHandle(h);
-		}
-
-		virtual void lock(void) {
-			WaitForSingleObject(h, INFINITE);
-		}
-
-		virtual void unlock(void) {
-			ReleaseMutex(h);
-		}
-
-		virtual bool tryLock(void) {
-			int r = WaitForSingleObject(h, 0);
-			return r != WAIT_TIMEOUT;
-		}
-
-	private:
-		HANDLE h;
-	};
-
 #endif
 
 
@@ -434,20 +324,4 @@ Thread *Thread::make(Runnable& runnable) {
 #	endif
 }
 
-
-/**
- * Build a new mutex.
- * @return	Created mutex.
- * @throw SystemException	If the mutex cannot be created.
- */
-Mutex *Mutex::make(void) {
-#	if defined(__unix) || defined(__APPLE__)
-		return new PMutex();
-#	elif defined(__WIN32) || defined(__WIN64)
-		return new WinMutex();
-#	else
-#		error "Mutex unsupported."
-#	endif
-
-}
 } }	// elm::sys
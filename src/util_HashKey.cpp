@@ -22,6 +22,7 @@
 
 #include <string.h>
 #include <elm/hash.h>
+#include <elm/checksum/XXHash64.h>
 #include <elm/sys/Path.h>
 
 namespace elm {
@@ -149,6 +150,19 @@ t::hash hash_cstring(const char *chars) {
 }
 
 
+/**
+ * Fast hashing of a memory block based on @ref checksum::XXHash64.
+ * It is used as default hash function for @ref String and @ref CString.
+ * @param block	Block to hash.
+ * @param size	Block size (in bytes).
+ * @return		Hash value.
+ * @ingroup utility
+ */
+t::hash hash_bytes(const void *block, int size) {
+	return t::hash(checksum::XXHash64::hash(block, size));
+}
+
+
 /**
  * Test equality of two memory blocks.
  * @param p1	First memory block.
@@ -0,0 +1,556 @@
+/*
+ *	IndexSet class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ * 
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software 
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <memory.h>
+#include <elm/int.h>
+#include <elm/util/IndexSet.h>
+
+namespace elm {
+
+/**
+ * @class IndexSet
+ * Set of integers in [0, size[ whose representation adapts to its density.
+ * A sparse set is stored as a sorted array of indices, costing 32 bits per index,
+ * while a dense set is stored as a bitmap, costing 1 bit per possible index.
+ * The set automatically switches to the bitmap when the array would become
+ * bigger than the bitmap, that is, when it contains more than size/32 indices,
+ * and goes back to the array when the number of indices falls below half this limit.
+ *
+ * The interface is the same as @ref BitVector (bit(), set(), clear(), applyOr(),
+ * applyAnd(), applyReset(), includes(), countOnes(), etc) and the set operations
+ * work between any mix of representations: a data-flow analysis domain can
+ * move from BitVector to IndexSet by changing a single typedef.
+ * Contrary to BitVector, countOnes() costs O(1).
+ *
+ * @ingroup utility
+ */
+
+
+/**
+ * Build an index set.
+ * @param size	Number of possible indices.
+ * @param set	If true, the set contains all indices, else it is empty.
+ */
+IndexSet::IndexSet(int size, bool set): _size(size), _cnt(0), _cap(0), _dense(false), _ids(nullptr) {
+	ASSERTP(size >= 0, "size must be positive");
+	if(set)
+		this->set();
+}
+
+
+/**
+ * Build an index set by copy.
+ * @param set	Set to copy.
+ */
+IndexSet::IndexSet(const IndexSet& set): _size(0), _cnt(0), _cap(0), _dense(false), _ids(nullptr) {
+	copy(set);
+}
+
+
+/**
+ * Build an index set containing the indices of the bits set in
+ * the given bit vector.
+ * @param vec	Bit vector to convert.
+ */
+IndexSet::IndexSet(const BitVector& vec): _size(vec.size()), _cnt(0), _cap(0), _dense(false), _ids(nullptr) {
+	for(BitVector::OneIterator i(vec); i(); i++)
+		set(*i);
+}
+
+
+/**
+ * @fn int IndexSet::size(void) const;
+ * Get the number of possible indices of the set.
+ * @return	Set size.
+ */
+
+/**
+ * @fn bool IndexSet::isDense(void) const;
+ * Test if the set is currently represented as a bitmap.
+ * @return	True if the set is a bitmap, false if it is a sorted array.
+ */
+
+/**
+ * @fn bool IndexSet::isEmpty(void) const;
+ * Test if the set is empty.
+ * @return	True if the set is empty, false else.
+ */
+
+/**
+ * @fn int IndexSet::countOnes(void) const;
+ * Get the number of indices in the set.
+ * @return	Number of indices.
+ */
+
+/**
+ * @fn bool IndexSet::bit(int i) const;
+ * Test if the given index is in the set.
+ * @param i		Tested index.
+ * @return		True if the index is in the set, false else.
+ */
+
+
+/**
+ * Add an index to the set.
+ * @param i		Added index.
+ */
+void IndexSet::set(int i) {
+	ASSERTP(0 <= i && i < _size, "index out of bounds");
+	if(_dense) {
+		word_t m = word_t(1) << (i & 63);
+		if(!(_bits[i >> 6] & m)) {
+			_bits[i >> 6] |= m;
+			_cnt++;
+		}
+		return;
+	}
+	int p = find(i);
+	if(p < _cnt && _ids[p] == index_t(i))
+		return;
+	if(_cnt + 1 > limit()) {
+		toDense();
+		set(i);
+		return;
+	}
+	if(_cnt == _cap) {
+		int c = _cap * 2 < MIN_CAP ? int(MIN_CAP) : _cap * 2;
+		index_t *ids = new index_t[c];
+		if(_cnt != 0) {
+			memcpy(ids, _ids, p * sizeof(index_t));
+			memcpy(ids + p + 1, _ids + p, (_cnt - p) * sizeof(index_t));
+		}
+		delete [] _ids;
+		_ids = ids;
+		_cap = c;
+	}
+	else
+		memmove(_ids + p + 1, _ids + p, (_cnt - p) * sizeof(index_t));
+	_ids[p] = i;
+	_cnt++;
+}
+
+
+/**
+ * Remove an index from the set.
+ * @param i		Removed index.
+ */
+void IndexSet::clear(int i) {
+	ASSERTP(0 <= i && i < _size, "index out of bounds");
+	if(_dense) {
+		word_t m = word_t(1) << (i & 63);
+		if(_bits[i >> 6] & m) {
+			_bits[i >> 6] &= ~m;
+			_cnt--;
+			if(_cnt < limit() / 2)
+				toSparse();
+		}
+		return;
+	}
+	int p = find(i);
+	if(p < _cnt && _ids[p] == index_t(i)) {
+		memmove(_ids + p, _ids + p + 1, (_cnt - p - 1) * sizeof(index_t));
+		_cnt--;
+	}
+}
+
+
+/**
+ * @fn void IndexSet::set(int i, bool value);
+ * Add or remove an index.
+ * @param i		Changed index.
+ * @param value	True to add the index, false to remove it.
+ */
+
+
+/**
+ * Add all possible indices to the set.
+ */
+void IndexSet::set(void) {
+	release();
+	if(_size == 0)
+		return;
+	_bits = new word_t[words()];
+	memset(_bits, 0xff, words() * sizeof(word_t));
+	if(_size & 63)
+		_bits[words() - 1] = (word_t(1) << (_size & 63)) - 1;
+	_dense = true;
+	_cnt = _size;
+}
+
+
+/**
+ * Remove all indices from the set.
+ */
+void IndexSet::clear(void) {
+	if(_dense)
+		release();
+	_cnt = 0;
+}
+
+
+/**
+ * Copy the given set in the current one.
+ * @param set	Set to copy.
+ */
+void IndexSet::copy(const IndexSet& set) {
+	if(this == &set)
+		return;
+	release();
+	_size = set._size;
+	_cnt = set._cnt;
+	if(set._dense) {
+		_bits = new word_t[words()];
+		memcpy(_bits, set._bits, words() * sizeof(word_t));
+		_dense = true;
+	}
+	else if(_cnt != 0) {
+		_cap = _cnt;
+		_ids = new index_t[_cap];
+		memcpy(_ids, set._ids, _cnt * sizeof(index_t));
+	}
+}
+
+
+/**
+ * Test if the current set includes the given one.
+ * @param set	Tested set.
+ * @return		True if the current set includes the given one, false else.
+ */
+bool IndexSet::includes(const IndexSet& set) const {
+	ASSERTP(_size == set._size, "sets must have the same size");
+	if(set._cnt > _cnt)
+		return false;
+	if(_dense && set._dense) {
+		for(int i = 0; i < words(); i++)
+			if(set._bits[i] & ~_bits[i])
+				return false;
+		return true;
+	}
+	if(!set._dense && !_dense) {
+		int i = 0;
+		for(int j = 0; j < set._cnt; j++) {
+			while(i < _cnt && _ids[i] < set._ids[j])
+				i++;
+			if(i == _cnt || _ids[i] != set._ids[j])
+				return false;
+		}
+		return true;
+	}
+	for(Iter i(set); i(); i++)
+		if(!bit(*i))
+			return false;
+	return true;
+}
+
+
+/**
+ * @fn bool IndexSet::includesStrictly(const IndexSet& set) const;
+ * Test if the current set includes strictly the given one.
+ * @param set	Tested set.
+ * @return		True if the current set strictly includes the given one, false else.
+ */
+
+/**
+ * @fn bool IndexSet::equals(const IndexSet& set) const;
+ * Test if both sets contain the same indices, whatever their representation.
+ * @param set	Set to compare with.
+ * @return		True if both sets are equal, false else.
+ */
+
+
+/**
+ * Test if the current set and the given one have common indices.
+ * @param set	Tested set.
+ * @return		True if the intersection is not empty, false else.
+ */
+bool IndexSet::meets(const IndexSet& set) const {
+	ASSERTP(_size == set._size, "sets must have the same size");
+	if(_dense && set._dense) {
+		for(int i = 0; i < words(); i++)
+			if(set._bits[i] & _bits[i])
+				return true;
+		return false;
+	}
+	if(!_dense && !set._dense) {
+		int i = 0, j = 0;
+		while(i < _cnt && j < set._cnt) {
+			if(_ids[i] < set._ids[j])
+				i++;
+			else if(_ids[i] > set._ids[j])
+				j++;
+			else
+				return true;
+		}
+		return false;
+	}
+	const IndexSet& s = _dense ? set : *this, & d = _dense ? *this : set;
+	for(int i = 0; i < s._cnt; i++)
+		if(d.bit(s._ids[i]))
+			return true;
+	return false;
+}
+
+
+/**
+ * Replace the set by its complement.
+ */
+void IndexSet::applyNot(void) {
+	if(!_dense)
+		toDense();
+	for(int i = 0; i < words(); i++)
+		_bits[i] = ~_bits[i];
+	if(_size & 63)
+		_bits[words() - 1] &= (word_t(1) << (_size & 63)) - 1;
+	_cnt = _size - _cnt;
+	if(_cnt < limit() / 2)
+		toSparse();
+}
+
+
+/**
+ * Add the indices of the given set to the current one.
+ * @param set	Set to add.
+ */
+void IndexSet::applyOr(const IndexSet& set) {
+	ASSERTP(_size == set._size, "sets must have the same size");
+	if(set._cnt == 0 || this == &set)
+		return;
+	if(!_dense && !set._dense) {
+		index_t *ids = new index_t[_cnt + set._cnt];
+		int i = 0, j = 0, k = 0;
+		while(i < _cnt && j < set._cnt) {
+			if(_ids[i] < set._ids[j])
+				ids[k++] = _ids[i++];
+			else if(_ids[i] > set._ids[j])
+				ids[k++] = set._ids[j++];
+			else {
+				ids[k++] = _ids[i++];
+				j++;
+			}
+		}
+		while(i < _cnt)
+			ids[k++] = _ids[i++];
+		while(j < set._cnt)
+			ids[k++] = set._ids[j++];
+		delete [] _ids;
+		_ids = ids;
+		_cap = _cnt + set._cnt;
+		_cnt = k;
+		if(_cnt > limit())
+			toDense();
+		return;
+	}
+	if(!_dense)
+		toDense();
+	if(set._dense) {
+		for(int i = 0; i < words(); i++)
+			_bits[i] |= set._bits[i];
+		recount();
+	}
+	else
+		for(int i = 0; i < set._cnt; i++)
+			this->set(set._ids[i]);
+}
+
+
+/**
+ * Remove from the current set the indices not contained in the given one.
+ * @param set	Set to intersect with.
+ */
+void IndexSet::applyAnd(const IndexSet& set) {
+	ASSERTP(_size == set._size, "sets must have the same size");
+	if(this == &set)
+		return;
+	if(_dense && set._dense) {
+		for(int i = 0; i < words(); i++)
+			_bits[i] &= set._bits[i];
+		recount();
+		if(_cnt < limit() / 2)
+			toSparse();
+	}
+	else if(_dense) {
+		index_t *ids = new index_t[set._cnt > 0 ? set._cnt : 1];
+		int k = 0;
+		for(int i = 0; i < set._cnt; i++)
+			if(bit(set._ids[i]))
+				ids[k++] = set._ids[i];
+		release();
+		_ids = ids;
+		_cap = set._cnt > 0 ? set._cnt : 1;
+		_cnt = k;
+	}
+	else {
+		int k = 0;
+		if(set._dense) {
+			for(int i = 0; i < _cnt; i++)
+				if(set.bit(_ids[i]))
+					_ids[k++] = _ids[i];
+		}
+		else
+			for(int i = 0, j = 0; i < _cnt && j < set._cnt; ) {
+				if(_ids[i] < set._ids[j])
+					i++;
+				else if(_ids[i] > set._ids[j])
+					j++;
+				else {
+					_ids[k++] = _ids[i++];
+					j++;
+				}
+			}
+		_cnt = k;
+	}
+}
+
+
+/**
+ * Remove from the current set the indices contained in the given one.
+ * @param set	Set of removed indices.
+ */
+void IndexSet::applyReset(const IndexSet& set) {
+	ASSERTP(_size == set._size, "sets must have the same size");
+	if(this == &set) {
+		clear();
+		return;
+	}
+	if(_dense) {
+		if(set._dense)
+			for(int i = 0; i < words(); i++)
+				_bits[i] &= ~set._bits[i];
+		else
+			for(int i = 0; i < set._cnt; i++)
+				_bits[set._ids[i] >> 6] &= ~(word_t(1) << (set._ids[i] & 63));
+		recount();
+		if(_cnt < limit() / 2)
+			toSparse();
+	}
+	else {
+		int k = 0;
+		if(set._dense) {
+			for(int i = 0; i < _cnt; i++)
+				if(!set.bit(_ids[i]))
+					_ids[k++] = _ids[i];
+		}
+		else
+			for(int i = 0, j = 0; i < _cnt; ) {
+				if(j == set._cnt || _ids[i] < set._ids[j])
+					_ids[k++] = _ids[i++];
+				else if(_ids[i] > set._ids[j])
+					j++;
+				else {
+					i++;
+					j++;
+				}
+			}
+		_cnt = k;
+	}
+}
+
+
+/**
+ * Build a bit vector containing the same indices.
+ * @return	Matching bit vector.
+ */
+BitVector IndexSet::toBitVector(void) const {
+	BitVector r(_size);
+	for(Iter i(*this); i(); i++)
+		r.set(*i);
+	return r;
+}
+
+
+/**
+ * Print the set as a list of indices.
+ * @param out	Output stream.
+ */
+void IndexSet::print(io::Output& out) const {
+	out << '{';
+	bool first = true;
+	for(Iter i(*this); i(); i++) {
+		if(first)
+			first = false;
+		else
+			out << ", ";
+		out << *i;
+	}
+	out << '}';
+}
+
+
+// look for the position of i in the sorted array
+int IndexSet::find(int i) const {
+	int l = 0, h = _cnt;
+	while(l < h) {
+		int m = (l + h) >> 1;
+		if(_ids[m] < index_t(i))
+			l = m + 1;
+		else
+			h = m;
+	}
+	return l;
+}
+
+
+// free the storage
+void IndexSet::release(void) {
+	if(_dense)
+		delete [] _bits;
+	else
+		delete [] _ids;
+	_ids = nullptr;
+	_dense = false;
+	_cap = 0;
+}
+
+
+// switch to the bitmap
+void IndexSet::toDense(void) {
+	word_t *bits = new word_t[words()];
+	memset(bits, 0, words() * sizeof(word_t));
+	for(int i = 0; i < _cnt; i++)
+		bits[_ids[i] >> 6] |= word_t(1) << (_ids[i] & 63);
+	delete [] _ids;
+	_bits = bits;
+	_dense = true;
+	_cap = 0;
+}
+
+
+// switch to the sorted array
+void IndexSet::toSparse(void) {
+	_cap = _cnt < MIN_CAP ? int(MIN_CAP) : _cnt;
+	index_t *ids = new index_t[_cap];
+	int k = 0;
+	for(Iter i(*this); i(); i++)
+		ids[k++] = *i;
+	delete [] _bits;
+	_ids = ids;
+	_dense = false;
+}
+
+
+// recompute the count of a bitmap
+void IndexSet::recount(void) {
+	_cnt = 0;
+	for(int i = 0; i < words(); i++)
+		_cnt += elm::countOnes(_bits[i]);
+}
+
+}	// elm
@@ -19,9 +19,12 @@
  *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <elm/data/quicksort.h>
 #include <elm/data/Vector.h>
 #include <elm/io.h>
 #include <elm/io/ansi.h>
+#include <elm/json.h>
+#include <elm/perf/Clock.h>
 #include <elm/test.h>
 
 namespace elm {
@@ -377,6 +380,11 @@ void TestSet::perform(void) {
  * Execute the test as an application. argv is looked for tests to perform
  * and, if empty, run all tests and display statistics. It may called from main()
  * or by the macro @ TEST_MAIN.
+ *
+ * The following options are also supported:
+ * @li --bench -- when no name is given, run all benchmarks (@ref Benchmark)
+ * instead of all test cases,
+ * @li --json PATH -- save the benchmark results in JSON to the given path.
  * @param argc	argc as passed to main.
  * @param argv	argv as passed to main.
  * @return		Error code to return from main.
@@ -394,9 +402,25 @@ int TestSet::run(int argc, const char **argv) {
 
 	// process the tests
 	Vector<TestCase *> tests;
+	bool bench = false;
+	cstring json;
 	for(int i = 1; i < argc; i++) {
 		bool found = false;
 
+		// benchmark options
+		if(string("--bench") == argv[i]) {
+			bench = true;
+			continue;
+		}
+		else if(string("--json") == argv[i]) {
+			if(i + 1 >= argc) {
+				cerr << io::RED << io::BOLD << "ERROR:" << io::PLAIN << " --json requires a file path\n";
+				return 1;
+			}
+			json = argv[++i];
+			continue;
+		}
+
 		// look in the structure
 		for(TestSet::Iterator test(TestSet::def); test(); test++)
 			if(test->name() == argv[i]) {
@@ -412,10 +436,11 @@ int TestSet::run(int argc, const char **argv) {
 		}
 	}
 
-	// if none selected, test all
+	// if none selected, test all (or benchmark all)
 	if(!tests)
 		for(TestSet::Iterator test(TestSet::def); test(); test++)
-			tests.add(*test);
+			if(test->isBenchmark() == bench)
+				tests.add(*test);
 
 	// perform tests
 	bool failed = false;
@@ -431,6 +456,27 @@ int TestSet::run(int argc, const char **argv) {
 			failed = true;
 	}
 
+	// save benchmark results
+	if(json) {
+		sys::Path path = json;
+		try {
+			json::Saver saver(path);
+			saver.beginMap();
+			saver.key(cstring("benchmarks"));
+			saver.beginList();
+			for(auto test: tests)
+				if(test->isBenchmark())
+					static_cast<Benchmark *>(test)->save(saver);
+			saver.endList();
+			saver.endMap();
+			saver.close();
+		}
+		catch(Exception& e) {
+			cerr << io::BOLD << io::RED << "ERROR: " << io::PLAIN << e.message() << io::endl;
+			return 2;
+		}
+	}
+
 	// display summary
 	cout.flush();
 	if(!failed) {
@@ -466,4 +512,288 @@ void TestSet::add(TestCase *tcase) {
 	cases.add(tcase);
 }
 
+
+
+/**
+ * @class Benchmark
+ * A benchmark is a test case dedicated to measure performances. It is declared
+ * with @ref BENCH_BEGIN and @ref BENCH_END and each measured piece of code
+ * is introduced by @ref BENCH:
+ * @code
+ * 	BENCH_BEGIN(vector)
+ * 		Vector<int> v;
+ * 		BENCH("add") {
+ * 			v.add(111);
+ * 			Benchmark::clobberMemory();
+ * 		}
+ * 	BENCH_END
+ * @endcode
+ *
+ * The body of @ref BENCH is executed by batches whose size is calibrated
+ * to last about @ref SAMPLE_TIME ns. Then @ref WARMUP batches are
+ * discarded and @ref SAMPLES batches are measured (or less if the benchmark
+ * takes more than @ref MAX_TIME ns). For each benchmark, the median, the
+ * 99th percentile and the median absolute deviation (MAD) of the time of one
+ * iteration are displayed and recorded in @ref results().
+ *
+ * Benchmarks are recorded in @ref TestSet::def like other test cases but
+ * are only performed when they are explicitly named on the command line or
+ * when option --bench is passed. With option --json, the results are saved
+ * in JSON format to be compared between runs.
+ *
+ * @ingroup test
+ */
+
+
+/**
+ * @def BENCH_BEGIN(name)
+ * Begin the declaration of a benchmark set (see @ref elm::Benchmark).
+ * @param name	Name of the benchmark (unquoted).
+ * @ingroup test
+ */
+
+
+/**
+ * @def BENCH(label)
+ * Introduce a measured statement in a benchmark (see @ref elm::Benchmark).
+ * @param label	Label of the benchmark (C string).
+ * @ingroup test
+ */
+
+
+/**
+ * @def BENCH_END
+ * End the declaration of a benchmark set (see @ref elm::Benchmark).
+ * @ingroup test
+ */
+
+
+/**
+ * @typedef Benchmark::result_t
+ * Result of a benchmark. Times are in nanoseconds per iteration.
+ */
+
+
+/**
+ * Build a benchmark.
+ * @param name	Benchmark name.
+ */
+Benchmark::Benchmark(cstring name): TestCase(name) {
+}
+
+
+/**
+ * @fn const List<result_t>& Benchmark::results(void) const;
+ * Get the results of the last run of the benchmark.
+ * @return	Benchmark results.
+ */
+
+
+/**
+ */
+void Benchmark::prepare(void) {
+	_results.clear();
+#if defined(__unix) || defined(__APPLE__)
+	cout << "\x1b[1;4mBENCHMARK: " << name() << "\x1b[0m" << io::endl;
+#elif defined(__WIN32) || defined(__WIN64)
+	cout << "BENCHMARK: " << name() << io::endl;
+#endif
+	cout << io::fmt("label").width(24)
+		 << io::fmt("median").right().width(14)
+		 << io::fmt("p99").right().width(14)
+		 << io::fmt("MAD").right().width(14)
+		 << io::fmt("iterations").right().width(14) << io::endl;
+}
+
+
+/**
+ */
+void Benchmark::complete(void) {
+	if(hasFailed())
+		TestCase::complete();
+}
+
+
+/**
+ * Save the results of the benchmark in JSON.
+ * @param saver		Saver to use.
+ */
+void Benchmark::save(json::Saver& saver) const {
+	for(const auto& r: _results) {
+		saver.beginMap();
+		saver.key(cstring("suite"));
+		saver.put(name());
+		saver.key(cstring("name"));
+		saver.put(r.label);
+		saver.key(cstring("iterations"));
+		saver.put(r.iterations);
+		saver.key(cstring("samples"));
+		saver.put(r.samples);
+		saver.key(cstring("median_ns"));
+		saver.put(r.median);
+		saver.key(cstring("p99_ns"));
+		saver.put(r.p99);
+		saver.key(cstring("mad_ns"));
+		saver.put(r.mad);
+		saver.key(cstring("mean_ns"));
+		saver.put(r.mean);
+		saver.key(cstring("min_ns"));
+		saver.put(r.min);
+		saver.endMap();
+	}
+}
+
+
+/**
+ * @fn void Benchmark::doNotOptimize(const T& x);
+ * Prevent the compiler to optimize away the computation of x.
+ * @param x		Value to keep.
+ */
+
+
+/**
+ * @fn void Benchmark::clobberMemory(void);
+ * Force the compiler to consider that all memory may have been read or
+ * written: pending stores must be performed.
+ */
+
+
+/**
+ * Used as an opaque sink on compilers not supporting GCC inline assembly.
+ */
+static const void * volatile bench_sink;
+void Benchmark::sink(const void *p) {
+	bench_sink = p;
+}
+
+
+/**
+ * @class Benchmark::Run
+ * Control of the loop of @ref BENCH. It runs the calibration, warm-up and
+ * sampling phases and records the result in the benchmark.
+ */
+
+
+// run states
+typedef enum {
+	RUN_INIT,
+	RUN_CALIBRATE,
+	RUN_WARMUP,
+	RUN_SAMPLE
+} run_state_t;
+
+
+/**
+ * Build a run.
+ * @param bench		Owner benchmark.
+ * @param label		Label of the run.
+ */
+Benchmark::Run::Run(Benchmark& bench, cstring label):
+	_bench(bench),
+	_label(label),
+	_left(0),
+	_batch(1),
+	_start(0),
+	_total(0),
+	_iters(0),
+	_state(RUN_INIT),
+	_count(0),
+	_n(0)
+{ }
+
+
+/**
+ * @fn bool Benchmark::Run::operator()(void);
+ * Test if a new iteration has to be performed.
+ * @return	True to perform a new iteration, false to stop.
+ */
+
+
+/**
+ * Called at the end of a batch.
+ * @return	True if a new batch has to be started, false else.
+ */
+bool Benchmark::Run::next(void) {
+	t::uint64 d = perf::Clock::now() - _start;
+	switch(_state) {
+
+	case RUN_INIT:
+		_state = RUN_CALIBRATE;
+		break;
+
+	case RUN_CALIBRATE:
+		if(d >= SAMPLE_TIME / 2 || _batch >= (t::uint64(1) << 40)) {
+			if(d != 0)
+				_batch = max(t::uint64(1), _batch * SAMPLE_TIME / d);
+			_state = RUN_WARMUP;
+			_count = WARMUP;
+		}
+		else if(d <= SAMPLE_TIME / 100)
+			_batch *= 10;
+		else
+			_batch = _batch * SAMPLE_TIME / d;
+		break;
+
+	case RUN_WARMUP:
+		if(--_count == 0)
+			_state = RUN_SAMPLE;
+		break;
+
+	case RUN_SAMPLE:
+		_samples[_n++] = double(d) / _batch;
+		_total += d;
+		_iters += _batch;
+		if(_n >= SAMPLES || (_total >= MAX_TIME && _n >= MIN_SAMPLES)) {
+			finish();
+			return false;
+		}
+		break;
+	}
+
+	_left = _batch - 1;
+	_start = perf::Clock::now();
+	return true;
+}
+
+
+// compute the quantile of a sorted vector
+static double quantile(const Vector<double>& v, double p) {
+	int i = int(p * (v.count() - 1) + .5);
+	return v[i];
+}
+
+
+/**
+ * Compute the statistics, display and record them.
+ */
+void Benchmark::Run::finish(void) {
+	result_t r;
+	r.label = _label;
+	r.iterations = _iters;
+	r.samples = _n;
+	Vector<double> samples(_n);
+	r.mean = 0;
+	for(int i = 0; i < _n; i++) {
+		samples.add(_samples[i]);
+		r.mean += _samples[i];
+	}
+	r.mean /= _n;
+	quicksort(samples);
+	r.min = samples[0];
+	r.median = quantile(samples, .5);
+	r.p99 = quantile(samples, .99);
+	Vector<double> devs(_n);
+	for(auto x: samples)
+		devs.add(x >= r.median ? x - r.median : r.median - x);
+	quicksort(devs);
+	r.mad = quantile(devs, .5);
+	_bench._results.addLast(r);
+
+	cout << io::fmt(_label).width(24)
+		 << io::fmt(r.median).decimal().width(11, 1).right() << " ns"
+		 << io::fmt(r.p99).decimal().width(11, 1).right() << " ns"
+		 << io::fmt(r.mad).decimal().width(11, 1).right() << " ns"
+		 << io::fmt(_iters).right().width(14) << io::endl;
+}
+
 } //elm
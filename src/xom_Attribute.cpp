@@ -149,10 +149,14 @@ Node *Attribute::copy(void) {
 
 
 /**
+ * Get the value of the attribute. For an attribute of an element, the
+ * returned string is a copy that remains valid after the document is deleted
+ * and that may be fried by the caller.
+ * @return	Attribute value.
  */
 String Attribute::getValue(void) {
-	if(!val)
-		val = internGetValue(); 
+	if(node)
+		return internGetValue();
 	return val.toCString().chars();
 }
 
@@ -70,6 +70,7 @@ Node *Comment::copy(void) {
  * @param data	Text to put in.
  */
 void Comment::setValue(String data) {
+	modified(node);
 	xmlNodeSetContent(NODE(node), data);
 }
 
@@ -25,6 +25,7 @@
 #include <elm/xom/Document.h>
 #include <elm/xom/Element.h>
 #include <elm/xom/NodeFactory.h>
+#include <string.h>
 
 #define NODE(p) ((xmlNodePtr)(p))
 #define DOC(p) ((xmlDocPtr)(p))
@@ -34,6 +35,13 @@ namespace elm { namespace xom {
 /**
  * @class Document Document.h "elm/xom.h"
  * The root object of an XML document.
+ *
+ * The document owns the wrappers of its nodes built by the document itself:
+ * they are allocated lazily in an arena of the document and deleted with
+ * the document. The wrappers created by the user, or detached from the document,
+ * are owned by the user (see @ref Node). The strings returned by the zero-copy
+ * accessors, like @ref Node::getValueView(), are also stored in the document
+ * (see store()).
  * @ingroup xom
  */
 
@@ -43,13 +51,13 @@ namespace elm { namespace xom {
  * @param node	Parser node.
  */
 Document::Document(void *node, NodeFactory *factory)
-: ParentNode(node), fact(factory) {
+: ParentNode(node), fact(factory), _arena(new Arena()) {
 	ASSERT(DOC(node)->type == XML_DOCUMENT_NODE);
 	ASSERT(fact);
 }
 
 
-Document::Document(Document *document): ParentNode(0) {
+Document::Document(Document *document): ParentNode(0), fact(nullptr), _arena(new Arena()) {
 	ASSERTP(0, "unsupported");
 }
 
@@ -61,7 +69,8 @@ Document::Document(Document *document): ParentNode(0) {
  */
 Document::Document(Element *root_element):
 	ParentNode(xmlNewDoc(BAD_CAST "1.0")),
-	fact(&NodeFactory::default_factory)
+	fact(&NodeFactory::default_factory),
+	_arena(new Arena())
 {
 	ASSERTP(root_element, "null root element");
 	ASSERTP(!NODE(root_element->getNode())->parent, "root already has a parent");
@@ -70,9 +79,62 @@ Document::Document(Element *root_element):
 
 
 /**
+ * The wrappers owned by the document are deleted. The wrappers owned
+ * by the user are unlinked from their node and the user has still to delete them.
+ * The arena is released when the wrappers detached from the document
+ * are also deleted.
  */
 Document::~Document(void) {
+	release(node, true);
 	xmlFreeDoc(DOC(node));
+	node = 0;
+	_arena->alive = false;
+	if(_arena->refs == 0)
+		delete _arena;
+}
+
+
+/**
+ */
+Document::Arena::~Arena(void) {
+	while(bigs) {
+		void *next = *static_cast<void **>(bigs);
+		delete [] static_cast<char *>(bigs);
+		bigs = next;
+	}
+}
+
+
+/**
+ * Store a copy of the given string in the arena.
+ * @param str	String to store.
+ * @return		Stored string.
+ */
+String Document::Arena::store(const char_t *str) {
+	t::size size = strlen((const char *)str) + 1;
+	char *buf;
+	if(size <= SIZE / 4)
+		buf = static_cast<char *>(alloc.allocate((size + sizeof(void *) - 1) & ~(sizeof(void *) - 1)));
+	else {
+		char *block = new char[sizeof(void *) + size];
+		*reinterpret_cast<void **>(block) = bigs;
+		bigs = block;
+		buf = block + sizeof(void *);
+	}
+	memcpy(buf, str, size);
+	return buf;
+}
+
+
+/**
+ * Store a copy of the given string in the document: the copy lives as long
+ * as the document and does not need to be fried.
+ * @param str	String to store.
+ * @return		Stored string.
+ */
+String Document::store(const char_t *str) {
+	sys::Guard<sys::Mutex> guard(cacheLock());
+	return _arena->store(str);
 }
 
 Node *Document::copy(void) {
@@ -138,6 +200,8 @@ void Document::setBaseURI(String uri) {
 
 void Document::setRootElement(Element *root) {
 	ASSERTP(root, "null root");
+	modified(node);
+	modified(NODE(root->getNode())->parent);
 	xmlDocSetRootElement(DOC(node), NODE(root->getNode()));
 }
 
@@ -138,6 +138,7 @@ void Element::addAttribute(Attribute *attribute) {
 	ASSERTP(!attribute->getNode(), "already added attribute");
 	xmlAttrPtr attr;
 	// !!TODO!! add support for namespace
+	modified(node);
 	attr = xmlSetProp(NODE(node), attribute->getLocalName(), attribute->getValue());
 	ASSERT(attr);
 	attribute->setNode(attr);
@@ -173,6 +174,7 @@ void Element::addNamespaceDeclaration(String prefix, String uri) {
  * @throw IllegalAddException if this node cannot have children of this type.
  */
 void Element::appendChild(String text) {
+	modified(node);
 	xmlNodeAddContent(NODE(node), text);
 }
 
@@ -289,6 +291,39 @@ Option<String> Element::getAttributeValue(String localName, String ns) {
 }
 
 
+/**
+ * Same as getAttributeValue(String) but the returned string is not a copy:
+ * it is owned by the document, must not be fried and is only valid while the
+ * document exists (see @ref Node::getValueView()).
+ * @param name	Name of the attribute.
+ * @return		Attribute value or none.
+ */
+Option<String> Element::getAttributeView(String name) {
+	xmlAttr *attr = xmlHasProp(NODE(node), name);
+	if(!attr)
+		return none;
+	else
+		return some(view(attr));
+}
+
+
+/**
+ * Same as getAttributeValue(String, String) but the returned string is not a copy:
+ * it is owned by the document, must not be fried and is only valid while the
+ * document exists (see @ref Node::getValueView()).
+ * @param localName	Local name of the attribute.
+ * @param ns		Namespace of the attribute.
+ * @return			Attribute value or none.
+ */
+Option<String> Element::getAttributeView(String localName, String ns) {
+	xmlAttr *attr = xmlHasNsProp(NODE(node), localName, ns);
+	if(!attr)
+		return none;
+	else
+		return some(view(attr));
+}
+
+
 /**
  * Returns a list of all the child elements of this element in document order.
  * @return a comatose list containing all child elements of this element.
@@ -297,7 +332,7 @@ Elements *Element::getChildElements(void) {
 	Elements *elems = new Elements();
 	for(xmlNodePtr cur = NODE(node)->children; cur; cur = cur->next)
 		if(cur->type == XML_ELEMENT_NODE)
-			elems->elems.add((Element *)make(cur));
+			elems->elems.add((Element *)get(cur));
 	return elems;
 }
 
@@ -314,7 +349,7 @@ Elements *Element::getChildElements(String name) {
 	for(xmlNodePtr cur = NODE(node)->children; cur; cur = cur->next)
 		if(cur->type == XML_ELEMENT_NODE
 		&& name == String(cur->name))
-			elems->elems.add((Element *)make(cur));
+			elems->elems.add((Element *)get(cur));
 	return elems;
 }
 
@@ -336,7 +371,7 @@ Elements *Element::getChildElements(String localName, String ns) {
 		if(cur->type == XML_ELEMENT_NODE
 		&& localName == String(cur->name)
 		&& ns == String(cur->ns->href))
-			elems->elems.add((Element *)make(cur));
+			elems->elems.add((Element *)get(cur));
 	return elems;
 }
 
@@ -352,7 +387,7 @@ Element	*Element::getFirstChildElement(String name) {
 	for(xmlNodePtr cur = NODE(node)->children; cur; cur = cur->next)
 		if(cur->type == XML_ELEMENT_NODE
 		&& name == String(cur->name))
-			return (Element *)make(cur);
+			return (Element *)get(cur);
 	return 0;
 }
 
@@ -370,7 +405,7 @@ Element	*Element::getFirstChildElement(String localName, String ns) {
 		if(cur->type == XML_ELEMENT_NODE
 		&& localName == String(cur->name)
 		&& ns == String(cur->ns->href))
-			return (Element *)make(cur);
+			return (Element *)get(cur);
 	return 0;
 }
 
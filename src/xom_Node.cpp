@@ -51,7 +51,15 @@ namespace elm { namespace xom {
  * not need to be fried. Read carefully the documentation to avoid memory leaks.
  * @li as the method getValue() may in some cases build a new string,
  * @ref elm::xom::Text provides a more efficient method, getText(), to get its
- * content without need of memory management.
+ * content without need of memory management. More generally, getValueView()
+ * and @ref elm::xom::Element::getAttributeView() return strings that are
+ * owned by the document and must not be fried.
+ * @li the wrappers of the nodes of a parsed document are built lazily, on the
+ * first access, and allocated in an arena of the document: they are owned
+ * by the document and released with it. A wrapper detached from the document
+ * (detach(), removeChild(), replaceChild()) is owned by the user that has
+ * to delete it, even after the document is deleted. The wrappers created by
+ * the user remain owned by the user, even when they are added to a document.
  *
  * @internal XOM module is implemented on top of C library libxml2. As a
  * consequence, the used texts are encoded in UTF-8.
@@ -89,11 +97,182 @@ public:
  */
 
 
+// header of the wrapper blocks
+typedef struct header_t {
+	void *arena;		// owner arena or null for the heap
+	t::intptr flags;
+} header_t;
+static const t::intptr
+	OWNED = 1,			// wrapper owned by the document
+	ESCAPED = 2;		// arena wrapper owned by the user
+static inline header_t *header(const Node *node)
+	{ return reinterpret_cast<header_t *>(const_cast<Node *>(node)) - 1; }
+
+
+/**
+ * Lock of the lazy caches of the XML trees: the wrappers, the child arrays
+ * and the composed values.
+ * @return	Cache lock.
+ */
+sys::Mutex& cacheLock(void) {
+	static sys::Mutex mutex;
+	return mutex;
+}
+
+
+/**
+ * Record a modification of the given node: its cached child array is
+ * invalidated and the composed values of its document are out-dated.
+ * @param node	Modified libxml node (may be null).
+ * @param deep	If true, the child arrays of the whole sub-tree are invalidated.
+ */
+void Node::modified(void *node, bool deep) {
+	xmlNodePtr n = NODE(node);
+	if(!n)
+		return;
+	if(n->doc && n->doc->_private)
+		static_cast<Document *>(static_cast<Node *>(n->doc->_private))->_arena->stamp++;
+	if(n->type != XML_ELEMENT_NODE && n->type != XML_DOCUMENT_NODE)
+		return;
+	if(n->_private)
+		static_cast<ParentNode *>(static_cast<Node *>(n->_private))->invalidate();
+	if(deep)
+		for(xmlNodePtr cur = n->children; cur; cur = cur->next)
+			modified(cur, true);
+}
+
+
+/**
+ * Allocate a node wrapper in the heap.
+ * @param size	Size of the wrapper.
+ * @return		Allocated block.
+ */
+void *Node::operator new(std::size_t size) {
+	header_t *h = static_cast<header_t *>(::operator new(size + sizeof(header_t)));
+	h->arena = nullptr;
+	h->flags = 0;
+	return h + 1;
+}
+
+
+/**
+ * Allocate a node wrapper in the arena of the given document.
+ * The memory of the wrapper is released with the document.
+ * @param size	Size of the wrapper.
+ * @param doc	Owner document (if null, the wrapper is allocated in the heap).
+ * @return		Allocated block.
+ */
+void *Node::operator new(std::size_t size, Document *doc) {
+	if(doc == nullptr)
+		return operator new(size);
+	size = (size + sizeof(header_t) + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+	header_t *h = static_cast<header_t *>(doc->_arena->alloc.allocate(size));
+	h->arena = doc->_arena;
+	h->flags = 0;
+	return h + 1;
+}
+
+
+/**
+ * Release a node wrapper. The memory of a wrapper allocated in a document
+ * arena is only released with the arena, that is, when the document
+ * and the wrappers detached from it are deleted.
+ * @param block	Block to release.
+ */
+void Node::operator delete(void *block) {
+	header_t *h = static_cast<header_t *>(block) - 1;
+	if(!h->arena)
+		::operator delete(h);
+	else if(h->flags & ESCAPED) {
+		Document::Arena *arena = static_cast<Document::Arena *>(h->arena);
+		h->flags &= ~ESCAPED;
+		arena->refs--;
+		if(!arena->alive && arena->refs == 0)
+			delete arena;
+	}
+}
+
+
+/**
+ */
+void Node::operator delete(void *block, Document *doc) {
+	operator delete(block);
+}
+
+
+/**
+ * Test if the given wrapper is allocated in a document arena.
+ * @param node	Node wrapper.
+ * @return		True if it is allocated in an arena, false if it is allocated in the heap.
+ */
+bool Node::inArena(const Node *node) {
+	return header(node)->arena != nullptr;
+}
+
+
+/**
+ * Transfer the ownership of the wrapper from its document to the user.
+ * This happens when the node is detached from the tree: the user becomes
+ * responsible for deleting it and, if the wrapper is allocated in the arena,
+ * the arena is kept alive until the wrapper is deleted.
+ */
+void Node::disown(void) {
+	header_t *h = header(this);
+	if(!(h->flags & OWNED))
+		return;
+	h->flags &= ~OWNED;
+	if(h->arena) {
+		h->flags |= ESCAPED;
+		static_cast<Document::Arena *>(h->arena)->refs++;
+	}
+}
+
+
+/**
+ * Release the wrappers of the descendants of a node. The wrappers owned
+ * by the document are deleted, the other ones are left to the user.
+ * @param node			Root libxml node.
+ * @param disconnect	If true, the wrappers left to the user are also unlinked
+ * 						from their node (that is going to be freed).
+ */
+void Node::release(void *node, bool disconnect) {
+	xmlNodePtr n = NODE(node);
+	if(n->type != XML_ELEMENT_NODE && n->type != XML_DOCUMENT_NODE)
+		return;
+	for(xmlNodePtr cur = n->children; cur; cur = cur->next)
+		release(cur, disconnect);
+	if(n->type == XML_ELEMENT_NODE)
+		for(xmlAttrPtr attr = n->properties; attr; attr = attr->next)
+			drop(attr, disconnect);
+	for(xmlNodePtr cur = n->children; cur; cur = cur->next)
+		drop(cur, disconnect);
+}
+
+
+/**
+ * Release the wrapper of a node (if any) as in release().
+ * @param node			Libxml node.
+ * @param disconnect	If true, a wrapper left to the user is unlinked from the node.
+ */
+void Node::drop(void *node, bool disconnect) {
+	Node *w = static_cast<Node *>(NODE(node)->_private);
+	if(!w)
+		return;
+	if(header(w)->flags & OWNED)
+		delete w;
+	else if(disconnect) {
+		NODE(node)->_private = 0;
+		w->node = 0;
+	}
+}
+
+
 /**
  * Free a tree of nodes.
  */
 void Node::freeNode(void *_node) {
 	xmlNodePtr node = NODE(_node);
+	modified(node->parent);
 	if(node->_private)
 		delete (Node *)node->_private;
 	else {
@@ -109,8 +288,16 @@ void Node::freeNode(void *_node) {
 
 
 /**
+ * When a detached wrapper is deleted, the wrappers of its descendants
+ * owned by the document are also deleted.
  */
 Node::~Node(void) {
+	if(node) {
+		if(NODE(node)->_private == this)
+			NODE(node)->_private = 0;
+		if(!NODE(node)->parent)
+			release(node, false);
+	}
 }
 
 
@@ -141,7 +328,11 @@ Node::Node(void *_node): node(0) {
  * @return		Matching XOM node if any.
  */
 Node *Node::make(void *node) {
-	NodeFactory *fact = (((Document *)(NODE(node)->doc->_private)))->fact;
+	sys::Guard<sys::Mutex> guard(cacheLock());
+	if(NODE(node)->_private)
+		return (Node *)NODE(node)->_private;
+	Document *doc = (Document *)(NODE(node)->doc->_private);
+	NodeFactory *fact = doc->fact;
 	Node *result;
 	switch(NODE(node)->type) {
 	case XML_ELEMENT_NODE:
@@ -151,15 +342,16 @@ Node *Node::make(void *node) {
 		result = fact->makeText(node);
 		break;
 	case XML_ATTRIBUTE_NODE:
-		result = new Attribute(node);
+		result = new(doc) Attribute(node);
 		break;
 	case XML_COMMENT_NODE:
 		result = fact->makeComment(node);
 		break;
 	default:
-		result = new UnsupportedNode(node);
+		result = new(doc) UnsupportedNode(node);
 		break;
 	}
+	header(result)->flags |= OWNED;
 	NODE(node)->_private = result;
 	return result;
 }
@@ -205,7 +397,7 @@ Node::kind_t Node::kind(void) const {
  * @return	Parent node.
  */
 ParentNode *Node::getParent(void) {
-	return (ParentNode *)make(NODE(node)->parent);
+	return (ParentNode *)get(NODE(node)->parent);
 }
 
 
@@ -228,6 +420,9 @@ String Node::internGetValue(void) {
  * Detach the current node from its parent.
  */
 void Node::detach(void) {
+	modified(NODE(node)->parent);
+	if(NODE(node)->parent)
+		disown();
 	xmlUnlinkNode(NODE(node));
 }
 
@@ -426,4 +621,61 @@ int Node::line(void) const {
 }
 
 
+/**
+ * Get the value of the node without copy. For a text, a comment or
+ * an attribute made of a single text, the returned string is the one stored
+ * in the XML tree. For an element with a single text child, the text of this
+ * child is returned. Else the value is built once and stored in the arena of the
+ * document: it is built again only if the document is modified.
+ *
+ * In all cases, the returned string is owned by the document: it must not
+ * be fried and is only valid while the document exists. If the node does not
+ * belong to a document, the composed value is allocated as with getValue().
+ *
+ * @return	Node value.
+ */
+String Node::getValueView(void) {
+	return view(node);
+}
+
+
+/**
+ * Implementation of getValueView() working on libxml nodes.
+ * @param node	Libxml node.
+ * @return		Node value.
+ */
+String Node::view(void *node) {
+	xmlNodePtr n = NODE(node);
+	switch(n->type) {
+	case XML_TEXT_NODE:
+	case XML_CDATA_SECTION_NODE:
+	case XML_COMMENT_NODE:
+	case XML_PI_NODE:
+		return n->content ? String(n->content) : String("");
+	case XML_ATTRIBUTE_DECL:
+		return ((xmlAttributePtr)n)->defaultValue;
+	default:
+		break;
+	}
+	if(!n->children)
+		return "";
+	if(!n->children->next && n->children->type == XML_TEXT_NODE)
+		return n->children->content;
+	if(!n->doc || !n->doc->_private)
+		return xmlNodeGetContent(n);
+
+	// composed values are cached until the document is modified
+	Document::Arena *arena = static_cast<Document *>(static_cast<Node *>(n->doc->_private))->_arena;
+	sys::Guard<sys::Mutex> guard(cacheLock());
+	Option<Document::Arena::view_t> v = arena->views.get(n);
+	if(v && (*v).stamp == arena->stamp)
+		return (*v).str;
+	xmlChar *content = xmlNodeGetContent(n);
+	Document::Arena::view_t nv = { arena->stamp, arena->store(content) };
+	xmlFree(content);
+	arena->views.put(n, nv);
+	return nv.str;
+}
+
+
 } } // elm::xom
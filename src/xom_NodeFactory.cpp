@@ -50,6 +50,10 @@ namespace elm { namespace xom {
  * Nor should it return a list containing an element, because an element cannot appear
  * in a document prolog. However, it could return a list containing any number of comments
  * and processing instructions, and not more than one DocType object.
+ *
+ * The default implementation allocates the nodes in the arena of their document
+ * with <code>new(document) Element(node)</code>: subclasses are advised to do the same
+ * to avoid a heap allocation per node.
  * @ingroup xom
  */
 
@@ -59,6 +63,13 @@ namespace elm { namespace xom {
 NodeFactory NodeFactory::default_factory;
 
 
+// get the document owning a libxml node
+static inline Document *owner(void *node) {
+	xmlDocPtr doc = static_cast<xmlNodePtr>(node)->doc;
+	return doc ? static_cast<Document *>(doc->_private) : nullptr;
+}
+
+
 /**
  * Build an attribute from an XML node.
  * @param node	XML node.
@@ -76,7 +87,7 @@ Attribute *NodeFactory::makeAttribute(void *node) {
  * @return		Built comment.
  */
 Comment *NodeFactory::makeComment(void *node) {
-	return new Comment(node);
+	return new(owner(node)) Comment(node);
 }
 
 
@@ -105,7 +116,7 @@ ProcessingInstruction *NodeFactory::makeProcessingInstruction(void *node) {
  * @param node	Low-level node reference.
  */
 Element	*NodeFactory::makeElement(void *node) {
-	return new Element(node);
+	return new(owner(node)) Element(node);
 }
 
 
@@ -114,7 +125,7 @@ Element	*NodeFactory::makeElement(void *node) {
  * @param node	Low-level node reference.
  */
 Text *NodeFactory::makeText(void *node) {
-	return new Text(node);
+	return new(owner(node)) Text(node);
 }
 
 
@@ -40,6 +40,58 @@ namespace elm { namespace xom {
  */
 
 
+// array of the children of a parent node
+class ParentNode::Children {
+public:
+	inline Children(int n): count(n), nodes(new void *[n]) { }
+	inline ~Children(void) { delete [] nodes; }
+	int count;
+	void **nodes;
+};
+
+
+/**
+ */
+ParentNode::~ParentNode(void) {
+	delete kids.load(std::memory_order_relaxed);
+}
+
+
+/**
+ * Get the array of children, building it if the children have been
+ * modified since the last call. The array is built under the cache lock
+ * and published atomically so that concurrent readers are safe.
+ * @return	Array of children (libxml nodes).
+ */
+ParentNode::Children *ParentNode::children(void) {
+	Children *k = kids.load(std::memory_order_acquire);
+	if(k == nullptr) {
+		sys::Guard<sys::Mutex> guard(cacheLock());
+		k = kids.load(std::memory_order_relaxed);
+		if(k == nullptr) {
+			int n = 0;
+			for(xmlNodePtr cur = NODE(node)->children; cur; cur = cur->next)
+				n++;
+			k = new Children(n);
+			int i = 0;
+			for(xmlNodePtr cur = NODE(node)->children; cur; cur = cur->next)
+				k->nodes[i++] = cur;
+			kids.store(k, std::memory_order_release);
+		}
+	}
+	return k;
+}
+
+
+/**
+ * Invalidate the array of children after a modification of the children.
+ * Must not be called while the node is read by another thread.
+ */
+void ParentNode::invalidate(void) {
+	delete kids.exchange(nullptr, std::memory_order_relaxed);
+}
+
+
 /**
  * Appends a node to the children of this node.
  * @param child		node to append to this node
@@ -50,7 +102,9 @@ void ParentNode::appendChild(Node *child) {
 	ASSERTP(!NODE(child->getNode())->parent, "node with multiple parent is forbidden");
 	xmlNode *cnode = NODE(child->getNode()), *pnode = NODE(node);
 
+	modified(node);
 	if(cnode->doc && cnode->doc != pnode->doc) {
+		ASSERTP(!inArena(child), "node allocated in another document cannot be moved");
 		xmlNodePtr old = cnode;
 		cnode = xmlDocCopyNode(cnode, pnode->doc, 1);
 		child->setNode(cnode);
@@ -61,16 +115,15 @@ void ParentNode::appendChild(Node *child) {
 
 
 /**
- * Get the child node at the given position.
+ * Get the child node at the given position. The children are cached in an
+ * array, rebuilt only when they are modified, making the indexed access in O(1).
  * @param position	Position of the looked child.
  * @return			Child at the given position.
  */
 Node *ParentNode::getChild(int position) {
-	xmlNodePtr cur = NODE(node)->children;
-	for(int i = 0; i < position; i++, cur = cur->next)
-		ASSERTP(cur, "position out of bounds");
-	ASSERTP(cur, "position out of bounds");
-	return Node::make(cur);
+	Children *k = children();
+	ASSERTP(0 <= position && position < k->count, "position out of bounds");
+	return get(k->nodes[position]);
 }
 
 
@@ -79,10 +132,7 @@ Node *ParentNode::getChild(int position) {
  * @return	Children count.
  */
 int	ParentNode::getChildCount(void) {
-	int cnt = 0;
-	for(xmlNodePtr cur = NODE(node)->children; cur; cur = cur->next)
-		cnt++;
-	return cnt;
+	return children()->count;
 }
 
 
@@ -97,10 +147,10 @@ int	ParentNode::getChildCount(void) {
  * @return the position of the argument node among the children of this node
  */
 int	ParentNode::indexOf(Node *child) {
-	int cnt = 0;
-	for(xmlNodePtr cur = NODE(node)->children; cur; cur = cur->next, cnt++)
-		if(cur != NODE(child->getNode()))
-			return cnt;
+	Children *k = children();
+	for(int i = 0; i < k->count; i++)
+		if(k->nodes[i] == child->getNode())
+			return i;
 	return -1;
 }
 
@@ -124,6 +174,8 @@ int	ParentNode::indexOf(Node *child) {
 void ParentNode::insertChild(Node *child, int position) {
 	ASSERTP(child, "null node");
 	ASSERTP(position >= 0, "position must be positive");
+	modified(NODE(child->getNode())->parent);
+	modified(node);
 	if(position == 0) {
 		if(!NODE(node)->children)
 			xmlAddChild(NODE(node), NODE(child->getNode()));
@@ -159,6 +211,8 @@ Node *ParentNode::removeChild(int position) {
  * @return the node which was removed.
  */
 Node *ParentNode::removeChild(Node *child) {
+	modified(node);
+	child->disown();
 	xmlUnlinkNode(NODE(child->getNode()));
 	return child;
 }
@@ -174,6 +228,9 @@ Node *ParentNode::removeChild(Node *child) {
  * newChild.
  */
 void ParentNode::replaceChild(Node *old_child, Node *new_child) {
+	modified(node);
+	modified(NODE(new_child->getNode())->parent);
+	old_child->disown();
 	xmlReplaceNode(NODE(old_child->getNode()), NODE(new_child->getNode()));
 }
 
@@ -0,0 +1,393 @@
+/*
+ *	xom::Reader class implementation
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <libxml/xmlreader.h>
+#include <elm/assert.h>
+#include <elm/io/IOException.h>
+#include <elm/xom/Document.h>
+#include <elm/xom/NodeFactory.h>
+#include <elm/xom/Reader.h>
+
+#define READER(p)	((xmlTextReaderPtr)(p))
+
+namespace elm { namespace xom {
+
+static const int OPTIONS = XML_PARSE_NOENT | XML_PARSE_NOBLANKS | XML_PARSE_NOCDATA;
+
+/**
+ * @class Reader
+ * Streaming reader of XML documents, based on the libxml2 xmlTextReader.
+ * Unlike @ref Builder, the document is never fully stored in memory:
+ * the reader provides a pull-style sequence of events (start and end of
+ * elements, texts, comments, etc) and only keeps the current node in memory.
+ * This is the way to go to process huge XML documents, like traces.
+ *
+ * The typical use is:
+ * @code
+ *	xom::Reader reader("trace.xml");
+ *	while(reader.next())
+ *		if(reader.event() == xom::Reader::START_ELEMENT && reader.localName() == "event") {
+ *			Option<xom::String> date = reader.getAttributeValue("date");
+ *			...
+ *		}
+ * @endcode
+ *
+ * Notice that an empty element (like <code>&lt;a/&gt;</code>) only produces
+ * a START_ELEMENT event: isEmpty() allows to detect this case.
+ *
+ * The strings returned by the reader (names, values, etc) are owned by the reader
+ * and are only valid until the next call to next(), skip() or expand().
+ *
+ * When an element subtree needs random access, it can be materialized with
+ * expand() as a usual XOM document and the reader continues after this element.
+ *
+ * @ingroup xom
+ */
+
+/**
+ * @enum Reader::event_t
+ * Events produced by the reader.
+ */
+
+/**
+ * @var Reader::event_t Reader::NONE
+ * No more event (end of the document).
+ */
+
+/**
+ * @var Reader::event_t Reader::START_ELEMENT
+ * Opening of an element.
+ */
+
+/**
+ * @var Reader::event_t Reader::END_ELEMENT
+ * Closing of an element.
+ */
+
+/**
+ * @var Reader::event_t Reader::TEXT
+ * Text (including CDATA sections).
+ */
+
+/**
+ * @var Reader::event_t Reader::COMMENT
+ * Comment.
+ */
+
+/**
+ * @var Reader::event_t Reader::PROCESSING_INSTRUCTION
+ * Processing instruction.
+ */
+
+
+/**
+ * Build a reader on the given file.
+ * @param path		Path of the file.
+ * @param factory	Factory used to build the documents produced by expand()
+ * 					(default to the XOM default factory).
+ * @throw io::IOException	If the file cannot be opened.
+ */
+Reader::Reader(CString path, NodeFactory *factory): fact(factory), _event(NONE), pending(false), pres(0) {
+	reader = xmlReaderForFile(path.chars(), nullptr, OPTIONS);
+	if(reader == nullptr)
+		throw io::IOException(_ << "cannot open \"" << path << "\"");
+	init();
+}
+
+
+///
+static int read_callback(void *context,  char * buffer,  int len) {
+	return reinterpret_cast<io::InStream *>(context)->read(buffer, len);
+}
+
+///
+static int close_callback(void *context) {
+	return 0;
+}
+
+
+/**
+ * Build a reader on the given input stream.
+ * @param in		Stream to read from.
+ * @param base_uri	Base URI of the document (used for messages and relative references).
+ * @param factory	Factory used to build the documents produced by expand()
+ * 					(default to the XOM default factory).
+ * @throw io::IOException	If the reader cannot be built.
+ */
+Reader::Reader(io::InStream& in, CString base_uri, NodeFactory *factory)
+: fact(factory), _event(NONE), pending(false), pres(0) {
+	reader = xmlReaderForIO(read_callback, close_callback, &in,
+		base_uri.isEmpty() ? nullptr : base_uri.chars(), nullptr, OPTIONS);
+	if(reader == nullptr)
+		throw io::IOException("cannot open XML stream");
+	init();
+}
+
+
+/**
+ */
+Reader::~Reader(void) {
+	xmlFreeTextReader(READER(reader));
+}
+
+
+/**
+ * Common initialization.
+ */
+void Reader::init(void) {
+	xmlLineNumbersDefault(1);
+	if(fact == nullptr)
+		fact = &NodeFactory::default_factory;
+}
+
+
+/**
+ * Check the result of a libxml2 reader function.
+ * @param result	Result to check.
+ * @throw io::IOException	If the result denotes an error.
+ */
+void Reader::check(int result) {
+	if(result < 0) {
+		_event = NONE;
+		throw io::IOException(_ << baseURI() << ':' << line() << ": malformed XML");
+	}
+}
+
+
+/**
+ * Move to the next event.
+ * @return	True if there is an event, false at the end of the document.
+ * @throw io::IOException	If the XML is malformed.
+ */
+bool Reader::next(void) {
+	int r;
+	if(pending) {
+		pending = false;
+		r = pres;
+	}
+	else
+		r = xmlTextReaderRead(READER(reader));
+	while(true) {
+		check(r);
+		if(r == 0) {
+			_event = NONE;
+			return false;
+		}
+		switch(xmlTextReaderNodeType(READER(reader))) {
+		case XML_READER_TYPE_ELEMENT:
+			_event = START_ELEMENT;
+			return true;
+		case XML_READER_TYPE_END_ELEMENT:
+			_event = END_ELEMENT;
+			return true;
+		case XML_READER_TYPE_TEXT:
+		case XML_READER_TYPE_CDATA:
+		case XML_READER_TYPE_SIGNIFICANT_WHITESPACE:
+			_event = TEXT;
+			return true;
+		case XML_READER_TYPE_COMMENT:
+			_event = COMMENT;
+			return true;
+		case XML_READER_TYPE_PROCESSING_INSTRUCTION:
+			_event = PROCESSING_INSTRUCTION;
+			return true;
+		default:
+			r = xmlTextReaderRead(READER(reader));
+			break;
+		}
+	}
+}
+
+
+/**
+ * Skip the current node and, for an element, its whole content.
+ * The next call to next() returns the event following the current node.
+ * @throw io::IOException	If the XML is malformed.
+ */
+void Reader::skip(void) {
+	pres = xmlTextReaderNext(READER(reader));
+	check(pres);
+	pending = true;
+}
+
+
+/**
+ * Get the depth of the current node (the root element is at depth 0).
+ * @return	Current depth.
+ */
+int Reader::depth(void) const {
+	return xmlTextReaderDepth(READER(reader));
+}
+
+
+/**
+ * Get the line of the current node in the source.
+ * @return	Current line.
+ */
+int Reader::line(void) const {
+	return xmlTextReaderGetParserLineNumber(READER(reader));
+}
+
+
+/**
+ * Test if the current element is empty, i.e. written <code>&lt;a/&gt;</code>.
+ * In this case, no END_ELEMENT event is produced for this element.
+ * @return	True if the current element is empty, false else.
+ */
+bool Reader::isEmpty(void) const {
+	return xmlTextReaderIsEmptyElement(READER(reader)) == 1;
+}
+
+
+/**
+ * Get the base URI of the current node.
+ * @return	Base URI.
+ */
+String Reader::baseURI(void) const {
+	const xmlChar *r = xmlTextReaderConstBaseUri(READER(reader));
+	return r ? String(r) : String("");
+}
+
+
+/**
+ * Get the qualified name of the current node.
+ * @return	Qualified name.
+ */
+String Reader::name(void) const {
+	const xmlChar *r = xmlTextReaderConstName(READER(reader));
+	return r ? String(r) : String("");
+}
+
+
+/**
+ * Get the local name of the current node.
+ * @return	Local name.
+ */
+String Reader::localName(void) const {
+	const xmlChar *r = xmlTextReaderConstLocalName(READER(reader));
+	return r ? String(r) : String("");
+}
+
+
+/**
+ * Get the namespace URI of the current node.
+ * @return	Namespace URI or an empty string.
+ */
+String Reader::namespaceURI(void) const {
+	const xmlChar *r = xmlTextReaderConstNamespaceUri(READER(reader));
+	return r ? String(r) : String("");
+}
+
+
+/**
+ * Get the value of the current node: text for a text or a comment,
+ * data for a processing instruction and empty for an element.
+ * @return	Current node value.
+ */
+String Reader::value(void) const {
+	const xmlChar *r = xmlTextReaderConstValue(READER(reader));
+	return r ? String(r) : String("");
+}
+
+
+/**
+ * Get the number of attributes of the current element.
+ * @return	Attribute count.
+ */
+int Reader::attributeCount(void) const {
+	return xmlTextReaderAttributeCount(READER(reader));
+}
+
+
+/**
+ * Get the name of the attribute at the given index in the current element.
+ * @param index	Attribute index.
+ * @return		Attribute name.
+ */
+String Reader::attributeName(int index) const {
+	int r = xmlTextReaderMoveToAttributeNo(READER(reader), index);
+	ASSERTP(r == 1, "attribute index out of bounds");
+	String res = name();
+	xmlTextReaderMoveToElement(READER(reader));
+	return res;
+}
+
+
+/**
+ * Get the value of the attribute at the given index in the current element.
+ * @param index	Attribute index.
+ * @return		Attribute value.
+ */
+String Reader::attributeValue(int index) const {
+	int r = xmlTextReaderMoveToAttributeNo(READER(reader), index);
+	ASSERTP(r == 1, "attribute index out of bounds");
+	String res = value();
+	xmlTextReaderMoveToElement(READER(reader));
+	return res;
+}
+
+
+/**
+ * Look for an attribute of the current element.
+ * @param name	Attribute name.
+ * @return		Attribute value or none.
+ */
+Option<String> Reader::getAttributeValue(String name) const {
+	if(xmlTextReaderMoveToAttribute(READER(reader), name) != 1)
+		return none;
+	String res = value();
+	xmlTextReaderMoveToElement(READER(reader));
+	return some(res);
+}
+
+
+/**
+ * Materialize the current element as a XOM document whose root element is a copy
+ * of the current element. The returned document belongs to the caller and is
+ * independent of the reader.
+ *
+ * If deep is true, the whole content of the element is copied and the reader
+ * continues after the element: the next call to next() returns the event following
+ * the closing of the element. Else only the element and its attributes are copied
+ * and the reader continues with the content of the element.
+ *
+ * @param deep	True to copy the content of the element, false else.
+ * @return		Built document.
+ * @throw io::IOException	If the XML is malformed.
+ */
+Document *Reader::expand(bool deep) {
+	ASSERTP(_event == START_ELEMENT, "only elements can be expanded");
+	xmlNodePtr node = deep
+		? xmlTextReaderExpand(READER(reader))
+		: xmlTextReaderCurrentNode(READER(reader));
+	if(node == nullptr)
+		check(-1);
+	xmlDocPtr doc = xmlNewDoc(BAD_CAST "1.0");
+	const xmlChar *base = xmlTextReaderConstBaseUri(READER(reader));
+	if(base != nullptr)
+		doc->URL = xmlStrdup(base);
+	xmlDocSetRootElement(doc, xmlDocCopyNode(node, doc, deep ? 1 : 2));
+	if(deep)
+		skip();
+	return fact->makeDocument(doc);
+}
+
+} } // elm::xom
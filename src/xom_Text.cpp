@@ -63,6 +63,7 @@ Node *Text::copy(void) {
  * @param data	Text to put in.
  */
 void Text::setValue(String data) {
+	modified(node);
 	xmlNodeSetContent(NODE(node), data);
 }
 
@@ -97,10 +97,11 @@ Document *XIncluder::resolve(Document *in, Builder& builder) {
  * @param in	The document in which include elements should be resolved.
  */
 void XIncluder::resolveInPlace(Document *in) {
-	if(xmlXIncludeProcessFlags(
+	int r = xmlXIncludeProcessFlags(
 		DOC(in->node),
-		XML_PARSE_NOCDATA | XML_PARSE_NOXINCNODE)
-	< 0)
+		XML_PARSE_NOCDATA | XML_PARSE_NOXINCNODE);
+	Node::modified(in->node, true);
+	if(r < 0)
 		throw Exception(in, "xinclude error");
 }
 
@@ -178,12 +178,27 @@ Exception::Exception(xom::Element *element, const string& message)
 /**
  * @class Parser;
  * Parser for DTD module.
+ *
+ * The parser can work on a XOM document in memory or in streaming mode
+ * on a @ref xom::Reader. In streaming mode, the children of the root element
+ * are materialized one by one and only the last WINDOW ones are kept in memory:
+ * the memory footprint is bounded whatever the size of the document.
+ * The counterpart is that the parser cannot backtrack over more than
+ * WINDOW children of the root element and that the strings passed to the
+ * factory are only valid during the call.
+ *
  * @ingroup dtd
  */
 
+/**
+ * @var int Parser::WINDOW;
+ * Number of children of the root element kept in memory in streaming mode.
+ */
+
 ///
 Parser::Parser(Factory& factory, Element& element, t::uint32 flags)
-		: _fact(factory), _elt(element), _flags(flags), _last_error(nullptr) { }
+		: _fact(factory), _elt(element), _flags(flags), _last_error(nullptr),
+		  _reader(nullptr), _root(nullptr), _wbase(0), _rend(false) { }
 
 /**
  * @fn bool Parser::doesCrop() const;
@@ -359,7 +374,7 @@ void Parser::recordID(xom::String id, Element& element) {
  */
 void Parser::recordPatch(xom::String id, AbstractAttribute& attr) {
 	auto p = factory().getPatchRef(attr);
-	_patches.fetch(id).add(backpatch_t(&attr, p, asElement()));
+	_patches.fetch(id).add(backpatch_t(&attr, p, _reader == nullptr ? asElement() : _root->getRootElement()));
 }
 
 
@@ -394,6 +409,68 @@ void Parser::parse(xom::Element *xelt) {
 	}
 }
 
+/**
+ * Parse the document read by the given reader in streaming mode.
+ * @param reader	Reader to read the document from.
+ * @throw Exception			If there is an error.
+ * @throw io::IOException	If there is an error in the XML format.
+ */
+void Parser::parse(xom::Reader& reader) {
+
+	// look for the root element
+	while(reader.next() && reader.event() != xom::Reader::START_ELEMENT)
+		;
+	if(reader.ended())
+		throw io::IOException("no root element in XML document");
+
+	// prepare the streaming
+	_reader = &reader;
+	_rend = reader.isEmpty();
+	_root = reader.expand(false);
+	_wbase = 0;
+
+	// perform the parsing
+	try {
+		parse(_root->getRootElement());
+	}
+	catch(...) {
+		release();
+		throw;
+	}
+	release();
+}
+
+/**
+ * Release the resources used in streaming mode.
+ */
+void Parser::release() {
+	for(auto node: _window)
+		delete node->getDocument();
+	_window.clear();
+	delete _root;
+	_root = nullptr;
+	_reader = nullptr;
+}
+
+/**
+ * Test if the given text is blank.
+ * @param t		Text to test.
+ * @return		True if the text is only made of spaces.
+ */
+static bool isBlank(xom::String t) {
+	for(int i = 0; i < t.length(); i++)
+		switch(t[i]) {
+		case ' ':
+		case '\t':
+		case '\v':
+		case '\n':
+			continue;
+		default:
+			return false;
+		}
+	return true;
+}
+
 /**
  * Test if the current node is empty, that is only composed of spaces.
  * @return	True if the current node is empty, false else.
@@ -401,20 +478,8 @@ void Parser::parse(xom::Element *xelt) {
 bool Parser::isEmpty() {
 	if(cur.node->kind() != xom::Node::TEXT)
 		return false;
-	else {
-		xom::String t = static_cast<xom::Text *>(cur.node)->getText();
-		for(int i = 0; i < t.length(); i++)
-			switch(t[i]) {
-			case ' ':
-			case '\t':
-			case '\v':
-			case '\n':
-				continue;
-			default:
-				return false;
-			}
-		return true;
-	}
+	else
+		return isBlank(static_cast<xom::Text *>(cur.node)->getText());
 }
 
 /**
@@ -422,15 +487,73 @@ bool Parser::isEmpty() {
  */
 void Parser::setNode() {
 	if(!stack.isEmpty())
-		while(cur.i < parent()->getChildCount()) {
-			cur.node = parent()->getChild(cur.i);
+		for(cur.node = child(cur.i); cur.node != nullptr; cur.node = child(++cur.i))
 			if(!doesCrop() || !isEmpty())
 				return;
-			cur.i++;
-		}
 	cur.node = nullptr;
 }
 
+/**
+ * Get a child of the parent element.
+ * @param i		Index of the child.
+ * @return		Child node or null if there is no more child.
+ */
+xom::Node *Parser::child(int i) {
+	if(_reader != nullptr && stack.length() == 1)
+		return streamed(i);
+	else if(i < parent()->getChildCount())
+		return parent()->getChild(i);
+	else
+		return nullptr;
+}
+
+/**
+ * Get a child of the root element in streaming mode.
+ * @param i		Index of the child.
+ * @return		Child node or null if there is no more child.
+ */
+xom::Node *Parser::streamed(int i) {
+	if(i < _wbase)
+		throw Exception(_root->getRootElement(), "cannot backtrack so far in streaming mode");
+	while(i >= _wbase + _window.length()) {
+
+		// read the next child
+		if(_rend || !_reader->next() || _reader->depth() == 0) {
+			_rend = true;
+			return nullptr;
+		}
+		xom::Node *node;
+		switch(_reader->event()) {
+		case xom::Reader::START_ELEMENT:
+			node = _reader->expand()->getRootElement();
+			break;
+		case xom::Reader::TEXT: {
+				if(doesCrop() && isBlank(_reader->value()))
+					continue;
+				xom::Element *holder = new xom::Element("text");
+				holder->appendChild(_reader->value());
+				new xom::Document(holder);
+				node = holder->getChild(0);
+			}
+			break;
+		default:
+			continue;
+		}
+		_window.add(node);
+
+		// release the oldest child
+		if(_window.length() > WINDOW) {
+			xom::Document *doc = _window[0]->getDocument();
+			if(_last_error != nullptr && _last_error->getDocument() == doc)
+				_last_error = _root->getRootElement();
+			delete doc;
+			_window.removeFirst();
+			_wbase++;
+		}
+	}
+	return _window[i - _wbase];
+}
+
 
 /**
  * @class Factory;
@@ -894,6 +1017,21 @@ void Element::parse(Factory& factory, io::InStream& in, t::uint32 flags) {
 
 
 
+/**
+ * Parse the current DTD element from the given XML reader in streaming mode
+ * (see @ref Parser for details).
+ * @param factory	Factory to call for the parsed elements.
+ * @param reader	XML reader to read from.
+ * @param flags		Flags for parsing (default set to Parser::CROP).
+ * @throw Exception	Thrown if there is a format error.
+ * @throw Exception	Thrown if there is an IO error.
+ */
+void Element::parse(Factory& factory, xom::Reader& reader, t::uint32 flags) {
+	Parser parser(factory, *this, flags);
+	parser.parse(reader);
+}
+
+
 /**
  * @class Optional
  * Represent an optional content: if the content is recognized,
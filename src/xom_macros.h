@@ -1,7 +1,11 @@
 #ifndef ELM_XOM_MACROS_H
 #define ELM_XOM_MACROS_H
 
-#include <elm/xom/Node.h>
+#include <elm/alloc/StackAllocator.h>
+#include <elm/data/HashMap.h>
+#include <elm/sys/Mutex.h>
+#include <elm/sys/SpinLock.h>
+#include <elm/xom/Document.h>
 #include <libxml/tree.h>
 
 #define DOC(p)	((xmlDocPtr)(p))
@@ -9,6 +13,28 @@
 
 namespace elm { namespace xom {
 
+// memory of a document: wrappers of the nodes and stored strings
+class Document::Arena {
+public:
+	static const t::size SIZE = 8192;
+	typedef struct view_t {
+		t::uint32 stamp;
+		String str;
+	} view_t;
+	inline Arena(void): alloc(SIZE), bigs(nullptr), refs(0), alive(true), stamp(0) { }
+	~Arena(void);
+	String store(const char_t *str);
+	StackAllocator alloc;
+	void *bigs;
+	int refs;
+	bool alive;
+	t::uint32 stamp;
+	HashMap<void *, view_t> views;
+};
+
+// lock of the lazy caches of the XML trees
+sys::Mutex& cacheLock(void);
+
 /**
  * Get the XOM object linked with this parser representation node.
  * @param xml_node	Parser node.
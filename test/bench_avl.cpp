@@ -0,0 +1,62 @@
+/*
+ *	avl::Map benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/avl/Map.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+static const int size = 1 << 12;
+
+BENCH_BEGIN(avl)
+
+	BENCH("put") {
+		avl::Map<int, int> m;
+		for(int i = 0; i < size; i++)
+			m.put((i * 2654435761u) % size, i);
+		Benchmark::doNotOptimize(m.count());
+	}
+
+	avl::Map<int, int> m;
+	for(int i = 0; i < size; i++)
+		m.put(i, i);
+
+	BENCH("get") {
+		int s = 0;
+		for(int i = 0; i < size; i++)
+			s += m.get(i, 0);
+		Benchmark::doNotOptimize(s);
+	}
+
+	BENCH("iterate") {
+		int s = 0;
+		for(auto x: m)
+			s += x;
+		Benchmark::doNotOptimize(s);
+	}
+
+	BENCH("put/remove") {
+		m.remove(size / 2);
+		m.put(size / 2, 0);
+		Benchmark::clobberMemory();
+	}
+
+BENCH_END
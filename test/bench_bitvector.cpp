@@ -0,0 +1,63 @@
+/*
+ *	BitVector benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/util/BitVector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+static const int size = 1 << 14;
+
+BENCH_BEGIN(bitvector)
+
+	BitVector v(size), w(size);
+	for(int i = 0; i < size; i += 3)
+		v.set(i);
+	for(int i = 0; i < size; i += 5)
+		w.set(i);
+
+	BENCH("set/bit") {
+		int s = 0;
+		for(int i = 0; i < size; i += 7) {
+			w.set(i);
+			s += v.bit(i);
+		}
+		Benchmark::doNotOptimize(s);
+	}
+
+	BENCH("countOnes") {
+		Benchmark::doNotOptimize(v.countOnes());
+	}
+
+	BENCH("applyOr") {
+		BitVector r(v);
+		r.applyOr(w);
+		Benchmark::doNotOptimize(r.bit(0));
+	}
+
+	BENCH("OneIterator") {
+		int s = 0;
+		for(BitVector::OneIterator i(v); i(); i++)
+			s += *i;
+		Benchmark::doNotOptimize(s);
+	}
+
+BENCH_END
@@ -0,0 +1,75 @@
+/*
+ *	checksum module benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/checksum/CRC32C.h>
+#include <elm/checksum/Fletcher.h>
+#include <elm/checksum/MD5.h>
+#include <elm/checksum/XXHash64.h>
+#include <elm/hash.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::checksum;
+
+static const int size = 64 << 10;
+static const int word_size = 24;
+static const int word_count = size / word_size;
+
+BENCH_BEGIN(checksum)
+
+	// build the buffer
+	t::uint8 *buf = new t::uint8[size];
+	t::uint32 x = 123456789;
+	for(int i = 0; i < size; i++) {
+		x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+		buf[i] = x;
+	}
+	t::uint64 sum = 0;
+
+	// each iteration processes a 64 KB buffer
+	BENCH("MD5/64KB")
+		{ MD5 md5; md5.put(buf, size); Benchmark::doNotOptimize(md5); }
+	BENCH("Fletcher/64KB")
+		{ Fletcher f; f.put(buf, size); sum += f.sum(); }
+	BENCH(CRC32C::isAccelerated() ? "CRC32C (hw)/64KB" : "CRC32C (sw)/64KB")
+		sum += CRC32C::update(0xffffffff, buf, size);
+	BENCH("CRC32C (table)/64KB")
+		sum += CRC32C::updateTable(0xffffffff, buf, size);
+	BENCH("XXHash64/64KB")
+		sum += XXHash64::hash(buf, size);
+	BENCH("hash_jenkins/64KB")
+		sum += hash_jenkins(buf, size);
+
+	// each iteration hashes a short key as used in hash tables
+	int i = 0;
+	BENCH("hash_string/24B") {
+		sum += hash_string(reinterpret_cast<const char *>(buf + (i % word_count) * word_size), word_size);
+		i++;
+	}
+	BENCH("hash_bytes/24B") {
+		sum += hash_bytes(buf + (i % word_count) * word_size, word_size);
+		i++;
+	}
+
+	Benchmark::doNotOptimize(sum);
+	delete [] buf;
+
+BENCH_END
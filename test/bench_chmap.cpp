@@ -0,0 +1,144 @@
+/*
+ *	ConcurrentHashMap scaling benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <thread>
+#include <elm/concur/ConcurrentHashMap.h>
+#include <elm/data/HashMap.h>
+#include <elm/data/Vector.h>
+#include <elm/sys/Thread.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::sys;
+
+static const int key_count = 1 << 16;
+static const int batch = 1 << 14;
+
+// reference: HashMap protected by a single mutex
+class LockedMap {
+public:
+	inline LockedMap(void): map(key_count + 1) { }
+	inline int getOrCompute(int k) {
+		Guard<Mutex> g(lock);
+		Option<int> v = map.get(k);
+		if(v.some())
+			return *v;
+		map.put(k, 2 * k);
+		return 2 * k;
+	}
+	inline int get(int k) { Guard<Mutex> g(lock); return map.get(k, -1); }
+private:
+	Mutex lock;
+	HashMap<int, int> map;
+};
+
+class ConcurMap {
+public:
+	inline int getOrCompute(int k) { return map.getOrCompute(k, [](int k) { return 2 * k; }); }
+	inline int get(int k) { return map.get(k, -1); }
+private:
+	concur::ConcurrentHashMap<int, int> map;
+};
+
+// 90% of look-ups, 10% of get-or-compute
+template <class M>
+class Worker: public Runnable {
+public:
+	Worker(M& map, int id, int n): m(map), _n(n), _x(id * 7919 + 1), sum(0) { }
+	void run(void) override {
+		for(int i = 0; i < _n; i++) {
+			_x ^= _x << 13; _x ^= _x >> 17; _x ^= _x << 5;
+			int k = _x % key_count;
+			if(_x % 10 == 0)
+				sum += m.getOrCompute(k);
+			else
+				sum += m.get(k);
+		}
+	}
+	t::int64 result(void) const { return sum; }
+private:
+	M& m;
+	int _n;
+	t::uint32 _x;
+	t::int64 sum;
+};
+
+// perform a batch of operations shared by the given number of threads
+template <class M>
+class Round {
+public:
+	Round(M& map, int threads) {
+		for(int i = 0; i < threads; i++) {
+			_ws.add(new Worker<M>(map, i, batch / threads));
+			_ts.add(Thread::make(*_ws[i]));
+		}
+	}
+	~Round(void) {
+		for(int i = 0; i < _ws.count(); i++) {
+			delete _ts[i];
+			delete _ws[i];
+		}
+	}
+	t::int64 operator()(void) {
+		for(auto t: _ts)
+			t->start();
+		t::int64 s = 0;
+		for(int i = 0; i < _ts.count(); i++) {
+			_ts[i]->join();
+			s += _ws[i]->result();
+		}
+		return s;
+	}
+private:
+	Vector<Worker<M> *> _ws;
+	Vector<Thread *> _ts;
+};
+
+static const int levels = 5;
+static cstring locked_labels[levels] = {
+	"HashMap+Mutex/1", "HashMap+Mutex/2", "HashMap+Mutex/4", "HashMap+Mutex/8", "HashMap+Mutex/16"
+};
+static cstring concur_labels[levels] = {
+	"ConcurrentHashMap/1", "ConcurrentHashMap/2", "ConcurrentHashMap/4", "ConcurrentHashMap/8", "ConcurrentHashMap/16"
+};
+
+BENCH_BEGIN(chmap)
+
+	// each iteration performs a batch of operations with 1 to 16 threads
+	int max = std::thread::hardware_concurrency();
+	LockedMap lm;
+	ConcurMap cm;
+	for(int i = 0; i < key_count; i += 2) {
+		lm.getOrCompute(i);
+		cm.getOrCompute(i);
+	}
+	t::int64 s = 0;
+	for(int l = 0; l < levels && (l == 0 || (1 << l) <= max); l++) {
+		Round<LockedMap> lr(lm, 1 << l);
+		BENCH(locked_labels[l])
+			s += lr();
+		Round<ConcurMap> cr(cm, 1 << l);
+		BENCH(concur_labels[l])
+			s += cr();
+	}
+	Benchmark::doNotOptimize(s);
+
+BENCH_END
@@ -0,0 +1,64 @@
+/*
+ *	ColumnTable benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/ColumnTable.h>
+#include <elm/data/FragTable.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+typedef struct inst_t {
+	t::uint32 addr;
+	int size;
+	void *inst;
+	t::uint64 flags;
+} inst_t;
+
+BENCH_BEGIN(column_table)
+
+	static const int N = 1 << 16;
+	FragTable<inst_t> frag(12);
+	ColumnTable<t::uint32, int, void *, t::uint64> cols(12);
+	for(int i = 0; i < N; i++) {
+		inst_t inst = { t::uint32(i * 4), i % 8, nullptr, 0 };
+		frag.add(inst);
+		cols.add(inst.addr, inst.size, inst.inst, inst.flags);
+	}
+
+	BENCH("frag") {
+		int s = 0;
+		for(int i = 0; i < frag.count(); i++)
+			s += frag[i].size;
+		Benchmark::doNotOptimize(s);
+	}
+
+	BENCH("column") {
+		int s = 0;
+		cols.scan<1>([&s](const int *c, int n, int b) {
+			int ps = 0;
+			for(int i = 0; i < n; i++)
+				ps += c[i];
+			s += ps;
+		});
+		Benchmark::doNotOptimize(s);
+	}
+
+BENCH_END
@@ -0,0 +1,65 @@
+/*
+ *	concur queues benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/concur.h>
+#include <elm/data/VectorQueue.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::concur;
+
+BENCH_BEGIN(concur)
+
+	VectorQueue<int> vq;
+	SPSCQueue<int> sq(1024);
+	MPMCQueue<int> mq(1024);
+	MPSCQueue<int> uq;
+	BlockingQueue<SPSCQueue<int> > bq(1024);
+	int x = 0;
+
+	BENCH("VectorQueue") {
+		vq.put(x);
+		x = vq.get();
+	}
+
+	BENCH("SPSCQueue") {
+		sq.put(x);
+		sq.get(x);
+	}
+
+	BENCH("MPMCQueue") {
+		mq.put(x);
+		mq.get(x);
+	}
+
+	BENCH("MPSCQueue") {
+		uq.put(x);
+		uq.get(x);
+	}
+
+	BENCH("BlockingQueue") {
+		bq.put(x);
+		bq.get(x);
+	}
+
+	Benchmark::doNotOptimize(x);
+
+BENCH_END
@@ -0,0 +1,64 @@
+/*
+ *	dyndata benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/Vector.h>
+#include <elm/dyndata/Collection.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+BENCH_BEGIN(dyndata)
+
+	Vector<int> v;
+	dyndata::MutableCollection<int, Vector<int> > coll;
+	for(int i = 0; i < 1000; i++) {
+		v.add(i);
+		coll.add(i);
+	}
+	const dyndata::AbstractCollection<int>& c = coll;
+
+	BENCH("virtual") {
+		int s = 0;
+		dyndata::AbstractIter<int> * volatile p = dyndata::iter<int>(v.items());
+		dyndata::AbstractIter<int> *i = p;
+		for(; !i->ended(); i->next())
+			s += i->item();
+		delete i;
+		Benchmark::doNotOptimize(s);
+	}
+
+	BENCH("iter") {
+		int s = 0;
+		for(auto i = c.items(); i(); i++)
+			s += *i;
+		Benchmark::doNotOptimize(s);
+	}
+
+	BENCH("fill") {
+		int s = 0, buf[64];
+		auto i = c.items();
+		for(int n = i.fill(buf, 64); n != 0; n = i.fill(buf, 64))
+			for(int k = 0; k < n; k++)
+				s += buf[k];
+		Benchmark::doNotOptimize(s);
+	}
+
+BENCH_END
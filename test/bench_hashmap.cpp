@@ -0,0 +1,71 @@
+/*
+ *	HashMap benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/HashMap.h>
+#include <elm/data/Vector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+static const int size = 1 << 12;
+
+BENCH_BEGIN(hashmap)
+
+	BENCH("put") {
+		HashMap<int, int> m;
+		for(int i = 0; i < size; i++)
+			m.put(i * 7, i);
+		Benchmark::doNotOptimize(m.count());
+	}
+
+	HashMap<int, int> m;
+	for(int i = 0; i < size; i++)
+		m.put(i * 7, i);
+
+	BENCH("get hit") {
+		int s = 0;
+		for(int i = 0; i < size; i++)
+			s += m.get(i * 7, 0);
+		Benchmark::doNotOptimize(s);
+	}
+
+	BENCH("get miss") {
+		int s = 0;
+		for(int i = 0; i < size; i++)
+			s += m.get(i * 7 + 1, 0);
+		Benchmark::doNotOptimize(s);
+	}
+
+	HashMap<string, int> sm;
+	Vector<string> keys;
+	for(int i = 0; i < size; i++) {
+		keys.add(_ << "key" << i);
+		sm.put(keys[i], i);
+	}
+
+	BENCH("get string") {
+		int s = 0;
+		for(const auto& k: keys)
+			s += sm.get(k, 0);
+		Benchmark::doNotOptimize(s);
+	}
+
+BENCH_END
@@ -0,0 +1,148 @@
+/*
+ *	priority queue benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/BinomialQueue.h>
+#include <elm/data/Heap.h>
+#include <elm/data/RadixHeap.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+typedef Pair<t::uint32, int> item_t;
+
+class ItemComparator {
+public:
+	inline int doCompare(const item_t& x, const item_t& y) const
+		{ return x.fst < y.fst ? -1 : x.fst > y.fst ? 1 : 0; }
+};
+
+// random graph in CSR form
+class Graph {
+public:
+	Graph(int n, int d): n(n), start(new int[n + 1]), succ(new int[n * d]), weight(new t::uint32[n * d]) {
+		t::uint32 s = 1;
+		for(int i = 0; i < n; i++) {
+			start[i] = i * d;
+			for(int j = 0; j < d; j++) {
+				s = s * 1103515245 + 12345;
+				succ[i * d + j] = (s >> 8) % n;
+				weight[i * d + j] = 1 + (s >> 20) % 100;
+			}
+		}
+		start[n] = n * d;
+	}
+	~Graph(void) { delete [] start; delete [] succ; delete [] weight; }
+	int n;
+	int *start, *succ;
+	t::uint32 *weight;
+};
+
+template <class Q>
+static t::uint64 lazy(const Graph& g, Q& q, t::uint32 *dist) {
+	for(int i = 0; i < g.n; i++)
+		dist[i] = t::uint32(-1);
+	dist[0] = 0;
+	q.put(item_t(0, 0));
+	while(!q.isEmpty()) {
+		item_t x = q.get();
+		if(x.fst != dist[x.snd])
+			continue;
+		for(int e = g.start[x.snd]; e < g.start[x.snd + 1]; e++) {
+			t::uint32 d = x.fst + g.weight[e];
+			if(d < dist[g.succ[e]]) {
+				dist[g.succ[e]] = d;
+				q.put(item_t(d, g.succ[e]));
+			}
+		}
+	}
+	return dist[g.n - 1];
+}
+
+BENCH_BEGIN(heap)
+
+	static const int N = 1 << 14, D = 8;
+	Graph g(N, D);
+	t::uint32 *dist = new t::uint32[N];
+
+	// Dijkstra with lazy deletion
+	BENCH("binomial-queue") {
+		BinomialQueue<item_t, ItemComparator> q;
+		Benchmark::doNotOptimize(lazy(g, q, dist));
+	}
+
+	BENCH("heap") {
+		Heap<item_t, ItemComparator> q;
+		Benchmark::doNotOptimize(lazy(g, q, dist));
+	}
+
+	BENCH("radix-heap") {
+		RadixHeap<int> q;
+		for(int i = 0; i < N; i++)
+			dist[i] = t::uint32(-1);
+		dist[0] = 0;
+		q.put(0, 0);
+		while(q) {
+			t::uint32 k = q.headKey();
+			int v = q.get();
+			if(k != dist[v])
+				continue;
+			for(int e = g.start[v]; e < g.start[v + 1]; e++) {
+				t::uint32 d = k + g.weight[e];
+				if(d < dist[g.succ[e]]) {
+					dist[g.succ[e]] = d;
+					q.put(d, g.succ[e]);
+				}
+			}
+		}
+		Benchmark::doNotOptimize(dist[N - 1]);
+	}
+
+	// Dijkstra with decrease-key
+	BENCH("indexed-heap") {
+		IndexedHeap<item_t, ItemComparator> q;
+		int *hs = new int[N];
+		for(int i = 0; i < N; i++) {
+			dist[i] = t::uint32(-1);
+			hs[i] = -1;
+		}
+		dist[0] = 0;
+		hs[0] = q.put(item_t(0, 0));
+		while(q) {
+			item_t x = q.get();
+			for(int e = g.start[x.snd]; e < g.start[x.snd + 1]; e++) {
+				t::uint32 d = x.fst + g.weight[e];
+				int s = g.succ[e];
+				if(d < dist[s]) {
+					dist[s] = d;
+					if(hs[s] >= 0 && q.contains(hs[s]) && q[hs[s]].snd == s)
+						q.decreaseKey(hs[s], item_t(d, s));
+					else
+						hs[s] = q.put(item_t(d, s));
+				}
+			}
+		}
+		delete [] hs;
+		Benchmark::doNotOptimize(dist[N - 1]);
+	}
+
+	delete [] dist;
+
+BENCH_END
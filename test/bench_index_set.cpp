@@ -0,0 +1,85 @@
+/*
+ *	IndexSet benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/util/BitVector.h>
+#include <elm/util/IndexSet.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+static const int size = 1 << 16;
+
+BENCH_BEGIN(index_set)
+
+	// sparse sets: a few indices in a big universe
+	BitVector sv(size), sw(size);
+	IndexSet si(size), sj(size);
+	for(int i = 0; i < 32; i++) {
+		sv.set(i * 1999);
+		si.set(i * 1999);
+		sw.set(i * 1777);
+		sj.set(i * 1777);
+	}
+
+	BENCH("sparse/bitvector/applyOr") {
+		BitVector r(sv);
+		r.applyOr(sw);
+		Benchmark::doNotOptimize(r.countOnes());
+	}
+
+	BENCH("sparse/indexset/applyOr") {
+		IndexSet r(si);
+		r.applyOr(sj);
+		Benchmark::doNotOptimize(r.countOnes());
+	}
+
+	// dense sets
+	BitVector dv(size), dw(size);
+	IndexSet di(size), dj(size);
+	for(int i = 0; i < size; i += 3) {
+		dv.set(i);
+		di.set(i);
+	}
+	for(int i = 0; i < size; i += 5) {
+		dw.set(i);
+		dj.set(i);
+	}
+
+	BENCH("dense/bitvector/applyOr") {
+		BitVector r(dv);
+		r.applyOr(dw);
+		Benchmark::doNotOptimize(r.countOnes());
+	}
+
+	BENCH("dense/indexset/applyOr") {
+		IndexSet r(di);
+		r.applyOr(dj);
+		Benchmark::doNotOptimize(r.countOnes());
+	}
+
+	// mixed sets
+	BENCH("mixed/indexset/applyAnd") {
+		IndexSet r(di);
+		r.applyAnd(sj);
+		Benchmark::doNotOptimize(r.countOnes());
+	}
+
+BENCH_END
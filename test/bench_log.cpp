@@ -0,0 +1,68 @@
+/*
+ *	log::Logger benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/io.h>
+#include <elm/log/Logger.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::log;
+
+class NullStream: public io::OutStream {
+public:
+	int write(const char *buffer, int size) override { return size; }
+	int flush(void) override { return 0; }
+};
+
+BENCH_BEGIN(log)
+
+	NullStream stream;
+	io::Output out(stream);
+
+	BENCH("sync") {
+		for(int i = 0; i < 100; i++) {
+			Capture c(Logger::INFO, out);
+			c << "message " << i << " at " << i * 1.5;
+		}
+	}
+
+	Logger::start();
+	io::Output& aout = Logger::open(stream);
+	BENCH("async") {
+		for(int i = 0; i < 100; i++) {
+			Capture c(Logger::INFO, aout);
+			c << "message " << i << " at " << i * 1.5;
+		}
+	}
+	Logger::close(aout);
+	Logger::stop();
+
+	BENCH("filtered") {
+		Logger::setLevel(Logger::WARNING);
+		for(int i = 0; i < 100; i++)
+			if(Logger::isEnabled(Logger::INFO)) {
+				Capture c(Logger::INFO, out);
+				c << "message " << i << " at " << i * 1.5;
+			}
+		Logger::setLevel(Logger::TRACE);
+	}
+
+BENCH_END
@@ -0,0 +1,61 @@
+/*
+ *	io::Output benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/io.h>
+#include <elm/io/BlockOutStream.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+BENCH_BEGIN(output)
+
+	io::BlockOutStream stream(1 << 16);
+	io::Output out(stream);
+
+	BENCH("int") {
+		stream.clear();
+		for(int i = 0; i < 100; i++)
+			out << i * 12345;
+		Benchmark::clobberMemory();
+	}
+
+	BENCH("hex") {
+		stream.clear();
+		for(int i = 0; i < 100; i++)
+			out << io::hex(t::uint32(i * 12345));
+		Benchmark::clobberMemory();
+	}
+
+	BENCH("double") {
+		stream.clear();
+		for(int i = 0; i < 100; i++)
+			out << i * 1.5;
+		Benchmark::clobberMemory();
+	}
+
+	BENCH("string") {
+		stream.clear();
+		for(int i = 0; i < 100; i++)
+			out << "hello, world!";
+		Benchmark::clobberMemory();
+	}
+
+BENCH_END
@@ -0,0 +1,90 @@
+/*
+ *	Process spawning benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <elm/sys/ProcessPool.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::sys;
+
+static const int job_count = 16;
+
+// reference: fork() and execvp()
+static int forkExec(void) {
+	int pid = fork();
+	if(pid == 0) {
+		char *args[] = { (char *)"true", nullptr };
+		execvp(args[0], args);
+		_exit(1);
+	}
+	int status;
+	waitpid(pid, &status, 0);
+	return status;
+}
+
+// spawn with ProcessBuilder
+static int spawn(void) {
+	Process *p = ProcessBuilder("true").run();
+	p->wait();
+	int r = p->returnCode();
+	delete p;
+	return r;
+}
+
+// run job_count processes through a pool
+static int pool(ProcessPool& pool) {
+	Vector<ProcessPool::Job *> jobs;
+	for(int i = 0; i < job_count; i++)
+		jobs.add(pool.submit(ProcessBuilder("true"), false));
+	pool.waitAll();
+	for(auto j: jobs)
+		delete j;
+	return jobs.count();
+}
+
+static const int levels = 2;
+static const int sizes[levels] = { 0, 256 };
+static cstring fork_labels[levels] = { "fork+exec/0MB", "fork+exec/256MB" };
+static cstring spawn_labels[levels] = { "posix_spawn/0MB", "posix_spawn/256MB" };
+static cstring pool_labels[levels] = { "pool x16/0MB", "pool x16/256MB" };
+
+BENCH_BEGIN(process)
+
+	// spawn cost according to the resident memory of the parent
+	ProcessPool p(System::coreCount());
+	int s = 0;
+	for(int l = 0; l < levels; l++) {
+		char *mem = new char[t::size(sizes[l]) << 20];
+		memset(mem, 1, t::size(sizes[l]) << 20);
+		BENCH(fork_labels[l])
+			s += forkExec();
+		BENCH(spawn_labels[l])
+			s += spawn();
+		BENCH(pool_labels[l])
+			s += pool(p);
+		delete [] mem;
+	}
+	Benchmark::doNotOptimize(s);
+
+BENCH_END
@@ -0,0 +1,185 @@
+/*
+ *	Reactor loopback benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/Vector.h>
+#include <elm/net/ClientSocket.h>
+#include <elm/net/Reactor.h>
+#include <elm/net/ServerSocket.h>
+#include <elm/sys/Thread.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::sys;
+
+static const int request_count = 100;
+
+// reference: blocking server, one connection at a time
+class BlockingServer: public net::Server, public Runnable {
+public:
+	void run(void) override { manage(); }
+protected:
+	void onConnection(net::Connection& con) override {
+		char buf[256];
+		int n = 0;
+		while(true) {
+			int r = con.in().read(buf + n, sizeof(buf) - n);
+			if(r <= 0)
+				return;
+			n += r;
+			if(buf[n - 1] == '\n') {
+				if(buf[0] == 'q') {
+					close();
+					return;
+				}
+				con.out().write(buf, n);
+				n = 0;
+			}
+		}
+	}
+};
+
+// event-driven server
+class LineEcho: public net::Channel {
+protected:
+	void onRead(void) override {
+		int s = 0;
+		for(int i = 0; i < available(); i++)
+			if(data()[i] == '\n') {
+				send(data() + s, i + 1 - s);
+				s = i + 1;
+			}
+		consume(s);
+	}
+};
+
+class EventServer: public net::Reactor, public Runnable {
+public:
+	EventServer(int workers) { setWorkers(workers); open(); }
+	void run(void) override { net::Reactor::run(); }
+protected:
+	net::Channel *make(void) override { return new LineEcho(); }
+};
+
+// client connecting and performing request_count round trips
+class Client: public Runnable {
+public:
+	Client(int port): _port(port), sum(0) { }
+	void run(void) override {
+		static const char req[] = "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcde\n";
+		net::ClientSocket *sock = net::ClientSocket::make(_port);
+		sock->connect();
+		char buf[256];
+		for(int i = 0; i < request_count; i++) {
+			sock->out().write(req, sizeof(req) - 1);
+			int n = 0;
+			while(n == 0 || buf[n - 1] != '\n') {
+				int r = sock->in().read(buf + n, sizeof(buf) - n);
+				if(r <= 0)
+					break;
+				n += r;
+			}
+			sum += n;
+		}
+		sock->disconnect();
+		delete sock;
+	}
+	t::int64 result(void) const { return sum; }
+private:
+	int _port;
+	t::int64 sum;
+};
+
+// run the given number of clients at the same time
+class Load {
+public:
+	Load(int port, int clients) {
+		for(int i = 0; i < clients; i++) {
+			_cs.add(new Client(port));
+			_ts.add(Thread::make(*_cs[i]));
+		}
+	}
+	~Load(void) {
+		for(int i = 0; i < _cs.count(); i++) {
+			delete _ts[i];
+			delete _cs[i];
+		}
+	}
+	t::int64 operator()(void) {
+		for(auto t: _ts)
+			t->start();
+		t::int64 s = 0;
+		for(int i = 0; i < _ts.count(); i++) {
+			_ts[i]->join();
+			s += _cs[i]->result();
+		}
+		return s;
+	}
+private:
+	Vector<Client *> _cs;
+	Vector<Thread *> _ts;
+};
+
+static const int levels = 3;
+static const int clients[levels] = { 1, 4, 16 };
+static cstring blocking_labels[levels] = { "Server/1", "Server/4", "Server/16" };
+static cstring event_labels[levels] = { "Reactor/1", "Reactor/4", "Reactor/16" };
+static cstring worker_labels[levels] = { "Reactor+4 workers/1", "Reactor+4 workers/4", "Reactor+4 workers/16" };
+
+BENCH_BEGIN(reactor)
+
+	// each iteration runs 1 to 16 clients performing request_count round trips
+	BlockingServer blocking;
+	blocking.open();
+	Thread *bt = Thread::make(blocking);
+	bt->start();
+	EventServer event(0), workers(4);
+	Thread *et = Thread::make(event), *wt = Thread::make(workers);
+	et->start();
+	wt->start();
+
+	t::int64 s = 0;
+	for(int l = 0; l < levels; l++) {
+		Load bl(blocking.port(), clients[l]);
+		BENCH(blocking_labels[l])
+			s += bl();
+		Load el(event.port(), clients[l]);
+		BENCH(event_labels[l])
+			s += el();
+		Load wl(workers.port(), clients[l]);
+		BENCH(worker_labels[l])
+			s += wl();
+	}
+	Benchmark::doNotOptimize(s);
+
+	net::ClientSocket *q = net::ClientSocket::make(blocking.port());
+	q->connect();
+	q->out().write("q\n", 2);
+	bt->join();
+	delete q;
+	delete bt;
+	event.net::Reactor::stop();
+	workers.net::Reactor::stop();
+	et->join();
+	wt->join();
+	delete et;
+	delete wt;
+
+BENCH_END
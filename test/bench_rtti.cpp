@@ -0,0 +1,69 @@
+/*
+ *	rtti module benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/rtti.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+class Point {
+public:
+	static rtti::Class<Point> __type;
+	Point(void): x(0), y(0) { }
+	int dot(int a, int b) const { return x * a + y * b; }
+	int x, y;
+};
+
+rtti::Class<Point> Point::__type(rtti::make("Point")
+	.op("dot", &Point::dot));
+
+BENCH_BEGIN(rtti)
+
+	Point p;
+	p.x = 3;
+	p.y = 4;
+	const rtti::Operation& op = *Point::__type.operation("dot", 3);
+	rtti::CallSite<const Point *, int, int> site(op);
+	int a = 1;
+
+	BENCH("Operation::call") {
+		Vector<Variant> args;
+		args.add(&p);
+		args.add(a);
+		args.add(2);
+		Benchmark::doNotOptimize(op.call(args).as<int>());
+	}
+
+	BENCH("CallSite") {
+		Benchmark::doNotOptimize(site(&p, a, 2).as<int>());
+	}
+
+	BENCH("lookup+CallSite") {
+		rtti::CallSite<const Point *, int, int> s(Point::__type, "dot");
+		Benchmark::doNotOptimize(s(&p, a, 2).as<int>());
+	}
+
+	string name = "Point";
+	BENCH("Type::get") {
+		Benchmark::doNotOptimize(rtti::Type::get(name));
+	}
+
+BENCH_END
@@ -0,0 +1,63 @@
+/*
+ *	sort benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/quicksort.h>
+#include <elm/data/radixsort.h>
+#include <elm/data/Vector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+BENCH_BEGIN(sort)
+
+	static const int N = 1 << 16;
+	Vector<t::uint32> init, v;
+	t::uint32 s = 1;
+	for(int i = 0; i < N; i++) {
+		s = s * 1103515245 + 12345;
+		init.add(s);
+	}
+
+	BENCH("quicksort") {
+		v.copy(init);
+		quicksort(v);
+		Benchmark::doNotOptimize(v[0]);
+	}
+
+	BENCH("radixsort") {
+		v.copy(init);
+		radixsort(v);
+		Benchmark::doNotOptimize(v[0]);
+	}
+
+	BENCH("msdRadixsort") {
+		v.copy(init);
+		msdRadixsort(v);
+		Benchmark::doNotOptimize(v[0]);
+	}
+
+	BENCH("parallelRadixsort") {
+		v.copy(init);
+		parallelRadixsort(v);
+		Benchmark::doNotOptimize(v[0]);
+	}
+
+BENCH_END
@@ -0,0 +1,76 @@
+/*
+ *	stree module benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/stree/IntervalTree.h>
+#include <elm/stree/SegmentBuilder.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::stree;
+
+typedef t::uint32 addr_t;
+
+static const int segment_count = 1 << 16;
+static const int key_count = 1 << 16;
+
+BENCH_BEGIN(stree)
+
+	// build the segments
+	SegmentBuilder<addr_t, int> builder(-1);
+	IntervalTree<addr_t, int> itree;
+	for(int i = 0; i < segment_count; i++) {
+		addr_t a = addr_t(i) * 64;
+		builder.add(a, a + 48, i);
+		itree.add(a, a + 48, i);
+	}
+	Tree<addr_t, int> tree;
+	builder.make(tree);
+	FlatTree<addr_t, int> ftree;
+	builder.make(ftree);
+
+	// pseudo-random keys
+	addr_t *keys = new addr_t[key_count];
+	t::uint32 x = 123456789;
+	for(int i = 0; i < key_count; i++) {
+		x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+		keys[i] = x % ((segment_count - 1) * 64);
+	}
+
+	// each iteration performs a look-up
+	t::int64 sum = 0;
+	int i = 0;
+	BENCH("Tree::get")
+		sum += tree.get(keys[i++ & (key_count - 1)], -1);
+	BENCH("FlatTree::get")
+		sum += ftree.get(keys[i++ & (key_count - 1)], -1);
+	BENCH("IntervalTree::get")
+		sum += itree.get(keys[i++ & (key_count - 1)], -1);
+
+	// each iteration removes and adds back a segment
+	BENCH("IntervalTree::remove+add") {
+		int k = i++ & (segment_count - 1);
+		itree.remove(addr_t(k) * 64, addr_t(k) * 64 + 48);
+		itree.add(addr_t(k) * 64, addr_t(k) * 64 + 48, k);
+	}
+	Benchmark::doNotOptimize(sum);
+	delete [] keys;
+
+BENCH_END
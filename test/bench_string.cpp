@@ -0,0 +1,55 @@
+/*
+ *	String benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/string.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+BENCH_BEGIN(string)
+
+	string s = "the quick brown fox jumps over the lazy dog";
+	string t = "the quick brown fox jumps over the lazy cat";
+
+	BENCH("concat") {
+		string r = s + t;
+		Benchmark::doNotOptimize(r.length());
+	}
+
+	BENCH("compare") {
+		Benchmark::doNotOptimize(s.compare(t));
+	}
+
+	BENCH("indexOf") {
+		Benchmark::doNotOptimize(s.indexOf('z'));
+	}
+
+	BENCH("substring") {
+		string r = s.substring(4, 15);
+		Benchmark::doNotOptimize(r.length());
+	}
+
+	BENCH("build") {
+		string r = _ << "item " << 12345 << ": " << s;
+		Benchmark::doNotOptimize(r.length());
+	}
+
+BENCH_END
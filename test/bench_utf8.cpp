@@ -0,0 +1,71 @@
+/*
+ *	UTF-8 benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/string/utf8.h>
+#include <elm/string/StringBuffer.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+BENCH_BEGIN(utf8)
+
+	// mostly ASCII text with some accented characters
+	StringBuffer sb;
+	for(int i = 0; i < 1000; i++)
+		sb << "annotation: loop bound " << i << " for caf\xc3\xa9 \xe2\x82\xac\n";
+	string s = sb.toString();
+	t::uint16 *u16 = new t::uint16[s.length()];
+	utf8::char_t *u32 = new utf8::char_t[s.length()];
+
+	BENCH("iter/count") {
+		t::size n = 0;
+		for(utf8::Iter i(s); i(); i++)
+			n++;
+		Benchmark::doNotOptimize(n);
+	}
+
+	BENCH("count") {
+		Benchmark::doNotOptimize(utf8::count(s));
+	}
+
+	BENCH("isValid") {
+		Benchmark::doNotOptimize(utf8::isValid(s));
+	}
+
+	BENCH("iter/toUTF32") {
+		t::size n = 0;
+		for(utf8::Iter i(s); i(); i++)
+			u32[n++] = *i;
+		Benchmark::doNotOptimize(n);
+	}
+
+	BENCH("toUTF32") {
+		Benchmark::doNotOptimize(utf8::toUTF32(s, u32));
+	}
+
+	BENCH("toUTF16") {
+		Benchmark::doNotOptimize(utf8::toUTF16(s, u16));
+	}
+
+	delete [] u16;
+	delete [] u32;
+
+BENCH_END
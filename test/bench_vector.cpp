@@ -0,0 +1,65 @@
+/*
+ *	Vector benchmark
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/Vector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+static const int size = 1 << 12;
+
+BENCH_BEGIN(vector)
+
+	BENCH("add") {
+		Vector<int> v;
+		for(int i = 0; i < size; i++)
+			v.add(i);
+		Benchmark::doNotOptimize(v[size - 1]);
+	}
+
+	Vector<int> v;
+	for(int i = 0; i < size; i++)
+		v.add(i);
+
+	BENCH("index") {
+		int s = 0;
+		for(int i = 0; i < size; i++)
+			s += v[i];
+		Benchmark::doNotOptimize(s);
+	}
+
+	BENCH("iterate") {
+		int s = 0;
+		for(auto x: v)
+			s += x;
+		Benchmark::doNotOptimize(s);
+	}
+
+	BENCH("contains") {
+		Benchmark::doNotOptimize(v.contains(size / 2));
+	}
+
+	BENCH("copy") {
+		Vector<int> w(v);
+		Benchmark::doNotOptimize(w[0]);
+	}
+
+BENCH_END
@@ -0,0 +1,169 @@
+/*
+ *	Cache class test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/Cache.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+typedef Cache<int, int> cache_t;
+static int live = 0;
+
+class Value {
+public:
+	Value(int x): v(x) { live++; }
+	~Value(void) { live--; }
+	int v;
+};
+
+TEST_BEGIN(cache)
+
+	// LRU
+	{
+		cache_t c(3);
+		CHECK(c.isEmpty());
+		CHECK(c.policy() == cache_t::LRU);
+		c.put(1, 10);
+		c.put(2, 20);
+		c.put(3, 30);
+		CHECK_EQUAL(c.count(), 3);
+		CHECK_EQUAL(c.used(), t::size(3));
+		CHECK_EQUAL(*c.get(1), 10);
+		c.put(4, 40);
+		CHECK_EQUAL(c.count(), 3);
+		CHECK(c.hasKey(1));
+		CHECK(!c.hasKey(2));
+		CHECK(c.hasKey(3));
+		CHECK(c.hasKey(4));
+		CHECK(c.get(2).none());
+		CHECK_EQUAL(c.hits(), t::uint64(1));
+		CHECK_EQUAL(c.misses(), t::uint64(1));
+		CHECK_EQUAL(c.evictions(), t::uint64(1));
+		c.put(3, 33);
+		CHECK_EQUAL(c.count(), 3);
+		CHECK_EQUAL(*c.get(3), 33);
+		CHECK(c.remove(4));
+		CHECK(!c.remove(4));
+		CHECK_EQUAL(c.count(), 2);
+		c.setBudget(1);
+		CHECK_EQUAL(c.count(), 1);
+		CHECK(c.hasKey(3));
+		c.resetStats();
+		CHECK_EQUAL(c.hits(), t::uint64(0));
+		c.clear();
+		CHECK(c.isEmpty());
+		CHECK_EQUAL(c.used(), t::size(0));
+	}
+
+	// CLOCK
+	{
+		cache_t c(3, cache_t::CLOCK);
+		c.put(1, 10);
+		c.put(2, 20);
+		c.put(3, 30);
+		c.get(1);
+		c.put(4, 40);
+		CHECK(c.hasKey(1));
+		CHECK(!c.hasKey(2));
+		c.put(5, 50);
+		CHECK(!c.hasKey(3));
+		CHECK(c.hasKey(1));
+		CHECK_EQUAL(c.evictions(), t::uint64(2));
+	}
+
+	// size-weighted with cost budget
+	{
+		cache_t c(100, cache_t::SIZE);
+		c.setCost([](int k, int v) { return t::size(v); });
+		c.put(1, 10);
+		c.put(2, 50);
+		c.put(3, 20);
+		c.put(4, 15);
+		CHECK_EQUAL(c.used(), t::size(95));
+		c.put(5, 10);
+		CHECK(!c.hasKey(2));
+		CHECK(c.hasKey(1));
+		CHECK_EQUAL(c.used(), t::size(55));
+		c.put(6, 200);
+		CHECK(c.hasKey(6));
+		CHECK_EQUAL(c.count(), 1);
+		c.put(7, 10);
+		CHECK(!c.hasKey(6));
+		CHECK(c.used() <= 100);
+	}
+
+	// memoization
+	{
+		cache_t c(100);
+		int calls = 0;
+		auto f = [&calls](int k) { calls++; return k * k; };
+		for(int i = 0; i < 10; i++)
+			for(int j = 0; j < 10; j++)
+				c.getOrCompute(j, f);
+		CHECK_EQUAL(calls, 10);
+		CHECK_EQUAL(c.getOrCompute(7, f), 49);
+		CHECK_EQUAL(c.misses(), t::uint64(10));
+		CHECK_EQUAL(c.hits(), t::uint64(91));
+	}
+
+	// cleaning
+	{
+		{
+			Cache<int, Value *> c(2);
+			c.setCleaner([](int k, Value *v) { return new Deletor<Value>(v); });
+			for(int i = 0; i < 10; i++)
+				c.getOrCompute(i, [](int k) { return new Value(k); });
+			CHECK_EQUAL(live, 2);
+			c.put(9, new Value(90));
+			CHECK_EQUAL(live, 2);
+			CHECK_EQUAL((*c.get(9))->v, 90);
+			Value *v = new Value(100);
+			c.put(100, v, new Deletor<Value>(v));
+			CHECK_EQUAL(live, 2);
+			c.remove(100);
+			CHECK_EQUAL(live, 1);
+		}
+		CHECK_EQUAL(live, 0);
+	}
+
+	// an added entry is never evicted by its own addition
+	{
+		{
+			Cache<int, Value *> c(10, Cache<int, Value *>::SIZE);
+			c.setCost([](int k, Value *v) { return t::size(v->v); });
+			c.setCleaner([](int k, Value *v) { return new Deletor<Value>(v); });
+			c.getOrCompute(1, [](int k) { return new Value(3); });
+			Value *v = c.getOrCompute(2, [](int k) { return new Value(20); });
+			CHECK(c.hasKey(2));
+			CHECK(!c.hasKey(1));
+			CHECK_EQUAL(v->v, 20);
+			CHECK_EQUAL(live, 1);
+			c.put(2, v);
+			CHECK_EQUAL(live, 1);
+			CHECK_EQUAL((*c.get(2))->v, 20);
+			v = c.getOrCompute(3, [](int k) { return new Value(4); });
+			CHECK_EQUAL(v->v, 4);
+			CHECK_EQUAL(live, 1);
+		}
+		CHECK_EQUAL(live, 0);
+	}
+
+TEST_END
@@ -0,0 +1,99 @@
+/*
+ *	checksum::CRC32C and checksum::XXHash64 test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/checksum/CRC32C.h>
+#include <elm/checksum/MD5.h>
+#include <elm/checksum/XXHash64.h>
+#include <elm/array.h>
+#include <elm/compare.h>
+#include <elm/hash.h>
+#include <elm/io/BlockInStream.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::checksum;
+
+TEST_BEGIN(checksum)
+
+	// random buffer
+	const int size = 3000;
+	t::uint8 buf[size];
+	t::uint32 x = 0x1234567;
+	for(int i = 0; i < size; i++) {
+		x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+		buf[i] = x;
+	}
+
+	// CRC32C
+	{
+		CRC32C crc;
+		crc << "123456789";
+		CHECK_EQUAL(crc.sum(), t::uint32(0xE3069283));
+		crc.reset();
+		CHECK_EQUAL(crc.sum(), t::uint32(0));
+		bool ok = true;
+		for(int i = 0; i < 64; i++)
+			ok = ok && CRC32C::update(0xffffffff, buf + i, size - 2 * i)
+				== CRC32C::updateTable(0xffffffff, buf + i, size - 2 * i);
+		CHECK(ok);
+		crc.put(buf, 13);
+		crc.put(buf + 13, size - 13);
+		CHECK_EQUAL(crc.sum(), ~CRC32C::update(0xffffffff, buf, size));
+	}
+
+	// XXHash64
+	{
+		CHECK_EQUAL(XXHash64::hash("", 0), t::uint64(0xEF46DB3751D8E999ULL));
+		CHECK_EQUAL(XXHash64::hash("abc", 3), t::uint64(0x44BC2CF5AD770999ULL));
+		CHECK(XXHash64::hash("abc", 3, 1) != XXHash64::hash("abc", 3));
+		XXHash64 h;
+		h << "abc";
+		CHECK_EQUAL(h.digest(), t::uint64(0x44BC2CF5AD770999ULL));
+		bool ok = true;
+		const int chunks[] = { 1, 7, 31, 32, 33, 100 };
+		for(int c = 0; c < 6; c++) {
+			h.reset(c);
+			for(int i = 0; i < size; i += chunks[c])
+				h.put(buf + i, min(chunks[c], size - i));
+			ok = ok && h.digest() == XXHash64::hash(buf, size, c);
+		}
+		CHECK(ok);
+	}
+
+	// MD5 of large blocks
+	{
+		MD5 m1, m2;
+		m1.put(buf, size);
+		io::BlockInStream in(buf, size);
+		m2.put(in);
+		MD5::digest_t d1, d2;
+		m1.digest(d1);
+		m2.digest(d2);
+		CHECK(array::equals(d1, d2, 16));
+	}
+
+	// string hashing
+	{
+		CHECK_EQUAL(HashKey<String>::hash("hello, world"), HashKey<CString>::hash("hello, world"));
+		CHECK(HashKey<String>::hash("hello, world") != HashKey<String>::hash("hello, World"));
+	}
+
+TEST_END
@@ -0,0 +1,133 @@
+/*
+ *	ColumnTable class test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/ColumnTable.h>
+#include <elm/string.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+typedef ColumnTable<int, double, char> table_t;
+
+TEST_BEGIN(column_table)
+
+	// filling
+	{
+		table_t t(4);
+		CHECK(t.isEmpty());
+		CHECK_EQUAL(t.count(), 0);
+		CHECK_EQUAL(t.pageSize(), 16);
+		for(int i = 0; i < 100; i++)
+			CHECK_EQUAL(t.add(i, i * .5, char('a' + i % 26)), i);
+		CHECK_EQUAL(t.count(), 100);
+		CHECK_EQUAL(t.pageCount(), 7);
+		CHECK_EQUAL(t.pageLength(6), 4);
+		bool ok = true;
+		for(int i = 0; i < 100; i++)
+			ok = ok && t.get<0>(i) == i && t.get<1>(i) == i * .5 && t.get<2>(i) == 'a' + i % 26;
+		CHECK(ok);
+		t.set<1>(50, -1.);
+		CHECK_EQUAL(t.get<1>(50), -1.);
+		CHECK_EQUAL(t.get<0>(50), 50);
+
+		// columns are aligned and contiguous
+		for(int p = 0; p < t.pageCount(); p++) {
+			CHECK_EQUAL(t::intptr(t.column<0>(p)) % table_t::ALIGN, t::intptr(0));
+			CHECK_EQUAL(t::intptr(t.column<1>(p)) % table_t::ALIGN, t::intptr(0));
+			CHECK_EQUAL(t.column<0>(p)[3], p * 16 + 3);
+		}
+
+		// shrinking and allocation
+		t.shrink(40);
+		CHECK_EQUAL(t.count(), 40);
+		CHECK_EQUAL(t.pageCount(), 3);
+		CHECK_EQUAL(t.alloc(30), 40);
+		CHECK_EQUAL(t.count(), 70);
+		t.set<0>(69, 69);
+		CHECK_EQUAL(t.get<0>(69), 69);
+		t.shrink(32);
+		CHECK_EQUAL(t.pageCount(), 2);
+		CHECK_EQUAL(t.pageLength(1), 16);
+		t.clear();
+		CHECK(t.isEmpty());
+	}
+
+	// scans
+	{
+		table_t t(6);
+		for(int i = 0; i < 1000; i++)
+			t.add(i, i % 7, 'x');
+
+		int sum = 0, rows = 0;
+		t.forEachPage([&](const table_t::Page& p) {
+			const int *c = p.column<0>();
+			for(int i = 0; i < p.length(); i++)
+				sum += c[i];
+			rows += p.length();
+			CHECK_EQUAL(c[0], p.base());
+		});
+		CHECK_EQUAL(sum, 999 * 1000 / 2);
+		CHECK_EQUAL(rows, 1000);
+
+		double dsum = 0;
+		t.scan<1>([&](const double *c, int n, int base) {
+			for(int i = 0; i < n; i++)
+				dsum += c[i];
+		});
+		double exp = 0;
+		for(int i = 0; i < 1000; i++)
+			exp += i % 7;
+		CHECK_EQUAL(dsum, exp);
+
+		Vector<int> sel;
+		t.select<1>([](double x) { return x == 3; }, sel);
+		CHECK_EQUAL(sel.count(), 143);
+		bool ok = true;
+		for(auto r: sel)
+			ok = ok && r % 7 == 3;
+		CHECK(ok);
+
+		// parallel scan
+		sys::Atomic<int> psum(0), pages(0);
+		t.forEachPageParallel([&](const table_t::Page& p) {
+			int s = 0;
+			const int *c = p.column<0>();
+			for(int i = 0; i < p.length(); i++)
+				s += c[i];
+			psum.fetchAdd(s);
+			pages.fetchAdd(1);
+		}, 4);
+		CHECK_EQUAL(psum.load(), 999 * 1000 / 2);
+		CHECK_EQUAL(pages.load(), t.pageCount());
+	}
+
+	// non-trivial columns
+	{
+		ColumnTable<string, int> t(2);
+		for(int i = 0; i < 10; i++)
+			t.add(_ << "s" << i, i);
+		CHECK_EQUAL(t.get<0>(7), string("s7"));
+		t.shrink(3);
+		CHECK_EQUAL(t.count(), 3);
+		CHECK_EQUAL(t.get<0>(2), string("s2"));
+	}
+
+TEST_END
@@ -0,0 +1,545 @@
+/*
+ *	concur module test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <thread>
+#include <elm/concur.h>
+#include <elm/sys/Thread.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::concur;
+using namespace elm::sys;
+
+static const int item_count = 200000;
+static const int producers = 4;
+
+// generic producer and consumer
+template <class Q>
+class Producer: public Runnable {
+public:
+	Producer(Q& queue, int id = 0, int n = item_count): q(queue), _id(id), _n(n) { }
+	void run(void) override {
+		for(int i = 0; i < _n; i++) {
+			int x = _id * _n + i;
+			while(!q.put(x))
+				std::this_thread::yield();
+		}
+	}
+private:
+	Q& q;
+	int _id, _n;
+};
+
+template <class Q>
+class Consumer: public Runnable {
+public:
+	Consumer(Q& queue, int n): q(queue), _n(n), sum(0), ordered(true), last(-1) { }
+	void run(void) override {
+		for(int i = 0; i < _n; i++) {
+			int x;
+			while(!q.get(x))
+				std::this_thread::yield();
+			sum += x;
+			if(x <= last)
+				ordered = false;
+			last = x;
+		}
+	}
+	Q& q;
+	int _n;
+	t::int64 sum;
+	bool ordered;
+	int last;
+};
+
+template <class Q>
+class BlockingConsumer: public Runnable {
+public:
+	BlockingConsumer(Q& queue): q(queue), sum(0), n(0) { }
+	void run(void) override {
+		int x;
+		while(q.get(x)) {
+			sum += x;
+			n++;
+		}
+	}
+	Q& q;
+	t::int64 sum;
+	int n;
+};
+
+static t::int64 sum(int n) { return t::int64(n) * (n - 1) / 2; }
+
+// concurrent map users
+typedef ConcurrentHashMap<int, int> map_t;
+static const int keys = 20000;
+static Atomic<int> computed;
+
+class Computer: public Runnable {
+public:
+	Computer(map_t& map, int id): m(map), _id(id), ok(true) { }
+	void run(void) override {
+		for(int i = 0; i < keys; i++) {
+			int k = (i + _id * 97) % keys;
+			int v = m.getOrCompute(k, [](int k) { computed++; return 2 * k; });
+			if(v != 2 * k)
+				ok = false;
+			if(i % 64 == 0)
+				std::this_thread::yield();
+		}
+	}
+	bool isOk(void) const { return ok; }
+private:
+	map_t& m;
+	int _id;
+	bool ok;
+};
+
+// value counting its living instances
+static Atomic<int> counted_live(0);
+class Counted {
+public:
+	Counted(int x = 0): v(x) { counted_live.fetchAdd(1); }
+	Counted(const Counted& c): v(c.v) { counted_live.fetchAdd(1); }
+	~Counted(void) { counted_live.fetchAdd(-1); }
+	Counted& operator=(const Counted& c) { v = c.v; return *this; }
+	int v;
+};
+
+class Mutator: public Runnable {
+public:
+	Mutator(map_t& map, int id): m(map), _id(id) { }
+	void run(void) override {
+		for(int i = 0; i < keys; i++) {
+			int k = _id * keys + i;
+			m.put(k, k + 1);
+			if(i % 2 == 1)
+				m.remove(k - 1);
+			if(i % 64 == 0)
+				std::this_thread::yield();
+		}
+	}
+private:
+	map_t& m;
+	int _id;
+};
+
+// sharded cache user
+typedef ShardedCache<int, int> cache_t;
+static Atomic<int> cached_live(0);
+
+class CachedValue {
+public:
+	CachedValue(int x): v(x) { cached_live.fetchAdd(1); }
+	~CachedValue(void) { cached_live.fetchAdd(-1); }
+	int v;
+};
+
+class CacheUser: public Runnable {
+public:
+	CacheUser(cache_t& cache, int id): c(cache), _id(id), ok(true) { }
+	void run(void) override {
+		for(int i = 0; i < keys; i++) {
+			int k = (i * 7 + _id) % (keys / 4);
+			if(c.getOrCompute(k, [](int k) { return k + 1; }) != k + 1)
+				ok = false;
+			if(i % 64 == 0)
+				std::this_thread::yield();
+		}
+	}
+	bool isOk(void) const { return ok; }
+private:
+	cache_t& c;
+	int _id;
+	bool ok;
+};
+
+TEST_BEGIN(concur)
+
+	// SPSC single thread
+	{
+		SPSCQueue<int> q(5);
+		CHECK_EQUAL(q.capacity(), 8);
+		CHECK(q.isEmpty());
+		bool ok = true;
+		for(int i = 0; i < 8; i++)
+			ok = ok && q.put(i);
+		CHECK(ok);
+		CHECK(!q.put(8));
+		CHECK_EQUAL(q.size(), 8);
+		int x, s = 0;
+		for(int i = 0; i < 8; i++) {
+			ok = ok && q.get(x);
+			s += x;
+		}
+		CHECK(ok);
+		CHECK_EQUAL(s, 28);
+		CHECK(!q.get(x));
+		CHECK(q.isEmpty());
+	}
+
+	// SPSC two threads
+	{
+		SPSCQueue<int> q(256);
+		Producer<SPSCQueue<int> > p(q);
+		Consumer<SPSCQueue<int> > c(q, item_count);
+		Thread *pt = Thread::make(p), *ct = Thread::make(c);
+		ct->start();
+		pt->start();
+		pt->join();
+		ct->join();
+		CHECK(c.ordered);
+		CHECK_EQUAL(c.sum, sum(item_count));
+		CHECK(q.isEmpty());
+		delete pt;
+		delete ct;
+	}
+
+	// MPMC single thread
+	{
+		MPMCQueue<int> q(4);
+		CHECK_EQUAL(q.capacity(), 4);
+		for(int i = 0; i < 4; i++)
+			q.put(i);
+		CHECK(!q.put(4));
+		int x;
+		CHECK(q.get(x) && x == 0);
+		CHECK(q.put(4));
+		for(int i = 1; i < 5; i++)
+			q.get(x);
+		CHECK_EQUAL(x, 4);
+		CHECK(q.isEmpty());
+	}
+
+	// MPMC several threads
+	{
+		typedef MPMCQueue<int> queue_t;
+		queue_t q(1024);
+		int n = item_count / producers;
+		Producer<queue_t> *ps[producers];
+		Consumer<queue_t> *cs[producers];
+		Thread *pts[producers], *cts[producers];
+		for(int i = 0; i < producers; i++) {
+			ps[i] = new Producer<queue_t>(q, i, n);
+			cs[i] = new Consumer<queue_t>(q, n);
+			pts[i] = Thread::make(*ps[i]);
+			cts[i] = Thread::make(*cs[i]);
+		}
+		for(int i = 0; i < producers; i++) {
+			cts[i]->start();
+			pts[i]->start();
+		}
+		t::int64 s = 0;
+		for(int i = 0; i < producers; i++) {
+			pts[i]->join();
+			cts[i]->join();
+			s += cs[i]->sum;
+			delete pts[i];
+			delete cts[i];
+			delete ps[i];
+			delete cs[i];
+		}
+		CHECK_EQUAL(s, sum(n * producers));
+		CHECK(q.isEmpty());
+	}
+
+	// MPSC several producers
+	{
+		typedef MPSCQueue<int> queue_t;
+		queue_t q;
+		int x;
+		CHECK(q.isEmpty());
+		CHECK(!q.get(x));
+		int n = item_count / producers;
+		Producer<queue_t> *ps[producers];
+		Thread *pts[producers];
+		for(int i = 0; i < producers; i++) {
+			ps[i] = new Producer<queue_t>(q, i, n);
+			pts[i] = Thread::make(*ps[i]);
+			pts[i]->start();
+		}
+		int last[producers];
+		for(int i = 0; i < producers; i++)
+			last[i] = -1;
+		bool ordered = true;
+		t::int64 s = 0;
+		for(int i = 0; i < n * producers; i++) {
+			while(!q.get(x))
+				std::this_thread::yield();
+			s += x;
+			int p = x / n;
+			if(x <= last[p])
+				ordered = false;
+			last[p] = x;
+		}
+		for(int i = 0; i < producers; i++) {
+			pts[i]->join();
+			delete pts[i];
+			delete ps[i];
+		}
+		CHECK(ordered);
+		CHECK_EQUAL(s, sum(n * producers));
+		CHECK(q.isEmpty());
+	}
+
+	// blocking queue
+	{
+		typedef BlockingQueue<SPSCQueue<int> > queue_t;
+		queue_t q(16);
+		CHECK(q.isEmpty());
+		CHECK(!q.isClosed());
+		BlockingConsumer<queue_t> c(q);
+		Thread *ct = Thread::make(c);
+		ct->start();
+		bool ok = true;
+		for(int i = 0; i < item_count; i++)
+			ok = ok && q.put(i);
+		q.close();
+		ct->join();
+		delete ct;
+		CHECK(ok);
+		CHECK_EQUAL(c.n, item_count);
+		CHECK_EQUAL(c.sum, sum(item_count));
+		CHECK(!q.put(0));
+		int x;
+		CHECK(!q.get(x));
+	}
+
+	// blocking queue with several producers
+	{
+		typedef BlockingQueue<MPSCQueue<int> > queue_t;
+		queue_t q;
+		BlockingConsumer<queue_t> c(q);
+		Thread *ct = Thread::make(c);
+		ct->start();
+		int n = item_count / producers;
+		Producer<queue_t> *ps[producers];
+		Thread *pts[producers];
+		for(int i = 0; i < producers; i++) {
+			ps[i] = new Producer<queue_t>(q, i, n);
+			pts[i] = Thread::make(*ps[i]);
+			pts[i]->start();
+		}
+		for(int i = 0; i < producers; i++) {
+			pts[i]->join();
+			delete pts[i];
+			delete ps[i];
+		}
+		q.close();
+		ct->join();
+		delete ct;
+		CHECK_EQUAL(c.n, n * producers);
+		CHECK_EQUAL(c.sum, sum(n * producers));
+	}
+
+	// concurrent hash map, sequential use
+	{
+		map_t m;
+		CHECK(m.isEmpty());
+		CHECK(!m.hasKey(0));
+		CHECK_EQUAL(m.get(0, -1), -1);
+		for(int i = 0; i < keys; i++)
+			m.put(i, i);
+		CHECK_EQUAL(m.count(), keys);
+		CHECK(m.capacity() >= keys);
+		bool ok = true;
+		for(int i = 0; i < keys; i++)
+			ok = ok && m.get(i, -1) == i;
+		CHECK(ok);
+		m.put(10, 100);
+		CHECK_EQUAL(*m.get(10), 100);
+		CHECK_EQUAL(m.count(), keys);
+		CHECK(m.remove(10));
+		CHECK(!m.remove(10));
+		CHECK(m.get(10).none());
+		CHECK_EQUAL(m.count(), keys - 1);
+		t::int64 s = 0;
+		int n = 0;
+		m.forEach([&](int k, int v) { s += v; n++; });
+		CHECK_EQUAL(n, keys - 1);
+		CHECK_EQUAL(s, sum(keys) - 10);
+		m.clear();
+		CHECK(m.isEmpty());
+		CHECK(!m.hasKey(1));
+	}
+
+	// concurrent hash map, failing computation
+	{
+		map_t m;
+		bool thrown = false;
+		try {
+			m.getOrCompute(1, [](int k) -> int { throw k; });
+		}
+		catch(int k) {
+			thrown = k == 1;
+		}
+		CHECK(thrown);
+		CHECK(!m.hasKey(1));
+		CHECK(m.isEmpty());
+		CHECK_EQUAL(m.getOrCompute(1, [](int k) { return k + 1; }), 2);
+		CHECK_EQUAL(m.getOrCompute(1, [](int k) { return k + 2; }), 2);
+	}
+
+	// concurrent hash map, racing computations
+	{
+		map_t m;
+		computed = 0;
+		Computer *cs[producers];
+		Thread *cts[producers];
+		for(int i = 0; i < producers; i++) {
+			cs[i] = new Computer(m, i);
+			cts[i] = Thread::make(*cs[i]);
+			cts[i]->start();
+		}
+		bool ok = true;
+		for(int i = 0; i < producers; i++) {
+			cts[i]->join();
+			ok = ok && cs[i]->isOk();
+			delete cts[i];
+			delete cs[i];
+		}
+		CHECK(ok);
+		CHECK_EQUAL(int(computed), keys);
+		CHECK_EQUAL(m.count(), keys);
+	}
+
+	// concurrent hash map, reclamation of removed and replaced nodes
+	{
+		ConcurrentHashMap<int, Counted> m;
+		for(int i = 0; i < 100000; i++) {
+			m.put(i % 100, Counted(i));
+			if(i % 3 == 0)
+				m.remove((i + 50) % 100);
+		}
+		typedef ConcurrentHashMap<int, Counted> cmap_t;
+		CHECK(counted_live.load() < 4 * cmap_t::RECLAIM);
+		int n = 0;
+		m.forEach([&](int k, const Counted& c) { n++; });
+		CHECK_EQUAL(n, m.count());
+		m.clear();
+		CHECK_EQUAL(counted_live.load(), 0);
+	}
+
+	// concurrent hash map, each key visited once during a resize
+	{
+		map_t m;
+		bool once = true;
+		for(int i = 0; i < keys; i++) {
+			m.put(i, i);
+			if(i % 97 == 0) {
+				int n = 0;
+				m.forEach([&](int k, int v) { n++; });
+				once = once && n == i + 1;
+			}
+		}
+		CHECK(once);
+	}
+
+	// concurrent hash map, racing updates
+	{
+		map_t m;
+		Mutator *ms[producers];
+		Thread *mts[producers];
+		for(int i = 0; i < producers; i++) {
+			ms[i] = new Mutator(m, i);
+			mts[i] = Thread::make(*ms[i]);
+			mts[i]->start();
+		}
+		for(int i = 0; i < producers; i++) {
+			mts[i]->join();
+			delete mts[i];
+			delete ms[i];
+		}
+		CHECK_EQUAL(m.count(), producers * keys / 2);
+		bool ok = true;
+		for(int i = 0; i < producers * keys; i++)
+			ok = ok && m.get(i, -1) == (i % 2 == 1 ? i + 1 : -1);
+		CHECK(ok);
+	}
+
+	// sharded cache
+	{
+		cache_t c(1000);
+		CHECK_EQUAL(c.shards(), int(cache_t::SHARDS));
+		CHECK_EQUAL(c.budget(), t::size(1000));
+		c.put(1, 2);
+		CHECK_EQUAL(*c.get(1), 2);
+		CHECK(c.remove(1));
+		c.resetStats();
+		CacheUser *us[producers];
+		Thread *uts[producers];
+		for(int i = 0; i < producers; i++) {
+			us[i] = new CacheUser(c, i);
+			uts[i] = Thread::make(*us[i]);
+			uts[i]->start();
+		}
+		bool ok = true;
+		for(int i = 0; i < producers; i++) {
+			uts[i]->join();
+			ok = ok && us[i]->isOk();
+			delete uts[i];
+			delete us[i];
+		}
+		CHECK(ok);
+		CHECK(c.used() <= 1000);
+		CHECK(c.hits() + c.misses() >= t::uint64(producers * keys));
+		CHECK(c.evictions() > 0);
+		c.clear();
+		CHECK(c.isEmpty());
+	}
+
+	// sharded cache with small budget
+	{
+		cache_t c(4);
+		CHECK_EQUAL(c.budget(), t::size(cache_t::SHARDS));
+		for(int i = 0; i < 100; i++)
+			CHECK_EQUAL(c.getOrCompute(i, [](int k) { return k * 2; }), i * 2);
+		CHECK(c.count() > 0);
+	}
+
+	// pinned values are not released before being unpinned
+	{
+		{
+			typedef ShardedCache<int, CachedValue *> vcache_t;
+			vcache_t c(1, vcache_t::cache_t::LRU, 1);
+			c.setCleaner([](int k, CachedValue *v) { return new Deletor<CachedValue>(v); });
+			vcache_t::Ref r = c.pinOrCompute(1, [](int k) { return new CachedValue(k); });
+			CHECK_EQUAL(cached_live.load(), 1);
+			c.getOrCompute(2, [](int k) { return new CachedValue(k); });
+			CHECK(!c.hasKey(1));
+			CHECK_EQUAL(cached_live.load(), 2);
+			CHECK_EQUAL((*r)->v, 1);
+			r = c.pin(2);
+			CHECK(r);
+			CHECK_EQUAL(cached_live.load(), 1);
+			c.put(2, *r);
+			CHECK_EQUAL(cached_live.load(), 1);
+			CHECK(c.remove(2));
+			CHECK_EQUAL(cached_live.load(), 1);
+			CHECK_EQUAL((*r)->v, 2);
+			r = vcache_t::Ref();
+			CHECK_EQUAL(cached_live.load(), 0);
+			CHECK(!c.pin(2));
+		}
+		CHECK_EQUAL(cached_live.load(), 0);
+	}
+
+TEST_END
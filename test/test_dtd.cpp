@@ -195,6 +195,47 @@ TEST_BEGIN(dtd)
 		if(f.Bs.length() == 1)
 			CHECK_EQUAL(f.Bs[0].num, string("2"));
 	}
+
+	// streaming mode
+	{
+		MyFactory factory;
+		io::BlockInStream in(test1);
+		xom::Reader reader(in);
+		training.parse(factory, reader);
+		CHECK_EQUAL(factory._id, string("ok"));
+		CHECK_EQUAL(factory._name, string("ok"));
+		CHECK_EQUAL(factory.sessions.length(), 2);
+	}
+
+	{
+		Factory2 f;
+		io::BlockInStream in(test2);
+		xom::Reader reader(in);
+		all.parse(f, reader);
+		CHECK_EQUAL(f.nodes.length(), 2);
+		if(f.nodes.length() == 2) {
+			CHECK_EQUAL(f.nodes[1]->ref, f.nodes[0]);
+			CHECK_EQUAL(f.nodes[0]->ref, f.nodes[1]);
+		}
+	}
+
+	{
+		StringBuffer buf;
+		buf << "<?xml version=\"1.0\"?>\n<T3>\n";
+		for(int i = 0; i < 10 * Parser::WINDOW; i++)
+			buf << (i % 3 == 0 ? "<B num=\"" : "<A num=\"") << i << "\"/>\n";
+		buf << "</T3>\n";
+		string text = buf.toString();
+		Factory3 f;
+		io::BlockInStream in(text);
+		xom::Reader reader(in);
+		T3.parse(f, reader);
+		CHECK_EQUAL(f.As.length() + f.Bs.length(), 10 * Parser::WINDOW);
+		if(f.Bs.length() > 1)
+			CHECK_EQUAL(f.Bs[1].num, string("3"));
+		if(f.Bs.length() > 0)
+			CHECK_EQUAL(f.Bs.top().num, string(_ << (10 * Parser::WINDOW - 1)));
+	}
 TEST_END
 
 
@@ -19,11 +19,48 @@
  *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <elm/data/List.h>
 #include <elm/data/Vector.h>
 #include <elm/dyndata/Collection.h>
 #include <elm/test.h>
 using namespace elm;
 
+// iterator too big to be stored in dyndata::Iter
+class BigIter: public PreIterator<BigIter, int> {
+public:
+	BigIter(int n): i(0), m(n) { pad[0] = 0; }
+	inline bool ended(void) const { return i >= m; }
+	inline int item(void) const { return i + pad[0]; }
+	inline void next(void) { i++; }
+private:
+	int i, m;
+	char pad[128];
+};
+
+// abstract iterator without batch support
+class CountIter: public dyndata::AbstractIter<int> {
+public:
+	CountIter(int n): i(0), m(n) { }
+	bool ended(void) const override { return i >= m; }
+	int item(void) const override { return i; }
+	void next(void) override { i++; }
+private:
+	int i, m;
+};
+
+// item without default constructor
+class Val {
+public:
+	inline Val(int x): v(x) { }
+	inline bool operator==(const Val& w) const { return v == w.v; }
+	int v;
+};
+
+class ValCollection: public dyndata::Collection<Val, List<Val> > {
+public:
+	inline void add(int x) { coll.add(Val(x)); }
+};
+
 
 TEST_BEGIN(dyndata)
 
@@ -79,6 +116,100 @@ TEST_BEGIN(dyndata)
 
 	coll.removeAll(coll2);
 	CHECK_EQUAL(coll.count(), 5);
+	error = false;
+	for(auto i = *coll; i(); i++)
+		if(*i % 2 != 0)
+			error = true;
+	CHECK(!error);
+
+	// batch iteration
+	{
+		dyndata::MutableCollection<int, Vector<int> > c;
+		for(int i = 0; i < 100; i++)
+			c.add(i);
+		const dyndata::AbstractCollection<int>& ac = c;
+
+		int n = 0;
+		error = false;
+		for(auto i = ac.items(); i(); i++, n++)
+			if(*i != n)
+				error = true;
+		CHECK(!error);
+		CHECK_EQUAL(n, 100);
+
+		auto i = ac.items();
+		for(int k = 0; k < 20; k++)
+			i++;
+		auto j = i;
+		i++;
+		CHECK_EQUAL(*i, 21);
+		CHECK_EQUAL(*j, 20);
+		j = i;
+		j++;
+		CHECK_EQUAL(*i, 21);
+		CHECK_EQUAL(*j, 22);
+
+		int buf[30];
+		CHECK_EQUAL(i.fill(buf, 30), 30);
+		CHECK_EQUAL(buf[0], 21);
+		CHECK_EQUAL(buf[29], 50);
+		CHECK_EQUAL(*i, 51);
+		n = 0;
+		for(int m = i.fill(buf, 30); m != 0; m = i.fill(buf, 30))
+			n += m;
+		CHECK_EQUAL(n, 49);
+		CHECK(i.ended());
+
+		// remove through an iterator
+		auto r = c.items();
+		while(*r != 37)
+			r++;
+		c.remove(r);
+		CHECK_EQUAL(c.count(), 99);
+		CHECK(!c.contains(37));
+		CHECK(c.contains(36));
+		CHECK(c.contains(38));
+	}
+
+	// big iterators and iterators without batch support
+	{
+		auto i = dyndata::Iter<int>::make(BigIter(40));
+		for(int k = 0; k < 3; k++)
+			i++;
+		auto j = i;
+		CHECK_EQUAL(*j, 3);
+		j++;
+		CHECK_EQUAL(*i, 4);
+		int n = 0;
+		for(; i(); i++)
+			n += *i;
+		CHECK_EQUAL(n, 40 * 39 / 2 - (1 + 2 + 3));
+		CHECK(j.ended());
+
+		dyndata::Iter<int> k(new CountIter(40));
+		int buf[50];
+		CHECK_EQUAL(k.fill(buf, 50), 40);
+		CHECK_EQUAL(buf[39], 39);
+		CHECK(k.ended());
+	}
+
+	// items without default constructor
+	{
+		CHECK(!dyndata::Iter<Val>::BATCHED);
+		ValCollection c;
+		for(int i = 0; i < 40; i++)
+			c.add(i);
+		const dyndata::AbstractCollection<Val>& ac = c;
+		auto i = ac.items();
+		i++;
+		auto j = i;
+		int n = 0;
+		for(; i(); i++)
+			n += (*i).v;
+		CHECK_EQUAL(n, 40 * 39 / 2 - 39);
+		CHECK_EQUAL((*j).v, 38);
+		CHECK(ac.contains(Val(12)));
+	}
 
 TEST_END
 
@@ -11,6 +11,16 @@ typedef enum {
 
 namespace elm { template <> struct type_info<my_enum>: public enum_info<my_enum> { }; }
 
+typedef enum {
+	x0,
+	x1,
+	x2,
+	x3,
+	x4
+} dup_enum;
+
+namespace elm { template <> struct type_info<dup_enum>: public enum_info<dup_enum> { }; }
+
 TEST_BEGIN(enum_info)
 
 	// enumeration test
@@ -36,6 +46,12 @@ TEST_BEGIN(enum_info)
 		in >> e;
 		CHECK(e == b);
 	}
+
+	// duplicate names: first declaration wins
+	CHECK_EQUAL(type_info<dup_enum>::fromString("x"), x1);
+	CHECK_EQUAL(type_info<dup_enum>::fromString("w"), x0);
+	CHECK_EQUAL(type_info<dup_enum>::fromString("y"), x4);
+	CHECK_EXCEPTION(io::IOException, type_info<dup_enum>::fromString("z"));
 TEST_END
 
 namespace elm {
@@ -48,3 +64,15 @@ namespace elm {
 	};
 }
 
+namespace elm {
+	template <> cstring enum_info<dup_enum>::name(void) { return "dup_enum"; }
+	template <> enum_info<dup_enum>::value_t enum_info<dup_enum>::values[] = {
+		value("w", x0),
+		value("x", x1),
+		value("x", x2),
+		value("x", x3),
+		value("y", x4),
+		value("x", x0),
+		last()
+	};
+}
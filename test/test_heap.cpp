@@ -0,0 +1,151 @@
+/*
+ *	Heap classes test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/Heap.h>
+#include <elm/data/RadixHeap.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+class Greater {
+public:
+	inline int doCompare(int x, int y) const { return y - x; }
+};
+
+TEST_BEGIN(heap)
+
+	int T[] = {
+		24,	16,	9,	7,	25,	13,	5,	6,
+		26,	21,	117,	102,	108,	125,	107,	118,
+		111,	115,	120,	121,	109,	105,	123,	110,
+		114,	101,	106,	18,	14,	5
+	};
+	int N = sizeof(T) / sizeof(int);
+
+	// d-ary heap
+	{
+		Heap<int> h;
+		CHECK(h.isEmpty());
+		for(int i = 0; i < N; i++)
+			h.put(T[i]);
+		CHECK_EQUAL(h.count(), N);
+		CHECK_EQUAL(h.head(), 5);
+		bool ok = true;
+		int p = h.get();
+		while(h) {
+			int x = h.get();
+			ok = ok && p <= x;
+			p = x;
+		}
+		CHECK(ok);
+		CHECK_EQUAL(p, 125);
+	}
+
+	// custom comparator, arity and bulk addition
+	{
+		Heap<int, Greater, 2> h;
+		Array<int> a(N, T);
+		h.putAll(a);
+		CHECK_EQUAL(h.count(), N);
+		bool ok = true;
+		int p = h.get();
+		while(h) {
+			int x = h.get();
+			ok = ok && p >= x;
+			p = x;
+		}
+		CHECK(ok);
+		CHECK_EQUAL(p, 5);
+	}
+
+	// indexed heap
+	{
+		IndexedHeap<int> h;
+		IndexedHeap<int>::handle_t hs[30];
+		for(int i = 0; i < N; i++)
+			hs[i] = h.put(T[i]);
+		CHECK(h.contains(hs[3]));
+		CHECK_EQUAL(h[hs[3]], 7);
+		h.decreaseKey(hs[10], 1);
+		CHECK_EQUAL(h.head(), 1);
+		CHECK_EQUAL(h.headHandle(), hs[10]);
+		h.update(hs[10], 200);
+		CHECK_EQUAL(h.head(), 5);
+		h.remove(hs[6]);
+		h.remove(hs[29]);
+		CHECK(!h.contains(hs[6]));
+		CHECK_EQUAL(h.count(), N - 2);
+		CHECK_EQUAL(h.head(), 6);
+		int r = h.put(3);
+		CHECK(r == hs[29] || r == hs[6]);
+		CHECK_EQUAL(h.get(), 3);
+		CHECK(!h.contains(r));
+		bool ok = true;
+		int p = h.get(), c = 1;
+		while(h) {
+			int x = h.get();
+			ok = ok && p <= x;
+			p = x;
+			c++;
+		}
+		CHECK(ok);
+		CHECK_EQUAL(c, N - 2);
+		CHECK_EQUAL(p, 200);
+	}
+
+	// radix heap
+	{
+		RadixHeap<int> h;
+		for(int i = 0; i < N; i++)
+			h.put(T[i], i);
+		CHECK_EQUAL(h.count(), N);
+		CHECK_EQUAL(h.headKey(), t::uint32(5));
+		bool ok = true;
+		t::uint32 p = 0;
+		int c = 0;
+		while(h) {
+			t::uint32 k = h.headKey();
+			int i = h.get();
+			ok = ok && p <= k && (i < 0 || t::uint32(T[i]) == k);
+			p = k;
+			c++;
+
+			// monotone insertion
+			if(c == 10)
+				h.put(k + 3, -1);
+		}
+		CHECK(ok);
+		CHECK_EQUAL(c, N + 1);
+		CHECK_EQUAL(p, t::uint32(125));
+	}
+
+	{
+		RadixHeap<int, t::uint64> h;
+		h.put(t::uint64(1) << 40, 1);
+		h.put(3, 2);
+		h.put(t::uint64(-1), 3);
+		CHECK_EQUAL(h.get(), 2);
+		CHECK_EQUAL(h.get(), 1);
+		CHECK_EQUAL(h.get(), 3);
+		CHECK(h.isEmpty());
+	}
+
+TEST_END
@@ -0,0 +1,151 @@
+/*
+ *	imm::map and imm::hash_map test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/imm/map.h>
+#include <elm/imm/hash_map.h>
+#include <elm/array.h>
+#include <elm/data/Vector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+#define NUM		10000
+
+// colliding hash to test the collision chains
+class BadHash {
+public:
+	static inline t::hash hash(int k) { return k % 7; }
+	static inline bool equals(int k1, int k2) { return k1 == k2; }
+};
+
+static const int KEYS = 500;
+
+template <class M>
+static bool check(const M& m, const int *ref) {
+	int n = 0;
+	for(int i = 0; i < KEYS; i++)
+		if(ref[i] >= 0) {
+			n++;
+			if(m.get(i, -1) != ref[i])
+				return false;
+		}
+		else if(m.hasKey(i))
+			return false;
+	if(m.count() != n)
+		return false;
+	for(auto p: m.pairs()) {
+		if(ref[p.fst] != p.snd)
+			return false;
+		n--;
+	}
+	return n == 0;
+}
+
+template <class M>
+static bool robust(void) {
+	Vector<M> snaps;
+	Vector<int *> refs;
+	M m;
+	int ref[KEYS];
+	array::set(ref, KEYS, -1);
+	t::uint32 x = 0xfe003b09;
+	for(int i = 0; i < NUM; i++) {
+		x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+		int k = (x >> 8) % KEYS;
+		if(x % 3 == 0) {
+			m = m.remove(k);
+			ref[k] = -1;
+		}
+		else {
+			m = m.put(k, i);
+			ref[k] = i;
+		}
+		if(i % 1000 == 0) {
+			snaps.add(m);
+			int *r = new int[KEYS];
+			array::copy(r, ref, KEYS);
+			refs.add(r);
+		}
+	}
+	bool ok = check(m, ref);
+	for(int i = 0; i < snaps.count(); i++) {
+		ok = ok && check(snaps[i], refs[i]);
+		delete [] refs[i];
+	}
+	return ok;
+}
+
+TEST_BEGIN(imm_map)
+
+	// persistent balanced map
+	{
+		imm::map<int, int> m0;
+		CHECK(m0.isEmpty());
+		imm::map<int, int> m1 = m0.put(1, 10).put(2, 20).put(3, 30);
+		CHECK(m0.isEmpty());
+		CHECK_EQUAL(m1.count(), 3);
+		CHECK_EQUAL(m1.get(2, 0), 20);
+		imm::map<int, int> m2 = m1.put(2, 200);
+		CHECK_EQUAL(m1.get(2, 0), 20);
+		CHECK_EQUAL(m2.get(2, 0), 200);
+		CHECK_EQUAL(m2.count(), 3);
+		imm::map<int, int> m3 = m2.remove(1);
+		CHECK(!m3.hasKey(1));
+		CHECK(m2.hasKey(1));
+		CHECK(m3.remove(10).same(m3));
+		imm::map<int, int> m4 = m3.put(1, 10).put(2, 20);
+		CHECK(!m4.same(m1));
+		CHECK(m4.equals(m1));
+		CHECK(m4 != m2);
+		int p = 0;
+		bool sorted = true;
+		for(auto k: m4.keys()) {
+			sorted = sorted && p < k;
+			p = k;
+		}
+		CHECK(sorted);
+		CHECK((robust<imm::map<int, int> >()));
+	}
+
+	// persistent hash map
+	{
+		imm::hash_map<int, int> m0;
+		CHECK(m0.isEmpty());
+		imm::hash_map<int, int> m1 = m0.put(1, 10).put(2, 20).put(3, 30);
+		CHECK(m0.isEmpty());
+		CHECK_EQUAL(m1.count(), 3);
+		CHECK_EQUAL(m1.get(2, 0), 20);
+		imm::hash_map<int, int> m2 = m1.put(2, 200);
+		CHECK_EQUAL(m1.get(2, 0), 20);
+		CHECK_EQUAL(m2.get(2, 0), 200);
+		imm::hash_map<int, int> m3 = m2.remove(1);
+		CHECK(!m3.hasKey(1));
+		CHECK(m2.hasKey(1));
+		CHECK(m3.remove(10).same(m3));
+		imm::hash_map<int, int> m4 = m3.put(1, 10).put(2, 20);
+		CHECK(!m4.same(m1));
+		CHECK(m4.equals(m1));
+		CHECK(m4 != m2);
+		CHECK((robust<imm::hash_map<int, int> >()));
+		CHECK((robust<imm::hash_map<int, int, BadHash> >()));
+	}
+
+TEST_END
@@ -0,0 +1,150 @@
+/*
+ *	IndexSet class test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/util/IndexSet.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+static t::uint32 rnd(t::uint32& s) {
+	s = s * 1103515245 + 12345;
+	return s >> 8;
+}
+
+static bool same(const IndexSet& s, const BitVector& v) {
+	if(s.countOnes() != v.countOnes())
+		return false;
+	for(int i = 0; i < v.size(); i++)
+		if(s.bit(i) != v.bit(i))
+			return false;
+	return true;
+}
+
+// build a set and the matching bit vector with about n indices
+static void make(int size, int n, t::uint32 seed, IndexSet& s, BitVector& v) {
+	s = IndexSet(size);
+	v = BitVector(size);
+	for(int i = 0; i < n; i++) {
+		int x = rnd(seed) % size;
+		s.set(x);
+		v.set(x);
+	}
+}
+
+TEST_BEGIN(index_set)
+
+	static const int S = 1000;
+
+	// element access and representation switch
+	{
+		IndexSet s(S);
+		CHECK(s.isEmpty());
+		CHECK(!s.isDense());
+		CHECK_EQUAL(s.size(), S);
+		s.set(10);
+		s.set(3);
+		s.set(500);
+		s.set(3);
+		CHECK_EQUAL(s.countOnes(), 3);
+		CHECK(s.bit(3) && s.bit(10) && s.bit(500));
+		CHECK(!s.bit(4));
+		CHECK(!s.isDense());
+		int p = -1, c = 0;
+		bool ok = true;
+		for(auto i: s) {
+			ok = ok && p < i;
+			p = i;
+			c++;
+		}
+		CHECK(ok);
+		CHECK_EQUAL(c, 3);
+		for(int i = 0; i < 100; i++)
+			s.set(i * 10);
+		CHECK(s.isDense());
+		CHECK_EQUAL(s.countOnes(), 101);
+		for(int i = 0; i < 100; i++)
+			s.clear(i * 10);
+		CHECK(!s.isDense());
+		CHECK_EQUAL(s.countOnes(), 1);
+		CHECK(s.bit(3) && !s.bit(500));
+		s[7] = true;
+		CHECK(s[7]);
+		s.set();
+		CHECK_EQUAL(s.countOnes(), S);
+		s.applyNot();
+		CHECK(s.isEmpty());
+		CHECK(!s.isDense());
+	}
+
+	// operations on mixed representations
+	{
+		int ns[] = { 5, 20, 200, 900 };
+		bool ok_or = true, ok_and = true, ok_reset = true, ok_inc = true, ok_meets = true, ok_not = true;
+		for(int i = 0; i < 4; i++)
+			for(int j = 0; j < 4; j++) {
+				IndexSet a, b;
+				BitVector va, vb;
+				make(S, ns[i], i + 1, a, va);
+				make(S, ns[j], j + 11, b, vb);
+				ok_or = ok_or && same(a | b, va | vb);
+				ok_and = ok_and && same(a & b, va & vb);
+				ok_reset = ok_reset && same(a - b, va - vb);
+				ok_inc = ok_inc && (a | b).includes(b) && (a | b).includes(a)
+					&& a.includes(a & b) && (a.includes(b) == va.includes(vb));
+				ok_meets = ok_meets && a.meets(b) == !(va & vb).isEmpty();
+				ok_not = ok_not && same(~a, ~va);
+			}
+		CHECK(ok_or);
+		CHECK(ok_and);
+		CHECK(ok_reset);
+		CHECK(ok_inc);
+		CHECK(ok_meets);
+		CHECK(ok_not);
+	}
+
+	// equality across representations
+	{
+		IndexSet a(S), b(S);
+		for(int i = 0; i < 200; i++)
+			a.set(i);
+		for(int i = 150; i < 200; i++)
+			a.clear(i);
+		for(int i = 0; i < 150; i++)
+			b.set(i);
+		CHECK(a == b);
+		IndexSet c(S);
+		c.set(1);
+		c.set(2);
+		IndexSet d = b;
+		d.applyAnd(c);
+		CHECK(!d.isDense());
+		CHECK_EQUAL(d.countOnes(), 2);
+		CHECK(b > d);
+		CHECK(d <= c);
+		CHECK(same(a, a.toBitVector()));
+		BitVector v(S);
+		v.set(42);
+		IndexSet e(v);
+		CHECK(e.bit(42));
+		CHECK_EQUAL(e.countOnes(), 1);
+	}
+
+TEST_END
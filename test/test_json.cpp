@@ -189,6 +189,22 @@ TEST_BEGIN(json)
 		CHECK_EQUAL(maker.res, MyMaker::_NULL);
 	}
 
+	// string escapes and UTF-8
+	{
+		MyMaker maker;
+		json::Parser p(maker);
+		p.parse("'a\\nb\\\\c\\\"'");
+		CHECK_EQUAL(maker.s, string("a\nb\\c\""));
+		p.parse("'caf\\u00e9 \\u20ac'");
+		CHECK_EQUAL(maker.s, string("caf\xc3\xa9 \xe2\x82\xac"));
+		p.parse("'\\ud83d\\ude00'");
+		CHECK_EQUAL(maker.s, string("\xf0\x9f\x98\x80"));
+		p.parse("'caf\xc3\xa9'");
+		CHECK_EQUAL(maker.s, string("caf\xc3\xa9"));
+		CHECK_EXCEPTION(json::Exception, p.parse("'caf\xe9'"));
+		CHECK_EXCEPTION(json::Exception, p.parse("'\\ud83d'"));
+	}
+
 TEST_END
 
 
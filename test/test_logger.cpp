@@ -0,0 +1,206 @@
+/*
+ *	Logger class test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/io/Monitor.h>
+#include <elm/log/Log.h>
+#include <elm/string/StringBuffer.h>
+#include <elm/sys/Thread.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::log;
+
+static const int THREADS = 4, MESSAGES = 2000;
+
+class Producer: public sys::Runnable {
+public:
+	Producer(io::Output& out, int id): o(out), i(id) { }
+	void run(void) override {
+		for(int j = 0; j < MESSAGES; j++) {
+			Capture c(Logger::INFO, o, Capture::LINE);
+			c << i << ' ' << j;
+		}
+	}
+private:
+	io::Output& o;
+	int i;
+};
+
+static int run(io::Output& out) {
+	sys::Thread *ts[THREADS];
+	Producer *ps[THREADS];
+	for(int i = 0; i < THREADS; i++) {
+		ps[i] = new Producer(out, i);
+		ts[i] = sys::Thread::make(*ps[i]);
+		ts[i]->start();
+	}
+	for(int i = 0; i < THREADS; i++) {
+		ts[i]->join();
+		delete ts[i];
+		delete ps[i];
+	}
+	Logger::flush();
+	return THREADS * MESSAGES;
+}
+
+static int number(const string& s, int b, int e) {
+	int r = 0;
+	for(int i = b; i < e; i++)
+		r = r * 10 + s[i] - '0';
+	return r;
+}
+
+// check that the messages of each thread are in order
+static bool ordered(StringBuffer& buf, int& lines) {
+	string s = buf.toString();
+	int next[THREADS];
+	for(int i = 0; i < THREADS; i++)
+		next[i] = 0;
+	lines = 0;
+	for(int p = 0; p < s.length();) {
+		int e = s.indexOf('\n', p);
+		if(e < 0)
+			return false;
+		int sp = s.indexOf(' ', p);
+		int i = number(s, p, sp);
+		int j = number(s, sp + 1, e);
+		if(i < 0 || i >= THREADS || j < next[i])
+			return false;
+		next[i] = j + 1;
+		lines++;
+		p = e + 1;
+	}
+	return true;
+}
+
+TEST_BEGIN(logger)
+
+	// synchronous capture
+	{
+		StringBuffer buf;
+		{
+			Capture c(Logger::INFO, buf);
+			c << "a" << 12 << 'c' << t::uint64(13) << true << string("str") << 1.5;
+		}
+		CHECK_EQUAL(buf.toString(), string("INFO: a12c13truestr1.5\n"));
+	}
+
+	// long messages and non-scalar arguments
+	{
+		StringBuffer buf, exp;
+		{
+			Capture c(Logger::WARNING, buf, Capture::PLAIN);
+			exp << io::hex(255);
+			c << io::hex(255);
+			for(int i = 0; i < 100; i++) {
+				c << i << " abcdef ";
+				exp << i << " abcdef ";
+			}
+		}
+		CHECK_EQUAL(buf.toString(), exp.toString());
+	}
+
+	// debug style
+	{
+		bool src = Debug::getSourceInfoFlag(), num = Debug::getNumberingFlag(), col = Debug::getColorFlag();
+		Debug::setSourceInfoFlag(false);
+		Debug::setNumberingFlag(false);
+		Debug::setColorFlag(false);
+		StringBuffer buf;
+		{
+			Capture c(Logger::DEBUG, buf, Capture::DEBUG_LINE, __FILE__, __LINE__);
+			c << "x = " << 10;
+		}
+		CHECK_EQUAL(buf.toString(), string("x = 10\n"));
+		Debug::setSourceInfoFlag(src);
+		Debug::setNumberingFlag(num);
+		Debug::setColorFlag(col);
+	}
+
+	// level filtering
+	{
+		io::BlockOutStream stream;
+		io::Monitor mon;
+		mon.setErr(stream);
+		Logger::setLevel(Logger::WARNING);
+		CHECK(!Logger::isEnabled(Logger::INFO));
+		CHECK(Logger::isEnabled(Logger::ERROR));
+		mon.info("hidden");
+		mon.warn("shown");
+		Logger::setLevel(Logger::TRACE);
+		mon.error("shown too");
+		CHECK_EQUAL(string(stream.block(), stream.size()), string("WARNING: shown\nERROR: shown too\n"));
+	}
+
+	// asynchronous mode
+	{
+		Logger::start();
+		CHECK(Logger::isAsync());
+
+		StringBuffer buf;
+		io::Output& out = Logger::open(buf.stream());
+		int n = run(out), lines;
+		Logger::close(out);
+		CHECK(ordered(buf, lines));
+		CHECK_EQUAL(lines, n);
+
+		// long messages are spilled
+		io::BlockOutStream stream;
+		io::Output& sout = Logger::open(stream);
+		{
+			Capture c(Logger::INFO, sout, Capture::PLAIN);
+			for(int i = 0; i < 100; i++)
+				c << "long message ";
+		}
+		{
+			Capture c(Logger::INFO, sout);
+			c << "async";
+		}
+		Logger::flush();
+		string s(stream.block(), stream.size());
+		CHECK(s.endsWith("long message INFO: async\n"));
+		CHECK_EQUAL(s.length(), 13 * 100 + 12);
+		Logger::close(sout);
+
+		// outputs not owned by the logger are written synchronously
+		io::BlockOutStream mstream;
+		io::Monitor mon;
+		mon.setErr(mstream);
+		mon.info("sync");
+		CHECK_EQUAL(string(mstream.block(), mstream.size()), string("INFO: sync\n"));
+
+		// dropped messages are counted
+		Logger::setPolicy(Logger::DROP);
+		Logger::setRingSize(4);
+		StringBuffer dbuf;
+		io::Output& dout = Logger::open(dbuf.stream());
+		n = run(dout);
+		Logger::close(dout);
+		CHECK(ordered(dbuf, lines));
+		CHECK_EQUAL(t::uint64(lines) + Logger::dropped(), t::uint64(n));
+		Logger::setPolicy(Logger::BLOCK);
+		Logger::setRingSize(Logger::RING_SIZE);
+
+		Logger::stop();
+		CHECK(!Logger::isAsync());
+	}
+
+TEST_END
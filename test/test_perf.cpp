@@ -0,0 +1,170 @@
+/*
+ *	perf module test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/json/Saver.h>
+#include <elm/perf.h>
+#include <elm/sys/Thread.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::perf;
+
+static const int N = 100000;
+
+ELM_PERF_COUNTER(events, "test.events");
+ELM_PERF_HISTOGRAM(sizes, "test.sizes");
+ELM_PERF_TIMER(work, "test.work");
+
+class Worker: public sys::Runnable {
+public:
+	void run(void) override {
+		ELM_PERF_TRACE("worker");
+		for(int i = 0; i < N; i++) {
+			ELM_PERF_COUNT(events);
+			ELM_PERF_SAMPLE(sizes, i & 0xff);
+		}
+	}
+};
+
+class Tracer: public sys::Runnable {
+public:
+	Tracer(void): stop(false) { }
+	void run(void) override {
+		while(!stop.load())
+			ELM_PERF_INSTANT("tick");
+	}
+	std::atomic<bool> stop;
+};
+
+TEST_BEGIN(perf)
+
+	// clock
+	{
+		t::uint64 t1 = Clock::now(), c1 = Clock::cycles();
+		t::uint64 t2 = Clock::now(), c2 = Clock::cycles();
+		CHECK(t1 <= t2);
+		CHECK(c1 <= c2);
+	}
+
+	// counters and histograms updated from several threads
+	{
+		Trace::enable();
+		Worker w1, w2;
+		sys::Thread *t1 = sys::Thread::make(w1), *t2 = sys::Thread::make(w2);
+		t1->start();
+		t2->start();
+		w1.run();
+		t1->join();
+		t2->join();
+		delete t1;
+		delete t2;
+		CHECK_EQUAL(events.value(), t::uint64(3 * N));
+		CHECK_EQUAL(sizes.count(), t::uint64(3 * N));
+		CHECK_EQUAL(sizes.max(), t::uint64(0xff));
+		t::uint64 zeros = 0, highs = 0;
+		for(int i = 0; i < N; i++) {
+			if((i & 0xff) == 0)
+				zeros++;
+			else if((i & 0xff) >= 0x80)
+				highs++;
+		}
+		CHECK_EQUAL(sizes.bucket(0), 3 * zeros);
+		CHECK_EQUAL(sizes.bucket(Histogram::bucketOf(0x80)), 3 * highs);
+		CHECK(sizes.percentile(.5) >= 0x7f);
+		CHECK(sizes.percentile(.5) <= 0xff);
+		events.reset();
+		CHECK_EQUAL(events.value(), t::uint64(0));
+	}
+
+	// timers
+	{
+		for(int i = 0; i < 10; i++) {
+			ELM_PERF_TIME(work);
+			ELM_PERF_TRACE("step");
+		}
+		CHECK_EQUAL(work.count(), t::uint64(10));
+		CHECK(work.total() >= work.max());
+	}
+
+	// JSON output
+	{
+		StringBuffer buf;
+		json::Saver saver(buf);
+		Stat::saveAll(saver);
+		saver.close();
+		string s = buf.toString();
+		CHECK(s.indexOf("\"test.events\":0") >= 0);
+		CHECK(s.indexOf("\"test.work\":{\"unit\":\"ns\",\"count\":10") >= 0);
+	}
+
+	// Chrome trace
+	{
+		ELM_PERF_INSTANT("mark");
+		StringBuffer buf;
+		json::Saver saver(buf);
+		Trace::save(saver);
+		saver.close();
+		string s = buf.toString();
+		CHECK(s.startsWith("{\"traceEvents\":["));
+		CHECK(s.indexOf("\"name\":\"worker\",\"cat\":\"elm\",\"ph\":\"X\"") >= 0);
+		CHECK(s.indexOf("\"name\":\"mark\",\"cat\":\"elm\",\"ph\":\"i\"") >= 0);
+		Trace::enable(false);
+		Trace::clear();
+		StringBuffer buf2;
+		json::Saver saver2(buf2);
+		Trace::save(saver2);
+		saver2.close();
+		CHECK_EQUAL(buf2.toString(), string("{\"traceEvents\":[],\"displayTimeUnit\":\"ns\"}"));
+	}
+
+	// trace saved and cleared while recorded
+	{
+		Trace::setCapacity(256);
+		Trace::enable();
+		Tracer t;
+		sys::Thread *th = sys::Thread::make(t);
+		th->start();
+		bool ok = true;
+		for(int i = 0; i < 20; i++) {
+			StringBuffer buf;
+			json::Saver saver(buf);
+			Trace::save(saver);
+			saver.close();
+			string s = buf.toString();
+			ok = ok && s.startsWith("{\"traceEvents\":[") && s.endsWith("],\"displayTimeUnit\":\"ns\"}")
+				&& s.indexOf("\"ph\":\"X\"") < 0;
+			Trace::clear();
+		}
+		t.stop.store(true);
+		th->join();
+		delete th;
+		CHECK(ok);
+		Trace::enable(false);
+		Trace::setCapacity(Trace::DEFAULT_CAPACITY);
+		Trace::clear();
+		StringBuffer buf;
+		json::Saver saver(buf);
+		Trace::save(saver);
+		saver.close();
+		CHECK_EQUAL(buf.toString(), string("{\"traceEvents\":[],\"displayTimeUnit\":\"ns\"}"));
+	}
+
+TEST_END
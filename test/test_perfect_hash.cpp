@@ -0,0 +1,123 @@
+/*
+ *	PerfectHashMap class test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/PerfectHashMap.h>
+#include <elm/string/AutoString.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+class BadHash {
+public:
+	static t::hash hash(int x) { return x / 4; }
+	static bool equals(int x, int y) { return x == y; }
+};
+
+typedef PerfectHashMap<string, int> map_t;
+typedef PerfectHashMap<int, int, BadHash> bad_map_t;
+
+TEST_BEGIN(perfect_hash)
+
+	// empty map
+	{
+		map_t m;
+		CHECK(m.isEmpty());
+		CHECK(m.isFrozen());
+		CHECK(!m.hasKey("a"));
+		m.freeze();
+		CHECK_EQUAL(m.get("a", -1), -1);
+		CHECK(!m.get("a").some());
+	}
+
+	// small map
+	{
+		map_t m;
+		m.add("one", 1);
+		m.add("two", 2);
+		m.add("three", 3);
+		CHECK(!m.isFrozen());
+		m.freeze();
+		CHECK(m.isFrozen());
+		CHECK_EQUAL(m.count(), 3);
+		CHECK_EQUAL(m.get("one", 0), 1);
+		CHECK_EQUAL(m.get("two", 0), 2);
+		CHECK_EQUAL(*m.get("three"), 3);
+		CHECK(!m.hasKey("four"));
+		CHECK(!m.hasKey(""));
+	}
+
+	// big map
+	{
+		const int n = 10000;
+		map_t m;
+		for(int i = 0; i < n; i++)
+			m.add(_ << "key" << i, i);
+		m.freeze();
+		bool ok = true;
+		for(int i = 0; ok && i < n; i++)
+			ok = m.get(_ << "key" << i, -1) == i;
+		CHECK(ok);
+		bool none = true;
+		for(int i = n; none && i < 2 * n; i++)
+			none = !m.hasKey(_ << "key" << i);
+		CHECK(none);
+	}
+
+	// duplicate keys: first added wins
+	{
+		map_t m;
+		m.add("a", 1);
+		m.add("b", 2);
+		m.add("a", 3);
+		m.freeze();
+		CHECK_EQUAL(m.get("a", 0), 1);
+		CHECK_EQUAL(m.get("b", 0), 2);
+	}
+
+	// colliding hashes go to overflow
+	{
+		bad_map_t m;
+		for(int i = 0; i < 100; i++)
+			m.add(i, i * 10);
+		m.freeze();
+		bool ok = true;
+		for(int i = 0; ok && i < 100; i++)
+			ok = m.get(i, -1) == i * 10;
+		CHECK(ok);
+		CHECK(!m.hasKey(100));
+	}
+
+	// refreeze after addition
+	{
+		map_t m;
+		m.add("x", 1);
+		m.freeze();
+		m.add("y", 2);
+		CHECK(!m.isFrozen());
+		m.freeze();
+		CHECK_EQUAL(m.get("x", 0), 1);
+		CHECK_EQUAL(m.get("y", 0), 2);
+		m.clear();
+		m.freeze();
+		CHECK(!m.hasKey("x"));
+	}
+
+TEST_END
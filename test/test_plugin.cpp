@@ -6,6 +6,7 @@
  */
 
 #include <elm/sys/Plugger.h>
+#include <elm/sys/System.h>
 #include "../include/elm/test.h"
 #if defined(__WIN32) || defined(__WIN64)
 #include <windows.h>
@@ -133,6 +134,79 @@ TEST_BEGIN(plugin)
 		CHECK(!plugin);
 	}
 
+	// check the plug-in index
+	{
+		sys::Path ipath = sys::Path::temp() / "elm-test-plugin.index";
+		if(ipath.exists())
+			ipath.remove();
+		{
+			Plugger plugger("my_plugin", Version(0, 0, 0), ".");
+			plugger.useIndex(ipath);
+			CHECK(plugger.isIndexed());
+			Plugin *plugin = plugger.plug("libmyplugin");
+			CHECK(plugin);
+			if(plugin)
+				plugin->unplug();
+			CHECK(!plugger.plug("nothing"));
+		}
+		CHECK(ipath.exists());
+		{
+			Plugger plugger("my_plugin", Version(0, 0, 0), ".");
+			plugger.useIndex(ipath);
+			Plugin *plugin = plugger.plug("myplugin");
+			CHECK(plugin);
+			if(plugin) {
+				CHECK_EQUAL(plugin->name(), string("myplugin"));
+				plugin->unplug();
+			}
+		}
+		ipath.remove();
+	}
+
+	// check concurrent loading
+	{
+		Plugger plugger("my_plugin", Version(0, 0, 0), ".");
+		Vector<string> names;
+		names.add("libmyplugin");
+		names.add("plugin_two");
+		Vector<Plugin *> plugins;
+		CHECK(plugger.plugAll(names, plugins));
+		REQUIRE(plugins.count() == 2, return);
+		CHECK(plugins[0] != nullptr && plugins[0]->name() == "myplugin");
+		CHECK(plugins[1] != nullptr && plugins[1]->name() == "plugin_two");
+		for(auto p: plugins)
+			if(p != nullptr)
+				p->unplug();
+	}
+
+	// check dependency cycle detection
+	{
+		sys::Path dir = System::getTempDir();
+		const char *files[][2] = {
+			{ "a.eld", "[elm-plugin]\ndeps=b\n" },
+			{ "b.eld", "[elm-plugin]\ndeps=a\n" },
+			{ "a.so", "" },
+			{ "b.so", "" }
+		};
+		for(auto f: files) {
+			io::OutStream *s = System::createFile(dir / f[0]);
+			io::Output out(*s);
+			out << f[1];
+			out.flush();
+			delete s;
+		}
+		Plugger plugger("my_plugin", Version(0, 0, 0), dir.toString());
+		plugger.setQuiet(true);
+		Vector<string> names;
+		names.add("a");
+		Vector<Plugin *> plugins;
+		CHECK(!plugger.plugAll(names, plugins));
+		CHECK_EQUAL(plugins.count(), 1);
+		for(auto f: files)
+			System::removeFile(dir / f[0]);
+		System::removeDir(dir);
+	}
+
 	// check the aliasing
 	{
 		Plugin *alias = plugger.plug("alias");
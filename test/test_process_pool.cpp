@@ -0,0 +1,112 @@
+/*
+ *	ProcessPool class test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/io/Input.h>
+#include <elm/sys/ProcessPool.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::sys;
+
+static ProcessBuilder shell(string command) {
+	ProcessBuilder b("sh");
+	b += "-c";
+	b += command;
+	return b;
+}
+
+TEST_BEGIN(process_pool)
+
+	// monitor
+	{
+		ProcessMonitor monitor;
+		int codes[8], ended = 0;
+		for(int i = 0; i < 8; i++) {
+			codes[i] = -1;
+			monitor.watch(*shell(_ << "exit " << i).run(), [&codes, &ended, i](Process& p) {
+				codes[i] = p.returnCode();
+				ended++;
+				delete &p;
+			});
+		}
+		CHECK_EQUAL(monitor.count(), 8);
+		monitor.waitAll();
+		CHECK_EQUAL(ended, 8);
+		bool ok = true;
+		for(int i = 0; i < 8; i++)
+			ok = ok && codes[i] == i;
+		CHECK(ok);
+		CHECK(monitor.isEmpty());
+		CHECK_EQUAL(monitor.poll(0), 0);
+	}
+
+	// bad command
+	{
+		bool failed = false;
+		try {
+			ProcessBuilder b("elm-no-such-command");
+			delete b.run();
+		}
+		catch(SystemException& e) {
+			failed = e.error() == SystemException::BAD_PATH;
+		}
+		CHECK(failed);
+	}
+
+	// pool with captured outputs
+	{
+		ProcessPool pool(3);
+		CHECK_EQUAL(pool.count(), 3);
+		const int n = 20;
+		ProcessPool::Job *jobs[n];
+		for(int i = 0; i < n; i++)
+			jobs[i] = pool.submit(shell(_ << "echo job" << i << "; exit " << (i % 4)));
+		bool out_ok = true, code_ok = true;
+		for(int i = 0; i < n; i++) {
+			io::Input in(jobs[i]->output());
+			string line = in.scanLine();
+			out_ok = out_ok && line == string(_ << "job" << i << "\n");
+			code_ok = code_ok && jobs[i]->wait() == i % 4;
+			CHECK(jobs[i]->isDone());
+			delete jobs[i];
+		}
+		CHECK(out_ok);
+		CHECK(code_ok);
+	}
+
+	// failing job, cancelled job and wait all
+	{
+		ProcessPool pool(1);
+		ProcessPool::Job *slow = pool.submit(shell("sleep 0.2"), false);
+		ProcessPool::Job *bad = pool.submit(ProcessBuilder("elm-no-such-command"));
+		ProcessPool::Job *cancelled = pool.submit(shell("exit 1"));
+		delete cancelled;
+		pool.waitAll();
+		CHECK(slow->isDone());
+		CHECK_EQUAL(slow->wait(), 0);
+		CHECK_EQUAL(bad->wait(), -1);
+		CHECK(bad->error() != "");
+		CHECK_EQUAL(bad->output().read(), int(io::InStream::ENDED));
+		delete slow;
+		delete bad;
+	}
+
+TEST_END
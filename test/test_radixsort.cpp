@@ -0,0 +1,185 @@
+/*
+ *	radix sort test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/data/Array.h>
+#include <elm/data/FragTable.h>
+#include <elm/data/radixsort.h>
+#include <elm/data/Vector.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+template <class A>
+static bool sorted(const A& a) {
+	for(int i = 1; i < a.count(); i++)
+		if(a[i] < a[i - 1])
+			return false;
+	return true;
+}
+
+static t::uint32 rnd(t::uint32& s) {
+	s = s * 1103515245 + 12345;
+	return s >> 8;
+}
+
+class Low {
+public:
+	inline t::uint8 operator()(const Pair<int, int>& p) const { return p.fst & 0xff; }
+};
+
+TEST_BEGIN(radixsort)
+
+	// LSD on unsigned and signed integers
+	{
+		Vector<t::uint32> v;
+		t::uint32 s = 1;
+		for(int i = 0; i < 1000; i++)
+			v.add(rnd(s) ^ (rnd(s) << 24));
+		radixsort(v);
+		CHECK(sorted(v));
+		CHECK_EQUAL(v.count(), 1000);
+
+		Vector<int> w;
+		for(int i = 0; i < 1000; i++)
+			w.add(int(rnd(s)) - (1 << 23));
+		radixsort(w);
+		CHECK(sorted(w));
+		CHECK(w[0] < 0);
+
+		Vector<t::int64> x;
+		for(int i = 0; i < 500; i++)
+			x.add(-t::int64(i) * 1000000007LL);
+		radixsort(x);
+		CHECK(sorted(x));
+		CHECK_EQUAL(x[0], -t::int64(499) * 1000000007LL);
+	}
+
+	// LSD on the other signed types
+	{
+		Vector<long long> v;
+		for(int i = 0; i < 500; i++)
+			v.add(i % 2 == 0 ? -(long long)i * 1000000007LL : (long long)i);
+		radixsort(v);
+		CHECK(sorted(v));
+		CHECK_EQUAL(v[0], -498 * 1000000007LL);
+
+		Vector<signed char> w;
+		Vector<char> c;
+		for(int i = 0; i < 256; i++) {
+			w.add((signed char)(i * 37));
+			c.add(char(i * 37));
+		}
+		radixsort(w);
+		CHECK(sorted(w));
+		CHECK_EQUAL(int(w[0]), -128);
+		radixsort(c);
+		CHECK(sorted(c));
+		CHECK_EQUAL(c[0], char(std::is_signed<char>::value ? -128 : 0));
+	}
+
+	// small arrays
+	{
+		Vector<int> v;
+		radixsort(v);
+		v.add(3);
+		v.add(-1);
+		v.add(2);
+		radixsort(v);
+		CHECK(sorted(v));
+		CHECK_EQUAL(v[0], -1);
+	}
+
+	// stability and key extraction
+	{
+		Vector<Pair<int, int> > v;
+		for(int i = 0; i < 300; i++)
+			v.add(pair((i * 7) % 10 + 256 * i, i));
+		radixsort(v, Low());
+		bool ok = true;
+		for(int i = 1; i < v.count(); i++)
+			ok = ok && ((v[i - 1].fst & 0xff) < (v[i].fst & 0xff)
+				|| ((v[i - 1].fst & 0xff) == (v[i].fst & 0xff) && v[i - 1].snd < v[i].snd));
+		CHECK(ok);
+	}
+
+	// pointers and other arrays
+	{
+		int tab[100];
+		AllocArray<int *> a(100);
+		for(int i = 0; i < 100; i++)
+			a[i] = &tab[(i * 37) % 100];
+		radixsort(a);
+		CHECK(sorted(a));
+
+		FragTable<t::uint64> f(4);
+		t::uint32 s = 7;
+		for(int i = 0; i < 1000; i++)
+			f.add(t::uint64(rnd(s)) << 20);
+		radixsort(f);
+		CHECK(sorted(f));
+	}
+
+	// MSD
+	{
+		Vector<t::uint32> v;
+		t::uint32 s = 3;
+		for(int i = 0; i < 5000; i++)
+			v.add(rnd(s) % 100000);
+		msdRadixsort(v);
+		CHECK(sorted(v));
+		Vector<int> w;
+		for(int i = 0; i < 1000; i++)
+			w.add(int(rnd(s)) - (1 << 23));
+		msdRadixsort(w);
+		CHECK(sorted(w));
+	}
+
+	// counting
+	{
+		Vector<Pair<int, int> > v;
+		for(int i = 0; i < 200; i++)
+			v.add(pair((i * 13) % 17, i));
+		countingsort(v, 17, [](const Pair<int, int>& p) { return p.fst; });
+		bool ok = true;
+		for(int i = 1; i < v.count(); i++)
+			ok = ok && (v[i - 1].fst < v[i].fst || (v[i - 1].fst == v[i].fst && v[i - 1].snd < v[i].snd));
+		CHECK(ok);
+	}
+
+	// parallel
+	{
+		Vector<t::uint64> v, w;
+		t::uint32 s = 5;
+		for(int i = 0; i < 100000; i++) {
+			t::uint64 x = (t::uint64(rnd(s)) << 32) | rnd(s);
+			v.add(x);
+			w.add(x);
+		}
+		parallelRadixsort(v, RadixKey<t::uint64>(), 4);
+		radixsort(w);
+		CHECK(sorted(v));
+		bool ok = true;
+		for(int i = 0; i < v.count(); i++)
+			ok = ok && v[i] == w[i];
+		CHECK(ok);
+	}
+
+TEST_END
@@ -0,0 +1,114 @@
+/*
+ *	Reactor class test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/net/ClientSocket.h>
+#include <elm/net/Reactor.h>
+#include <elm/sys/Thread.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+// echo the received lines
+class LineEcho: public net::Channel {
+protected:
+	void onRead(void) override {
+		int s = 0;
+		for(int i = 0; i < available(); i++)
+			if(data()[i] == '\n') {
+				send(data() + s, i + 1 - s);
+				s = i + 1;
+			}
+		consume(s);
+	}
+};
+
+class EchoServer: public net::Reactor, public sys::Runnable {
+public:
+	EchoServer(int workers = 0) { setWorkers(workers); open(); }
+	void run(void) override { net::Reactor::run(); }
+protected:
+	net::Channel *make(void) override { return new LineEcho(); }
+};
+
+static string ask(net::ClientSocket& c, cstring line) {
+	c.out().write(line.chars(), line.length());
+	char buf[256];
+	int n = 0;
+	while(n == 0 || buf[n - 1] != '\n') {
+		int r = c.in().read(buf + n, sizeof(buf) - n);
+		if(r <= 0)
+			break;
+		n += r;
+	}
+	return string(buf, n);
+}
+
+static void serve(int workers, bool& ok_line, bool& ok_slow, bool& ok_many) {
+	EchoServer server(workers);
+	sys::Thread *t = sys::Thread::make(server);
+	t->start();
+
+	// simple line
+	net::ClientSocket *c1 = net::ClientSocket::make(server.port());
+	c1->connect();
+	ok_line = ask(*c1, "hello\n") == "hello\n";
+
+	// a slow client does not block the others
+	net::ClientSocket *slow = net::ClientSocket::make(server.port());
+	slow->connect();
+	slow->out().write("partial", 7);
+	net::ClientSocket *c2 = net::ClientSocket::make(server.port());
+	c2->connect();
+	ok_slow = ask(*c2, "other\n") == "other\n";
+	ok_slow = ok_slow && ask(*slow, " line\n") == "partial line\n";
+
+	// many requests
+	ok_many = true;
+	for(int i = 0; ok_many && i < 200; i++)
+		ok_many = ask(*c1, "ping\n") == "ping\n";
+
+	delete c1;
+	delete c2;
+	delete slow;
+	server.net::Reactor::stop();
+	t->join();
+	delete t;
+}
+
+TEST_BEGIN(reactor)
+
+	{
+		bool line, slow, many;
+		serve(0, line, slow, many);
+		CHECK(line);
+		CHECK(slow);
+		CHECK(many);
+	}
+
+	{
+		bool line, slow, many;
+		serve(3, line, slow, many);
+		CHECK(line);
+		CHECK(slow);
+		CHECK(many);
+	}
+
+TEST_END
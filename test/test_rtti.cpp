@@ -55,6 +55,19 @@ BEGIN_ENUM(my_enum_t)
 END_ENUM
 //DEFINE_ENUM(my_enum_t, my_enum_t_type);
 
+typedef enum sparse_t {
+	S1 = -100,
+	S2 = 7,
+	S3 = 100000
+} sparse_t;
+DECLARE_ENUM(sparse_t);
+
+BEGIN_ENUM(sparse_t)
+	.value("S1", S1)
+	.value("S2", S2)
+	.value("S3", S3)
+END_ENUM
+
 class AA {
 public:
 	AA(void): x(666) { }
@@ -101,6 +114,8 @@ public:
 	void m6(int, float) const { }
 
 	const Vector<int>& m7(void) const { return v;}
+	int m9(int a, int b) const { return a + b; }
+	static int h(int a, int b) { return a * b; }
 
 	class Iter: public Vector<int>::Iter {
 	public:
@@ -124,6 +139,8 @@ rtti::Class<X> X::__type(rtti::make("X")
 	.op("m5", &X::m5)
 	.op("m6", &X::m6)
 	.coll("m7", &X::m7)
+	.op("m9", &X::m9)
+	.op("h", X::h)
 	.iter<int, X::Iter, X>("m8"));
 
 
@@ -148,6 +165,21 @@ rtti::Class<ConcreteC, AbstractC> ConcreteC::__type("ConcreteC");
 rtti::Declare sys_path_class(rtti::tuple1("elm::sys::Path", &sys::Path::toString));
 
 
+// operation only implementing call()
+class CallOnly: public rtti::Operation {
+public:
+	CallOnly(): rtti::Operation(STATIC, "call_only", type_of<int>())
+		{ add(rtti::Parameter(type_of<int>())); add(rtti::Parameter(type_of<int>())); }
+	Variant call(const Vector<Variant>& args) const override
+		{ return Variant(args[0].as<int>() - args[1].as<int>()); }
+};
+
+// operation implementing nothing
+class Unimplemented: public rtti::Operation {
+public:
+	Unimplemented(): rtti::Operation(STATIC, "unimplemented", type_of<int>()) { }
+};
+
 TEST_BEGIN(rtti)
 	{
 		CHECK_EQUAL(&rtti::int8_type, &type_of<t::int8>());
@@ -161,6 +193,20 @@ TEST_BEGIN(rtti)
 		CHECK_EQUAL(et.nameFor(A), cstring("A"));
 		CHECK_EQUAL(et.nameFor(B), cstring("B"));
 		CHECK_EQUAL(et.nameFor(C), cstring("C"));
+		CHECK_EQUAL(et.valueFor("D"), -1);
+		CHECK_EQUAL(et.nameFor(3), cstring(""));
+		CHECK_EQUAL(rtti::Type::get("my_enum_t"), &t);
+		CHECK_EQUAL(rtti::Type::get("no_such_type"), static_cast<const rtti::Type *>(nullptr));
+	}
+
+	{
+		const rtti::Enumerable& et = type_of<sparse_t>().asEnum();
+		CHECK_EQUAL(et.valueFor("S1"), int(S1));
+		CHECK_EQUAL(et.valueFor("S3"), int(S3));
+		CHECK_EQUAL(et.nameFor(S1), cstring("S1"));
+		CHECK_EQUAL(et.nameFor(S2), cstring("S2"));
+		CHECK_EQUAL(et.nameFor(S3), cstring("S3"));
+		CHECK_EQUAL(et.nameFor(8), cstring(""));
 	}
 
 	{
@@ -234,6 +280,63 @@ TEST_BEGIN(rtti)
 		CHECK_EQUAL(s6.as<AClass>().x, 111);
 	}
 
+	// call sites
+	{
+		X x;
+		rtti::CallSite<const X *, int, int> m9(X::__type, "m9");
+		CHECK_EQUAL(m9(&x, 2, 3).as<int>(), 5);
+		rtti::CallSite<int, int> h(X::__type, "h");
+		CHECK_EQUAL(h(6, 7).as<int>(), 42);
+		rtti::CallSite<> f(X::__type, "f");
+		CHECK(f().as<X *>() != nullptr);
+		rtti::CallSite<int> make(X::__type, "X");
+		X *p = make(111).as<X *>();
+		CHECK(p != nullptr);
+		delete p;
+		Vector<Variant> args;
+		args.add(&x);
+		args.add(4);
+		args.add(5);
+		CHECK_EQUAL(m9.operation().call(args).as<int>(), 9);
+		Vector<Variant> short_args;
+		short_args.add(&x);
+		CHECK_EXCEPTION(MessageException, m9.operation().call(short_args));
+		rtti::Frame<3> frame(&x, 10, 20);
+		CHECK_EQUAL(m9.call(frame).as<int>(), 30);
+		bool failed = false;
+		try {
+			rtti::CallSite<const X *, float, int> bad(X::__type, "m9");
+		}
+		catch(MessageException& e) {
+			failed = true;
+		}
+		CHECK(failed);
+		failed = false;
+		try {
+			rtti::CallSite<int> bad(X::__type, "h");
+		}
+		catch(MessageException& e) {
+			failed = true;
+		}
+		CHECK(failed);
+	}
+
+	// default invoke() forwarding to call()
+	{
+		CallOnly op;
+		Variant args[2] = { Variant(10), Variant(3) };
+		CHECK_EQUAL(op.invoke(args).as<int>(), 7);
+		Unimplemented none;
+		bool failed = false;
+		try {
+			none.invoke(nullptr);
+		}
+		catch(MessageException& e) {
+			failed = true;
+		}
+		CHECK(failed);
+	}
+
 	// RTTI constructor
 	/*{
 		Vector<Variant> args;
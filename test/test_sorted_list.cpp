@@ -186,4 +186,31 @@ TEST_BEGIN(sorted_list)
 		CHECK_EQUAL(s, 6);
 	}
 
+	// bulk addition
+	{
+		SortedList<int> l;
+		l.add(10);
+		l.add(20);
+		Vector<int> v;
+		for(int i = 29; i >= 0; i -= 3)
+			v.add(i);
+		v.add(10);
+		l.addAll(v);
+		CHECK_EQUAL(l.count(), 13);
+		bool ok = true;
+		int p = -1;
+		for(auto x: l) {
+			ok = ok && p <= x;
+			p = x;
+		}
+		CHECK(ok);
+		CHECK(l.contains(2));
+		CHECK(l.contains(29));
+		CHECK(l.contains(20));
+		SortedList<int> e;
+		e.addAll(v);
+		CHECK_EQUAL(e.first(), 2);
+		CHECK_EQUAL(e.last(), 29);
+	}
+
 TEST_END
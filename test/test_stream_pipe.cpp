@@ -0,0 +1,196 @@
+/*
+ *	StreamPipe class test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/io/BlockOutStream.h>
+#include <elm/io/StreamPipe.h>
+#include <elm/io/TeeOutStream.h>
+#include <elm/sys/System.h>
+#include <elm/sys/Thread.h>
+#include <elm/test.h>
+
+using namespace elm;
+
+static const int file_size = 1 << 20;
+
+// build the reference file
+static void make(const sys::Path& path) {
+	io::OutStream *out = sys::System::createFile(path);
+	char buf[4096];
+	for(int i = 0; i < file_size; i += sizeof(buf)) {
+		for(int j = 0; j < int(sizeof(buf)); j++)
+			buf[j] = char((i + j) * 31 + (i + j) / 251);
+		out->write(buf, sizeof(buf));
+	}
+	delete out;
+}
+
+// read a whole file
+static void load(const sys::Path& path, io::BlockOutStream& out) {
+	io::InStream *in = sys::System::readFile(path);
+	io::StreamPipe pipe(*in, out);
+	pipe.proceed();
+	delete in;
+}
+
+// compare a file with the reference one
+static bool same(const sys::Path& ref, const sys::Path& path) {
+	io::BlockOutStream r, p;
+	load(ref, r);
+	load(path, p);
+	return r.size() == p.size() && memcmp(r.block(), p.block(), r.size()) == 0;
+}
+
+static int copy(const sys::Path& from, const sys::Path& to, bool zero = true) {
+	io::InStream *in = sys::System::readFile(from);
+	io::OutStream *out = sys::System::createFile(to);
+	io::StreamPipe pipe(*in, *out);
+	pipe.setZeroCopy(zero);
+	int r = pipe.proceed();
+	delete in;
+	delete out;
+	return r;
+}
+
+// feed a pipe from a file
+class Feeder: public sys::Runnable {
+public:
+	Feeder(const sys::Path& path, io::OutStream *out): p(path), o(out), r(0) { }
+	void run(void) override {
+		io::InStream *in = sys::System::readFile(p);
+		io::StreamPipe pipe(*in, *o);
+		r = pipe.proceed();
+		delete in;
+		delete o;
+	}
+	sys::Path p;
+	io::OutStream *o;
+	int r;
+};
+
+TEST_BEGIN(stream_pipe)
+
+	sys::Path ref = sys::Path::temp() / "elm-stream-pipe-ref";
+	sys::Path res = sys::Path::temp() / "elm-stream-pipe-res";
+	sys::Path res2 = sys::Path::temp() / "elm-stream-pipe-res2";
+	make(ref);
+
+	// file to file
+	{
+		CHECK_EQUAL(copy(ref, res), file_size);
+		CHECK(same(ref, res));
+		CHECK_EQUAL(copy(ref, res, false), file_size);
+		CHECK(same(ref, res));
+	}
+
+	// file to pipe to file
+	{
+		Pair<sys::SystemInStream *, sys::SystemOutStream *> p = sys::System::pipe();
+		Feeder feeder(ref, p.snd);
+		sys::Thread *t = sys::Thread::make(feeder);
+		t->start();
+		io::OutStream *out = sys::System::createFile(res);
+		io::StreamPipe pipe(*p.fst, *out);
+		int r = pipe.proceed();
+		t->join();
+		delete t;
+		delete out;
+		delete p.fst;
+		CHECK_EQUAL(feeder.r, file_size);
+		CHECK_EQUAL(r, file_size);
+		CHECK(same(ref, res));
+	}
+
+	// fan-out to two files
+	{
+		io::InStream *in = sys::System::readFile(ref);
+		io::OutStream *out1 = sys::System::createFile(res);
+		io::OutStream *out2 = sys::System::createFile(res2);
+		io::TeeOutStream tee(*out1, *out2);
+		io::StreamPipe pipe(*in, tee);
+		CHECK_EQUAL(pipe.proceed(), file_size);
+		delete in;
+		delete out1;
+		delete out2;
+		CHECK(same(ref, res));
+		CHECK(same(ref, res2));
+	}
+
+	// fan-out to a file and memory (buffered path)
+	{
+		io::InStream *in = sys::System::readFile(ref);
+		io::OutStream *out = sys::System::createFile(res);
+		io::BlockOutStream block;
+		io::TeeOutStream tee(*out, block);
+		io::StreamPipe pipe(*in, tee);
+		CHECK_EQUAL(pipe.proceed(), file_size);
+		delete in;
+		delete out;
+		CHECK(same(ref, res));
+		CHECK_EQUAL(block.size(), file_size);
+	}
+
+	// pipe to file in append mode
+	{
+		copy(ref, res);
+		Pair<sys::SystemInStream *, sys::SystemOutStream *> p = sys::System::pipe();
+		Feeder feeder(ref, p.snd);
+		sys::Thread *t = sys::Thread::make(feeder);
+		t->start();
+		io::OutStream *out = sys::System::appendFile(res);
+		io::StreamPipe pipe(*p.fst, *out);
+		int r = pipe.proceed();
+		t->join();
+		delete t;
+		delete out;
+		delete p.fst;
+		CHECK_EQUAL(r, file_size);
+		io::BlockOutStream block;
+		load(res, block);
+		CHECK_EQUAL(block.size(), 2 * file_size);
+		io::BlockOutStream rblock;
+		load(ref, rblock);
+		CHECK(memcmp(block.block() + file_size, rblock.block(), file_size) == 0);
+	}
+
+	// file to file in append mode
+	{
+		copy(ref, res);
+		io::InStream *in = sys::System::readFile(ref);
+		io::OutStream *out = sys::System::appendFile(res);
+		io::StreamPipe pipe(*in, *out);
+		CHECK_EQUAL(pipe.proceed(), file_size);
+		delete in;
+		delete out;
+		io::BlockOutStream block;
+		load(res, block);
+		CHECK_EQUAL(block.size(), 2 * file_size);
+	}
+
+	// special file with no size
+	{
+		CHECK(copy("/proc/self/status", res) > 0);
+	}
+
+	sys::System::removeFile(ref);
+	sys::System::removeFile(res);
+	sys::System::removeFile(res2);
+
+TEST_END
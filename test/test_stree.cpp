@@ -23,6 +23,7 @@
 #define ELM_STREE_DEBUG
 #include <elm/stree/MarkerBuilder.h>
 #include <elm/stree/SegmentBuilder.h>
+#include <elm/stree/IntervalTree.h>
 
 using namespace elm;
 using namespace elm::stree;
@@ -252,4 +253,80 @@ TEST_BEGIN(stree)
 		CHECK_EQUAL(tree.get(2500, 0), 0);
 	}
 
+	// test the flat tree
+	{
+		FlatTree<addr_t, area_t> ftree;
+		builder.make(ftree);
+		for(int i = 0; i < marks_count - 1; i++) {
+			CHECK_EQUAL(ftree.get(marks[i].fst, NONE), marks[i].snd);
+			CHECK_EQUAL(ftree.get(marks[i].fst + 1, NONE), marks[i].snd);
+		}
+		CHECK_EQUAL(ftree.get(0xffffffff, NONE), NONE);
+
+		SegmentBuilder<int, int> sbuilder(0);
+		sbuilder.add(1000, 2000, 1);
+		sbuilder.add(3000, 4000, 2);
+		sbuilder.add(4000, 5000, 3);
+		FlatTree<int, int> stree;
+		sbuilder.make(stree);
+		CHECK_EQUAL(stree.get(500, -1), -1);
+		CHECK_EQUAL(stree.get(1000, -1), 1);
+		CHECK_EQUAL(stree.get(1999, -1), 1);
+		CHECK_EQUAL(stree.get(2500, -1), 0);
+		CHECK_EQUAL(stree.get(4000, -1), 3);
+		CHECK_EQUAL(stree.get(5000, -1), -1);
+	}
+
+	// test the interval tree
+	{
+		IntervalTree<int, int> itree;
+		CHECK(!itree.contains(10));
+		itree.add(1000, 2000, 1);
+		itree.add(1500, 3000, 2);
+		itree.add(4000, 5000, 3);
+		itree.add(0, 10000, 4);
+		CHECK_EQUAL(itree.count(), 4);
+		CHECK_EQUAL(itree.get(100, 0), 4);
+		CHECK_EQUAL(itree.get(1200, 0), 4);
+		int n = 0;
+		for(auto i = itree.stab(1600); i(); i++)
+			n++;
+		CHECK_EQUAL(n, 3);
+		n = 0;
+		for(auto i = itree.overlap(2000, 4001); i(); i++)
+			n++;
+		CHECK_EQUAL(n, 3);
+		CHECK(itree.remove(0, 10000));
+		CHECK(!itree.remove(0, 10000));
+		CHECK_EQUAL(itree.get(1200, 0), 1);
+		CHECK_EQUAL(itree.get(3500, 0), 0);
+		CHECK(!itree.overlaps(3000, 4000));
+		CHECK(itree.overlaps(2999, 4000));
+
+		// compare with a brute-force look-up
+		IntervalTree<int, int> rtree;
+		const int size = 1000;
+		int lows[size], highs[size];
+		for(int i = 0; i < size; i++) {
+			lows[i] = (i * 7919) % 10000;
+			highs[i] = lows[i] + 1 + (i * 104729) % 300;
+			rtree.add(lows[i], highs[i], i);
+		}
+		for(int i = 0; i < size; i += 2)
+			rtree.remove(lows[i], highs[i]);
+		CHECK_EQUAL(rtree.count(), size / 2);
+		bool ok = true;
+		for(int k = 0; k < 10300; k += 7) {
+			int cnt = 0;
+			for(int i = 1; i < size; i += 2)
+				if(lows[i] <= k && k < highs[i])
+					cnt++;
+			for(auto i = rtree.stab(k); i(); i++)
+				cnt--;
+			if(cnt != 0)
+				ok = false;
+		}
+		CHECK(ok);
+	}
+
 TEST_END
@@ -0,0 +1,285 @@
+/*
+ *	synchronization primitives test
+ *
+ *	This file is part of OTAWA
+ *	Copyright (c) 2026, IRIT UPS.
+ *
+ *	OTAWA is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation; either version 2 of the License, or
+ *	(at your option) any later version.
+ *
+ *	OTAWA is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with OTAWA; if not, write to the Free Software
+ *	Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <elm/sys/Atomic.h>
+#include <elm/sys/Barrier.h>
+#include <elm/sys/CondVar.h>
+#include <elm/sys/Mutex.h>
+#include <elm/sys/Once.h>
+#include <elm/sys/RWLock.h>
+#include <elm/sys/SpinLock.h>
+#include <elm/sys/Thread.h>
+#include <elm/test.h>
+
+using namespace elm;
+using namespace elm::sys;
+
+static const int thread_count = 4;
+static const int loops = 20000;
+
+// run the same runnable in several threads
+static void runAll(Runnable **rs, int n = thread_count) {
+	Thread *ts[thread_count];
+	for(int i = 0; i < n; i++)
+		ts[i] = Thread::make(*rs[i]);
+	for(int i = 0; i < n; i++)
+		ts[i]->start();
+	for(int i = 0; i < n; i++) {
+		ts[i]->join();
+		delete ts[i];
+	}
+}
+
+template <class L>
+class Incrementer: public Runnable {
+public:
+	Incrementer(L& lock, int& counter): _lock(lock), _counter(counter) { }
+	void run(void) override {
+		for(int i = 0; i < loops; i++) {
+			Guard<L> guard(_lock);
+			_counter++;
+		}
+	}
+private:
+	L& _lock;
+	int& _counter;
+};
+
+template <class L>
+static int count(void) {
+	L lock;
+	int counter = 0;
+	Incrementer<L> i1(lock, counter), i2(lock, counter), i3(lock, counter), i4(lock, counter);
+	Runnable *rs[] = { &i1, &i2, &i3, &i4 };
+	runAll(rs);
+	return counter;
+}
+
+class RWUser: public Runnable {
+public:
+	RWUser(RWLock& lock, int *data, bool& ok): _lock(lock), _data(data), _ok(ok) { }
+	void run(void) override {
+		for(int i = 0; i < loops; i++)
+			if(i % 10 == 0) {
+				RWLock::WriteGuard guard(_lock);
+				_data[0]++;
+				_data[1]++;
+			}
+			else {
+				RWLock::ReadGuard guard(_lock);
+				if(_data[0] != _data[1])
+					_ok = false;
+			}
+	}
+private:
+	RWLock& _lock;
+	int *_data;
+	bool& _ok;
+};
+
+class Consumer: public Runnable {
+public:
+	Consumer(Mutex& mutex, CondVar& cond, int& item, bool& done): m(mutex), c(cond), _item(item), _done(done), sum(0) { }
+	void run(void) override {
+		m.lock();
+		while(true) {
+			c.wait(m, [this]() { return _item != 0 || _done; });
+			if(_item == 0)
+				break;
+			sum += _item;
+			_item = 0;
+			c.notifyAll();
+		}
+		m.unlock();
+	}
+	Mutex& m;
+	CondVar& c;
+	int& _item;
+	bool& _done;
+	t::int64 sum;
+};
+
+class Phaser: public Runnable {
+public:
+	Phaser(Barrier& barrier, Atomic<int>& counter, bool& ok): _barrier(barrier), _counter(counter), _ok(ok), last(0) { }
+	void run(void) override {
+		for(int p = 1; p <= 100; p++) {
+			_counter.fetchAdd(1);
+			if(_barrier.wait())
+				last++;
+			if(_counter.load() < p * thread_count)
+				_ok = false;
+			_barrier.wait();
+		}
+	}
+	Barrier& _barrier;
+	Atomic<int>& _counter;
+	bool& _ok;
+	int last;
+};
+
+class Counter: public Runnable {
+public:
+	Counter(Latch& latch, Once& once, Atomic<int>& inits): _latch(latch), _once(once), _inits(inits) { }
+	void run(void) override {
+		_once.call([this]() { _inits++; });
+		_latch.countDown();
+		_latch.wait();
+	}
+	Latch& _latch;
+	Once& _once;
+	Atomic<int>& _inits;
+};
+
+TEST_BEGIN(sync)
+
+	// atomics
+	{
+		Atomic<int> a(1);
+		CHECK_EQUAL(a.load(), 1);
+		CHECK_EQUAL(a.fetchAdd(2, RELAXED), 1);
+		CHECK_EQUAL(int(a), 3);
+		int e = 3;
+		CHECK(a.compareExchange(e, 10, ACQ_REL));
+		e = 3;
+		CHECK(!a.compareExchange(e, 11));
+		CHECK_EQUAL(e, 10);
+		CHECK_EQUAL(++a, 11);
+		CHECK_EQUAL(a.exchange(0), 11);
+		CHECK_EQUAL(a.load(ACQUIRE), 0);
+	}
+
+	// locks
+	LockStats::enable();
+	CHECK_EQUAL(count<SpinLock>(), loops * thread_count);
+	CHECK_EQUAL(count<Mutex>(), loops * thread_count);
+	{
+		Mutex m;
+		CHECK(m.tryLock());
+		CHECK(m.isLocked());
+		CHECK(!m.tryLock());
+		m.unlock();
+		CHECK(!m.isLocked());
+		SpinLock s;
+		CHECK(s.tryLock());
+		CHECK(!s.tryLock());
+		s.unlock();
+	}
+
+	// read-write lock
+	{
+		RWLock lock;
+		CHECK(lock.tryLockRead());
+		CHECK(lock.tryLockRead());
+		CHECK_EQUAL(lock.readers(), 2);
+		CHECK(!lock.tryLockWrite());
+		lock.unlockRead();
+		lock.unlockRead();
+		CHECK(lock.tryLockWrite());
+		CHECK(lock.isWriteLocked());
+		CHECK(!lock.tryLockRead());
+		lock.unlockWrite();
+
+		int data[2] = { 0, 0 };
+		bool ok = true;
+		RWUser u1(lock, data, ok), u2(lock, data, ok), u3(lock, data, ok), u4(lock, data, ok);
+		Runnable *rs[] = { &u1, &u2, &u3, &u4 };
+		runAll(rs);
+		CHECK(ok);
+		CHECK_EQUAL(data[0], thread_count * loops / 10);
+	}
+
+	// condition variable
+	{
+		Mutex m;
+		CondVar c;
+		int item = 0;
+		bool done = false;
+		Consumer consumer(m, c, item, done);
+		Thread *t = Thread::make(consumer);
+		t->start();
+		for(int i = 1; i <= 1000; i++) {
+			m.lock();
+			c.wait(m, [&item]() { return item == 0; });
+			item = i;
+			m.unlock();
+			c.notifyAll();
+		}
+		m.lock();
+		c.wait(m, [&item]() { return item == 0; });
+		done = true;
+		m.unlock();
+		c.notifyAll();
+		t->join();
+		delete t;
+		CHECK_EQUAL(consumer.sum, t::int64(1000 * 1001 / 2));
+	}
+
+	// barrier
+	{
+		Barrier b(thread_count);
+		Atomic<int> counter(0);
+		bool ok = true;
+		Phaser p1(b, counter, ok), p2(b, counter, ok), p3(b, counter, ok), p4(b, counter, ok);
+		Runnable *rs[] = { &p1, &p2, &p3, &p4 };
+		runAll(rs);
+		CHECK(ok);
+		CHECK_EQUAL(counter.load(), 100 * thread_count);
+		CHECK_EQUAL(p1.last + p2.last + p3.last + p4.last, 100);
+	}
+
+	// latch and once
+	{
+		Latch l(thread_count);
+		Once once;
+		Atomic<int> inits(0);
+		CHECK(!l.tryWait());
+		Counter c1(l, once, inits), c2(l, once, inits), c3(l, once, inits), c4(l, once, inits);
+		Runnable *rs[] = { &c1, &c2, &c3, &c4 };
+		runAll(rs);
+		CHECK(l.tryWait());
+		CHECK(once.isDone());
+		CHECK_EQUAL(inits.load(), 1);
+		once.call([&inits]() { inits++; });
+		CHECK_EQUAL(inits.load(), 1);
+
+		Once failing;
+		bool thrown = false;
+		try {
+			failing.call([]() { throw Exception(); });
+		}
+		catch(Exception& e) {
+			thrown = true;
+		}
+		CHECK(thrown);
+		CHECK(!failing.isDone());
+		failing.call([&inits]() { inits++; });
+		CHECK(failing.isDone());
+		CHECK_EQUAL(inits.load(), 2);
+	}
+
+	// statistics
+	LockStats::print(cout);
+	LockStats::enable(false);
+	LockStats::reset();
+	CHECK_EQUAL(LockStats::count(LockStats::MUTEX), t::uint64(0));
+
+TEST_END
@@ -61,4 +61,60 @@ TEST_BEGIN(utf8)
 		CHECK(!i);
 	}
 
+	// validation
+	{
+		CHECK(isValid("abcd"));
+		CHECK(isASCII("abcd"));
+		CHECK(isValid("caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80"));
+		CHECK(!isASCII("caf\xc3\xa9"));
+		CHECK(!isValid("\x80"));
+		CHECK(!isValid("\xc0\xaf"));
+		CHECK(!isValid("\xe0\x80\xaf"));
+		CHECK(!isValid("\xed\xa0\x80"));
+		CHECK(!isValid("\xf4\x90\x80\x80"));
+		CHECK(!isValid("abc\xc3"));
+		string l = "0123456789abcdef0123456789abcdef0123456789";
+		CHECK(isValid(l));
+		CHECK(!isValid(l + "\xff" + l));
+		CHECK(isValid(l + "\xc3\xa9" + l));
+	}
+
+	// counting
+	{
+		CHECK_EQUAL(count(""), t::size(0));
+		CHECK_EQUAL(count("abcd"), t::size(4));
+		string s = "caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80 and some ASCII text \xc3\xa9";
+		t::size n = 0;
+		for(Iter i(s); i(); i++)
+			n++;
+		CHECK_EQUAL(count(s), n);
+	}
+
+	// transcoding
+	{
+		string s = "ASCII prefix of more than 16 chars: caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80!";
+		t::uint16 u16[100];
+		char_t u32[100];
+		char u8[400];
+		t::size n16 = toUTF16(s, u16), n32 = toUTF32(s, u32);
+		CHECK_EQUAL(n32, count(s));
+		CHECK_EQUAL(n16, n32 + 1);
+		CHECK_EQUAL(u32[n32 - 2], char_t(0x1F600));
+		CHECK_EQUAL(u16[n16 - 3], t::uint16(0xD83D));
+		CHECK_EQUAL(u16[n16 - 2], t::uint16(0xDE00));
+		CHECK_EQUAL(u32[39], char_t(0xE9));
+		CHECK_EQUAL(u16[0], t::uint16('A'));
+		t::size n8 = fromUTF16(u16, n16, u8);
+		CHECK_EQUAL(string(u8, n8), s);
+		n8 = fromUTF32(u32, n32, u8);
+		CHECK_EQUAL(string(u8, n8), s);
+		CHECK_EQUAL(fromUTF16(u16, n16), s);
+		CHECK_EQUAL(fromUTF32(u32, n32), s);
+		CHECK_EXCEPTION(utf8::Exception, toUTF16("ab\xff", u16));
+		t::uint16 bad[] = { 'a', 0xDC00 };
+		CHECK_EXCEPTION(utf8::Exception, fromUTF16(bad, 2, u8));
+		char_t big[] = { 0x110000 };
+		CHECK_EXCEPTION(utf8::Exception, fromUTF32(big, 1, u8));
+	}
+
 TEST_END
@@ -50,11 +50,10 @@ void display_element(Element *elem, int level) {
 }
 
 // test_xom()
-void test_xom(void) {
-	CHECK_BEGIN("XOM");
+TEST_BEGIN(xom)
 	Builder builder;
 	Document *doc = builder.build("file.xml");
-	CHECK(doc);
+	REQUIRE(doc, return);
 	Element *root_element = doc->getRootElement();
 	CHECK(root_element);
 	display_element(root_element, 0);
@@ -77,17 +76,103 @@ void test_xom(void) {
 		CHECK_EQUAL(elems->get(2)->getLocalName(), xom::String("d"));
 		delete elems;
 	}
+
+	// Check lazy wrappers and child cache
+	{
+		CHECK_EQUAL(root_element->getChildCount(), 3);
+		Node *a = root_element->getChild(0);
+		CHECK(a == root_element->getChild(0));
+		CHECK(a->getParent() == root_element);
+		CHECK_EQUAL(root_element->indexOf(a), 0);
+		CHECK_EQUAL(root_element->indexOf(root_element->getChild(2)), 2);
+		Element *e = new Element("e");
+		root_element->appendChild(e);
+		CHECK_EQUAL(root_element->getChildCount(), 4);
+		CHECK(root_element->getChild(3) == e);
+		e->detach();
+		CHECK_EQUAL(root_element->getChildCount(), 3);
+		delete e;
+	}
+
+	// Check zero-copy views
+	{
+		CHECK_EQUAL(*root_element->getAttributeView("a1"), xom::String("ok"));
+		CHECK_EQUAL(*root_element->getAttributeView("a2"), xom::String("ko"));
+		CHECK(!root_element->getAttributeView("a3"));
+		Element *a = root_element->getFirstChildElement("a");
+		CHECK_EQUAL(a->getValueView(), xom::String("ok"));
+		CHECK(a->getValueView().chars() == a->getValueView().chars());
+		Element *c = root_element->getFirstChildElement("c");
+		xom::String v = c->getValueView();
+		xom::String w = c->getValue();
+		CHECK_EQUAL(v, w);
+		w.free();
+		CHECK_EQUAL(root_element->getAttribute("a1")->getValue(), xom::String("ok"));
+	}
+
+	// Check composed views are built once and after a modification
+	{
+		Element *c = root_element->getFirstChildElement("c");
+		xom::String v = c->getValueView();
+		CHECK(v.chars() == c->getValueView().chars());
+		int n = c->getChildCount();
+		c->appendChild("ok4");
+		xom::String w = c->getValueView();
+		CHECK(v.chars() != w.chars());
+		CHECK(w.chars() == c->getValueView().chars());
+		CHECK_EQUAL(c->getChildCount(), n + 1);
+	}
+
+	// Check ownership of the detached and user wrappers
+	{
+		Node *b = root_element->getChild(1);
+		CHECK(root_element->removeChild(b) == b);
+		CHECK_EQUAL(root_element->getChildCount(), 2);
+		Element *e = new Element("e");
+		root_element->appendChild(e);
+		xom::String a1 = root_element->getAttribute("a1")->getValue();
+		delete doc;
+		CHECK_EQUAL(a1, xom::String("ok"));
+		a1.free();
+		CHECK_EQUAL(b->kind(), Node::ELEMENT);
+		delete b;
+		delete e;
+	}
 	
 	// Check xinclude
 	{
 		Document *doc = builder.build("including.xml");
-		CHECK(doc);
+		REQUIRE(doc, return);
 		XIncluder::resolveInPlace(doc);
 		Element *root_element = doc->getRootElement();
 		CHECK(root_element);
 		display_element(root_element, 0);
+		delete doc;
+	}
+
+	// Check streaming reader
+	{
+		io::BlockInStream in("<a x=\"1\"><b>text</b><!--c--><b/></a>");
+		Reader reader(in);
+		CHECK(reader.next());
+		CHECK_EQUAL(reader.event(), Reader::START_ELEMENT);
+		CHECK_EQUAL(reader.name(), xom::String("a"));
+		CHECK_EQUAL(reader.attributeCount(), 1);
+		CHECK_EQUAL(*reader.getAttributeValue("x"), xom::String("1"));
+		CHECK(reader.next());
+		CHECK_EQUAL(reader.depth(), 1);
+		Document *doc = reader.expand();
+		CHECK_EQUAL(doc->getRootElement()->getValue(), xom::String("text"));
+		delete doc;
+		CHECK(reader.next());
+		CHECK_EQUAL(reader.event(), Reader::COMMENT);
+		CHECK(reader.next());
+		CHECK(reader.isEmpty());
+		reader.skip();
+		CHECK(reader.next());
+		CHECK_EQUAL(reader.event(), Reader::END_ELEMENT);
+		CHECK(!reader.next());
+		CHECK(reader.ended());
 	}
-	
-	CHECK_END;
-}
 
+TEST_END